@@ -0,0 +1,220 @@
+#include "AircraftLayout.hpp"
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+
+// ==================== CONSTRUCTION ====================
+
+AircraftLayout::AircraftLayout()
+    : cabinCount(0), rows(0), cols(0), blockedRows(nullptr), blockedCount(0) {
+    preset("default", *this);
+}
+
+AircraftLayout::AircraftLayout(const AircraftLayout& other)
+    : cabinCount(0), rows(0), cols(0), blockedRows(nullptr), blockedCount(0) {
+    *this = other;
+}
+
+AircraftLayout& AircraftLayout::operator=(const AircraftLayout& other) {
+    if (this == &other) return *this;
+
+    name = other.name;
+    cabinCount = other.cabinCount;
+    for (int i = 0; i < cabinCount; i++) cabins[i] = other.cabins[i];
+    rows = other.rows;
+    cols = other.cols;
+    blockedCount = other.blockedCount;
+
+    delete[] blockedRows;
+    blockedRows = nullptr;
+    if (other.blockedRows) {
+        blockedRows = new uint32_t[rows];
+        std::memcpy(blockedRows, other.blockedRows, sizeof(uint32_t) * rows);
+    }
+    return *this;
+}
+
+AircraftLayout::~AircraftLayout() {
+    delete[] blockedRows;
+}
+
+// ==================== BUILDING ====================
+
+void AircraftLayout::reset(const std::string& layoutName, int seatsPerRow) {
+    name = layoutName;
+    cabinCount = 0;
+    rows = 0;
+    cols = seatsPerRow < 1 ? 1 : (seatsPerRow > MAX_LAYOUT_COLS ? MAX_LAYOUT_COLS : seatsPerRow);
+    delete[] blockedRows;
+    blockedRows = nullptr;
+    blockedCount = 0;
+}
+
+// Keeps the blocked-seat words in step with the row count
+void AircraftLayout::growBlocked(int newRows) {
+    if (!blockedRows) return;
+    uint32_t* grown = new uint32_t[newRows];
+    std::memcpy(grown, blockedRows, sizeof(uint32_t) * rows);
+    std::memset(grown + rows, 0, sizeof(uint32_t) * (newRows - rows));
+    delete[] blockedRows;
+    blockedRows = grown;
+}
+
+bool AircraftLayout::addCabin(const std::string& seatClass, int firstRow, int lastRow) {
+    if (cabinCount >= MAX_CABINS || seatClass.empty()) return false;
+    if (firstRow != rows + 1 || lastRow < firstRow || lastRow > MAX_LAYOUT_ROWS) return false;
+
+    growBlocked(lastRow);
+    cabins[cabinCount].seatClass = seatClass;
+    cabins[cabinCount].firstRow = firstRow;
+    cabins[cabinCount].lastRow = lastRow;
+    cabinCount++;
+    rows = lastRow;
+    return true;
+}
+
+bool AircraftLayout::blockSeat(int row, int colIndex) {
+    if (row < 1 || row > rows || colIndex < 0 || colIndex >= cols) return false;
+    if (!blockedRows) {
+        blockedRows = new uint32_t[rows];
+        std::memset(blockedRows, 0, sizeof(uint32_t) * rows);
+    }
+    uint32_t bit = 1u << colIndex;
+    if (!(blockedRows[row - 1] & bit)) {
+        blockedRows[row - 1] |= bit;
+        blockedCount++;
+    }
+    return true;
+}
+
+// ==================== PRESETS ====================
+
+bool AircraftLayout::preset(const std::string& presetName, AircraftLayout& out) {
+    if (presetName == "default") {
+        out.reset("default", DEFAULT_LAYOUT_COLS);
+        out.addCabin("Business", 1, 50);
+        out.addCabin("First", 51, 150);
+        out.addCabin("Economy", 151, DEFAULT_LAYOUT_ROWS);
+        return true;
+    }
+    if (presetName == "narrow") {
+        out.reset("narrow", NARROW_LAYOUT_COLS);
+        out.addCabin("Business", 1, 4);
+        out.addCabin("Economy", 5, NARROW_LAYOUT_ROWS);
+        return true;
+    }
+    if (presetName == "wide") {
+        out.reset("wide", WIDE_LAYOUT_COLS);
+        out.addCabin("First", 1, 2);
+        out.addCabin("Business", 3, 12);
+        out.addCabin("Economy", 13, WIDE_LAYOUT_ROWS);
+        // Galley block behind the Business cabin (centre section D-G)
+        for (int c = 3; c <= 6; c++) out.blockSeat(13, c);
+        return true;
+    }
+    return false;
+}
+
+// ==================== FILE LOADING ====================
+
+bool AircraftLayout::loadFromFile(const char* path, std::string& error) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        error = std::string("could not open ") + path;
+        return false;
+    }
+
+    AircraftLayout parsed;
+    parsed.reset(path, DEFAULT_LAYOUT_COLS);
+    bool sawColumns = false;
+    std::string line;
+    int lineNo = 0;
+
+    while (std::getline(file, line)) {
+        lineNo++;
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+
+        std::istringstream in(line);
+        std::string key;
+        if (!(in >> key)) continue;
+
+        std::string where = " (line " + std::to_string(lineNo) + ")";
+
+        if (key == "name") {
+            std::string value;
+            if (in >> value) parsed.name = value;
+        } else if (key == "columns") {
+            int c = 0;
+            if (!(in >> c) || c < 1 || c > MAX_LAYOUT_COLS || parsed.cabinCount > 0) {
+                error = "columns must be 1-26 and precede the cabins" + where;
+                return false;
+            }
+            parsed.cols = c;
+            sawColumns = true;
+        } else if (key == "cabin") {
+            std::string seatClass, range;
+            int first = 0, last = 0;
+            if (!(in >> seatClass >> range) ||
+                std::sscanf(range.c_str(), "%d-%d", &first, &last) != 2 ||
+                !parsed.addCabin(seatClass, first, last)) {
+                error = "cabin needs CLASS FIRST-LAST continuing from the previous cabin" + where;
+                return false;
+            }
+        } else if (key == "blocked") {
+            std::string seat;
+            while (in >> seat) {
+                int row = std::atoi(seat.c_str());
+                char letter = seat.empty() ? '\0' : seat[seat.size() - 1];
+                if (!parsed.blockSeat(row, letter - 'A')) {
+                    error = "blocked seat " + seat + " is outside the cabins" + where;
+                    return false;
+                }
+            }
+        } else {
+            error = "unknown directive '" + key + "'" + where;
+            return false;
+        }
+    }
+
+    if (!sawColumns || parsed.cabinCount == 0) {
+        error = std::string(path) + " needs a columns line and at least one cabin";
+        return false;
+    }
+
+    *this = parsed;
+    return true;
+}
+
+// ==================== QUERIES ====================
+
+const std::string& AircraftLayout::cabinForRow(int row) const {
+    static const std::string unknown = "Economy";
+    if (cabinCount == 0) return unknown;
+    for (int i = 0; i < cabinCount; i++) {
+        if (row <= cabins[i].lastRow) return cabins[i].seatClass;
+    }
+    return cabins[cabinCount - 1].seatClass;
+}
+
+// ==================== ACTIVE LAYOUT ====================
+
+static AircraftLayout& activeLayoutStorage() {
+    static AircraftLayout layout;
+    return layout;
+}
+
+const AircraftLayout& activeLayout() {
+    return activeLayoutStorage();
+}
+
+void setActiveLayout(const AircraftLayout& layout) {
+    activeLayoutStorage() = layout;
+}
+
+bool loadAircraftLayout(const std::string& spec, AircraftLayout& out, std::string& error) {
+    if (AircraftLayout::preset(spec, out)) return true;
+    return out.loadFromFile(spec.c_str(), error);
+}
@@ -0,0 +1,108 @@
+#ifndef AIRCRAFT_LAYOUT_HPP
+#define AIRCRAFT_LAYOUT_HPP
+
+#include <cstdint>
+#include <string>
+
+// Aircraft seat-map description: cabins (row ranges with a class name),
+// seats per row and blocked seats (exits, galleys, crew rests). Seat grids and
+// occupancy maps are sized from the active layout at runtime.
+//
+// Layout file format (one directive per line, '#' starts a comment):
+//
+//   name    A320-narrow
+//   columns 6
+//   cabin   Business 1-4
+//   cabin   Economy  5-30
+//   blocked 12A 12F 13A 13F
+//
+// Cabins must be listed front to back without gaps; the last cabin's final
+// row is the aircraft's row count. Rows are 1-indexed, columns are letters.
+
+const int MAX_CABINS = 8;
+const int MAX_LAYOUT_COLS = 26;   // seat letters A-Z
+const int MAX_LAYOUT_ROWS = 100000;
+
+// Built-in layouts; each has a fixed-geometry instantiation of the hot-path
+// structures (see FixedSeatOccupancy) so it can be benchmarked against the
+// runtime-sized versions.
+const int DEFAULT_LAYOUT_ROWS = 400;   // original 400 x 26 aircraft
+const int DEFAULT_LAYOUT_COLS = 26;
+const int NARROW_LAYOUT_ROWS = 30;     // single aisle, 3-3
+const int NARROW_LAYOUT_COLS = 6;
+const int WIDE_LAYOUT_ROWS = 60;       // twin aisle, 3-4-3
+const int WIDE_LAYOUT_COLS = 10;
+
+struct CabinSection {
+    std::string seatClass;
+    int firstRow;   // 1-indexed, inclusive
+    int lastRow;
+};
+
+class AircraftLayout {
+private:
+    std::string name;
+    CabinSection cabins[MAX_CABINS];
+    int cabinCount;
+    int rows;
+    int cols;
+    uint32_t* blockedRows;   // one word per row, bit c = seat c blocked (nullptr if none)
+    int blockedCount;
+
+    void growBlocked(int newRows);
+
+public:
+    AircraftLayout();   // the default 400 x 26 aircraft
+    AircraftLayout(const AircraftLayout& other);
+    AircraftLayout& operator=(const AircraftLayout& other);
+    ~AircraftLayout();
+
+    // --- BUILDING ---
+    // Empties the layout; cabins and blocked seats are added afterwards
+    void reset(const std::string& layoutName, int seatsPerRow);
+    // Appends the next cabin; it must start right after the previous one
+    bool addCabin(const std::string& seatClass, int firstRow, int lastRow);
+    // Row is 1-indexed, column 0-indexed
+    bool blockSeat(int row, int colIndex);
+
+    bool loadFromFile(const char* path, std::string& error);
+    static bool preset(const std::string& presetName, AircraftLayout& out);
+
+    // --- QUERIES ---
+    const std::string& getName() const { return name; }
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+    int getCabinCount() const { return cabinCount; }
+    const CabinSection& getCabin(int index) const { return cabins[index]; }
+    int getBlockedCount() const { return blockedCount; }
+    int getSeatCount() const { return rows * cols - blockedCount; }   // sellable seats
+
+    // Class name for a 1-indexed row (last cabin for rows beyond the aircraft)
+    const std::string& cabinForRow(int row) const;
+
+    bool isBlocked(int row, int colIndex) const {
+        if (!blockedRows || row < 1 || row > rows || colIndex < 0 || colIndex >= cols) return false;
+        return (blockedRows[row - 1] >> colIndex) & 1u;
+    }
+
+    // Marks every blocked seat as taken so it is never assigned
+    template <class Occupancy>
+    void markBlocked(Occupancy& occupancy) const {
+        if (!blockedRows) return;
+        for (int r = 0; r < rows; r++) {
+            uint32_t bits = blockedRows[r];
+            for (int c = 0; bits; c++, bits >>= 1) {
+                if (bits & 1u) occupancy.reserve(r, c);
+            }
+        }
+    }
+};
+
+// Process-wide layout used by the menus, class lookup and display systems
+const AircraftLayout& activeLayout();
+void setActiveLayout(const AircraftLayout& layout);
+
+// Accepts a preset name (default, narrow, wide) or a layout file path
+bool loadAircraftLayout(const std::string& spec, AircraftLayout& out, std::string& error);
+
+#endif
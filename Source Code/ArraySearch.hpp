@@ -3,90 +3,41 @@
 
 #include <iostream>
 #include "Passenger.hpp"
+#include "PassengerSystem.hpp"
 using namespace std;
 
-class ArrayPassengerSystem {
-private:
-    Passenger* dataArray;  
-    int capacity;
-    int count;
-
+// Array column of the search menu: contiguous storage, no index, selection sort
+class ArrayPassengerSystem : public PassengerSystem<ArrayStorage, NoIndex, SelectionSort> {
 public:
-    // Constructor: allocate memory for the array
-    ArrayPassengerSystem(int size) {
-        capacity = size;
-        count = 0;
-        dataArray = new Passenger[capacity];
+    // `size` is the initial capacity; the array grows past it
+    explicit ArrayPassengerSystem(int size) {
+        reserve(size);
     }
 
-    // Adds a passenger to the array (if not full)
     void addPassenger(const string& id, const string& n, int r, char c, const string& cls) {
-        if (count < capacity) {
-            dataArray[count] = Passenger(id, n, r, c, cls, false);
-            count++;
-        }
+        add(Passenger(id, n, r, c, cls, false));
     }
 
     // --- UNSORTED LINEAR SEARCH (O(n)) ---
-    // Identical algorithm to original SET 2
-    void searchPassengerUnsorted(const string& targetID) {
-        for (int i = 0; i < count; i++) {
-            if (dataArray[i].passengerID == targetID)
-                return; // stop when found
-        }
+    bool searchPassengerUnsorted(const string& targetID) {
+        return containsUnsorted(targetID);
     }
 
     // --- SORTED LINEAR SEARCH WITH EARLY EXIT ---
-    // Identical algorithm to original SET 2
-    void searchPassengerSorted(const string& targetID) {
-        for (int i = 0; i < count; i++) {
-            if (dataArray[i].passengerID == targetID) return;
-            if (dataArray[i].passengerID > targetID) break;
-        }
+    bool searchPassengerSorted(const string& targetID) {
+        return containsSorted(targetID);
     }
 
     // --- BINARY SEARCH (O(log n)) ---
-    // Identical algorithm to original SET 2
-    void searchPassengerBinary(const string& targetID) {
-        int left = 0, right = count - 1;
-        while (left <= right) {
-            int mid = left + (right - left) / 2;
-
-            if (dataArray[mid].passengerID == targetID) return;
-            else if (dataArray[mid].passengerID < targetID) left = mid + 1;
-            else right = mid - 1;
-        }
+    bool searchPassengerBinary(const string& targetID) {
+        return containsBinary(targetID);
     }
 
     // --- SELECTION SORT (O(n²)) ---
-    // Identical algorithm to original SET 2
     void sortData() {
-        for (int i = 0; i < count - 1; i++) {
-            int minIndex = i;
-            for (int j = i + 1; j < count; j++) {
-                if (dataArray[j].passengerID < dataArray[minIndex].passengerID)
-                    minIndex = j;
-            }
-            if (minIndex != i) {
-                // Swap passengers 
-                Passenger temp = dataArray[i];
-                dataArray[i] = dataArray[minIndex];
-                dataArray[minIndex] = temp;
-            }
-        }
+        sortByID();
         cout << "[ARRAY] Sorted by PassengerID." << endl;
     }
-
-    // Destructor: free dynamic memory 
-    ~ArrayPassengerSystem() {
-        delete[] dataArray;
-    }
-
-    // --- SPACE COMPLEXITY MEASUREMENT ---
-    // Same calculation approach, different Passenger size
-    size_t memoryUsage() const {
-        return sizeof(Passenger) * capacity;
-    }
 };
 
-#endif 
\ No newline at end of file
+#endif 
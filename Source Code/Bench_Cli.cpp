@@ -0,0 +1,1258 @@
+#include "Bench_Cli.hpp"
+#include "Benchmark.hpp"
+#include "Seat_Manifest.hpp"
+#include "ArrayReservation.hpp"
+#include "LinkedListReservation.hpp"
+#include "PassengerBinary.hpp"
+#include "FleetStore.hpp"
+#include "ConcurrentReservation.hpp"
+#include "SnapshotStore.hpp"
+#include "WorkStealingPool.hpp"
+#include "WriteAheadLog.hpp"
+#include "PassengerSystem.hpp"
+#include "Cancellation.hpp"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <ctime>
+
+// ==================== OPTIONS ====================
+
+static const int MAX_LIST_ITEMS = 64;   // values per list option; more is an error
+static const int SEARCH_ID_POOL = 64;   // rotating IDs so lookups are not one warm key
+
+struct BenchOptions {
+    std::string dataset;
+    AircraftLayout layout;
+    std::string ops[MAX_LIST_ITEMS];
+    int opCount;
+    std::string structures[MAX_LIST_ITEMS];
+    int structureCount;
+    int sizes[MAX_LIST_ITEMS];
+    int sizeCount;
+    int flights[MAX_LIST_ITEMS];
+    int flightCount;
+    int threads[MAX_LIST_ITEMS];
+    int threadCount;
+    int groups[MAX_LIST_ITEMS];
+    int groupCount;
+    int commitWindows[MAX_LIST_ITEMS];   // microseconds, 0 = no batching delay
+    int commitWindowCount;
+    int fleetLoad;           // passengers booked per flight before timing (0 = half the seats)
+    int readPercent;         // share of searches in the mixed workload
+    int mixedOps;            // operations per thread in the mixed workload
+    int batchSize;           // IDs per batch-* lookup call
+    int walOps;              // committed operations per wal-commit run (all threads)
+    std::string walPath;
+    bool layoutGiven;
+    BenchmarkConfig config;
+    std::string label;
+    std::string jsonPath;
+    std::string csvPath;
+
+    BenchOptions()
+        : dataset("Updated_Passenger_List.csv"), opCount(0), structureCount(0), sizeCount(0),
+          flightCount(0), threadCount(0), groupCount(0), commitWindowCount(0), fleetLoad(0), readPercent(95),
+          mixedOps(20000), batchSize(4096), walOps(2000), walPath("bench.wal"), layoutGiven(false) {}
+};
+
+struct BenchRecord {
+    std::string layout;
+    std::string structure;
+    std::string operation;
+    int size;               // records, or flights for fleet operations
+    BenchmarkResult result;
+    long heapBytes;         // tracked heap of the structure (0 = not measured)
+    int threads;            // worker threads when `size` is something else (0 = not recorded)
+    double allocsPerOp;     // heap allocations per operation (-1 = not counted)
+    double freesPerOp;      // heap frees per operation (-1 = not counted)
+
+    BenchRecord() : size(0), heapBytes(0), threads(0), allocsPerOp(-1.0), freesPerOp(-1.0) {}
+};
+
+static int splitList(const char* text, std::string* out, int maxItems);
+
+static bool isFleetOp(const std::string& op) {
+    return op.compare(0, 6, "fleet-") == 0;
+}
+
+static bool isBatchOp(const std::string& op) {
+    return op.compare(0, 6, "batch-") == 0;
+}
+
+// Chart and manifest output, checked for identical bytes across structures
+static bool isDisplayOp(const std::string& op) {
+    return op == "chart-build" || op == "chart" || op == "manifest" || op == "sorted-manifest" ||
+           op == "export" || op == "export-page" || op == "display";
+}
+
+// Seat queries, checked for identical answers across structures
+static bool isQueryOp(const std::string& op) {
+    return op == "query" || op == "column-build";
+}
+
+// Parses "1,10,100" into integers >= minValue; returns the count stored, or
+// -1 for more than MAX_LIST_ITEMS values
+static int parseIntList(const char* text, int* out, int minValue = 1) {
+    std::string items[MAX_LIST_ITEMS];
+    int n = splitList(text, items, MAX_LIST_ITEMS);
+    if (n < 0) return -1;
+    int count = 0;
+    for (int k = 0; k < n; k++) {
+        int value = std::atoi(items[k].c_str());
+        if (value >= minValue && (value > 0 || items[k] == "0")) out[count++] = value;
+    }
+    return count;
+}
+
+// Splits "a,b,c" into `out`; returns the number of items stored, or -1 if
+// there are more than maxItems
+static int splitList(const char* text, std::string* out, int maxItems) {
+    int count = 0;
+    std::string item;
+    for (const char* p = text; ; p++) {
+        if (*p == ',' || *p == '\0') {
+            if (!item.empty()) {
+                if (count == maxItems) return -1;
+                out[count++] = item;
+            }
+            item.clear();
+            if (*p == '\0') break;
+        } else {
+            item += *p;
+        }
+    }
+    return count;
+}
+
+static bool parseOptions(int argc, char** argv, BenchOptions& opts) {
+    for (int i = 0; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") return false;
+
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << "\n";
+            return false;
+        }
+        const char* value = argv[++i];
+
+        if (arg == "--dataset") {
+            opts.dataset = value;
+        } else if (arg == "--layout") {
+            std::string error;
+            if (!loadAircraftLayout(value, opts.layout, error)) {
+                std::cerr << "Invalid layout: " << error << "\n";
+                return false;
+            }
+            opts.layoutGiven = true;
+        } else if (arg == "--ops") {
+            opts.opCount = splitList(value, opts.ops, MAX_LIST_ITEMS);
+        } else if (arg == "--structures") {
+            opts.structureCount = splitList(value, opts.structures, MAX_LIST_ITEMS);
+        } else if (arg == "--sizes") {
+            opts.sizeCount = parseIntList(value, opts.sizes);
+        } else if (arg == "--flights") {
+            opts.flightCount = parseIntList(value, opts.flights);
+        } else if (arg == "--threads") {
+            opts.threadCount = parseIntList(value, opts.threads);
+        } else if (arg == "--groups") {
+            opts.groupCount = parseIntList(value, opts.groups);
+        } else if (arg == "--commit-windows") {
+            opts.commitWindowCount = parseIntList(value, opts.commitWindows, 0);
+        } else if (arg == "--wal-ops") {
+            opts.walOps = std::atoi(value);
+        } else if (arg == "--wal-path") {
+            opts.walPath = value;
+        } else if (arg == "--fleet-load") {
+            opts.fleetLoad = std::atoi(value);
+        } else if (arg == "--read-pct") {
+            opts.readPercent = std::atoi(value);
+            if (opts.readPercent < 0 || opts.readPercent > 100) {
+                std::cerr << "--read-pct must be between 0 and 100\n";
+                return false;
+            }
+        } else if (arg == "--mixed-ops") {
+            opts.mixedOps = std::atoi(value);
+        } else if (arg == "--batch") {
+            opts.batchSize = std::atoi(value);
+        } else if (arg == "--reps") {
+            opts.config.samples = std::atoi(value);
+        } else if (arg == "--warmup") {
+            opts.config.warmupRuns = std::atoi(value);
+        } else if (arg == "--min-sample-ns") {
+            opts.config.minSampleNs = std::atof(value);
+        } else if (arg == "--label") {
+            opts.label = value;
+        } else if (arg == "--json") {
+            opts.jsonPath = value;
+        } else if (arg == "--csv") {
+            opts.csvPath = value;
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            return false;
+        }
+
+        if (opts.opCount < 0 || opts.structureCount < 0 || opts.sizeCount < 0 || opts.flightCount < 0 ||
+            opts.threadCount < 0 || opts.groupCount < 0 || opts.commitWindowCount < 0) {
+            std::cerr << "Too many values for " << arg << " (at most " << MAX_LIST_ITEMS << ")\n";
+            return false;
+        }
+    }
+
+    if (opts.flightCount == 0) {
+        opts.flightCount = parseIntList("1,10,100,1000,10000", opts.flights);
+    }
+    if (opts.threadCount == 0) {
+        opts.threadCount = parseIntList("1,2,4,8", opts.threads);
+    }
+    if (opts.groupCount == 0) {
+        opts.groupCount = parseIntList("8,16,32,64", opts.groups);
+    }
+    if (opts.commitWindowCount == 0) {
+        opts.commitWindowCount = parseIntList("0,100,1000", opts.commitWindows, 0);
+    }
+
+    // Defaults: every single-flight operation (fleet operations are opt-in)
+    if (opts.opCount == 0) {
+        opts.opCount = splitList("search,binary,sort,chart-build,chart,manifest,sorted-manifest,display,reserve,reserve-fixed", opts.ops, MAX_LIST_ITEMS);
+    }
+    if (opts.structureCount == 0) {
+        opts.structureCount = splitList("array,list,hash", opts.structures, MAX_LIST_ITEMS);
+    }
+
+    // Every mixed-workload thread takes one of the snapshot's reader slots
+    for (int o = 0; o < opts.opCount; o++) {
+        if (opts.ops[o] != "mixed") continue;
+        for (int t = 0; t < opts.threadCount; t++) {
+            if (opts.threads[t] > SNAPSHOT_MAX_READERS) {
+                std::cerr << "--ops mixed supports at most " << SNAPSHOT_MAX_READERS << " threads\n";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void printBenchUsage() {
+    std::cout << "Usage: <program> --bench [options]\n"
+              << "  --dataset PATH        CSV dataset (default Updated_Passenger_List.csv)\n"
+              << "  --layout SPEC         default, narrow, wide or a seat-map file (default: default)\n"
+              << "  --ops LIST            search,binary,sort,chart-build,chart,manifest,sorted-manifest,export,\n"
+              << "                        export-page,display,reserve,reserve-fixed,fleet-book,fleet-search,reserve-mt,mixed,batch-search,batch-binary,\n"
+              << "                        group-lookup,wal-commit,policy-matrix,alloc,query,column-build\n"
+              << "  --structures LIST     array,list,hash,columns (columns: query only)\n"
+              << "  --sizes LIST          record counts, e.g. 1000,5000,10000\n"
+              << "  --flights LIST        fleet sizes for fleet-* ops (default 1,10,100,1000,10000)\n"
+              << "  --fleet-load N        passengers per flight before timing (default half the seats)\n"
+              << "  --threads LIST        thread counts for reserve-mt, mixed, batch-* and wal-commit (default 1,2,4,8)\n"
+              << "  --groups LIST         keys per call for group-lookup (default 8,16,32,64)\n"
+              << "  --batch N             IDs per batch-* lookup call (default 4096)\n"
+              << "  --read-pct N          searches as a percentage of mixed operations (default 95)\n"
+              << "  --mixed-ops N         operations per thread for mixed (default 20000)\n"
+              << "  --commit-windows LIST group commit windows in microseconds for wal-commit (default 0,100,1000)\n"
+              << "  --wal-ops N           committed operations per wal-commit run (default 2000)\n"
+              << "  --wal-path PATH       scratch log file for wal-commit (default bench.wal)\n"
+              << "  --reps N              timed samples per benchmark (default 31)\n"
+              << "  --warmup N            untimed warmup runs (default 3)\n"
+              << "  --min-sample-ns N     calibration target per sample (default 100000)\n"
+              << "  --label TEXT          build/run label stored with the results\n"
+              << "  --json PATH           write JSON results\n"
+              << "  --csv PATH            write CSV results\n";
+}
+
+// ==================== BENCHMARK DISPATCH ====================
+
+// Evenly spaced IDs from the loaded subset
+static int collectSearchIDs(const Passenger* passengers, int count, std::string* ids) {
+    int occupied = 0;
+    for (int i = 0; i < count; i++) {
+        if (!passengers[i].isEmpty) occupied++;
+    }
+    if (occupied == 0) return 0;
+
+    int wanted = occupied < SEARCH_ID_POOL ? occupied : SEARCH_ID_POOL;
+    int stride = occupied / wanted;
+    int collected = 0;
+    int seen = 0;
+    for (int i = 0; i < count && collected < wanted; i++) {
+        if (passengers[i].isEmpty) continue;
+        if (seen % stride == 0) ids[collected++] = passengers[i].passengerID;
+        seen++;
+    }
+    return collected;
+}
+
+static int findMaxNumericID(const Passenger* passengers, int count) {
+    int maxID = 0;
+    for (int i = 0; i < count; i++) {
+        if (passengers[i].isEmpty) continue;
+        int id = std::atoi(passengers[i].passengerID.c_str());
+        if (id > maxID) maxID = id;
+    }
+    return maxID;
+}
+
+// Times batches of reservations into the free seats of `layout`
+template <class Reservation>
+static bool benchReserve(const AircraftLayout& layout, const Passenger* passengers, int count,
+                         int maxID, const BenchmarkConfig& config, BenchmarkResult& out) {
+    Reservation* res = new Reservation(layout);
+    res->init(passengers, count, maxID);
+
+    int batch = layout.getSeatCount() - res->getPassengerCount();
+    if (batch > 300) batch = 300;
+    if (batch <= 0) {
+        delete res;
+        return false;
+    }
+
+    Passenger tmp;
+    out = runBenchmarkWithSetup(
+        [&]() { res->init(passengers, count, maxID); },
+        [&]() { for (int i = 0; i < batch; i++) res->reserveWithIndex("Bench", "Economy", tmp); },
+        batch, config);
+    delete res;
+    return true;
+}
+
+// Runs one (structure, operation) pair; returns false if the pair is not applicable
+static bool runOne(const std::string& structure, const std::string& op,
+                   const AircraftLayout& layout, const Passenger* passengers, int count,
+                   ArrayDisplaySystem& arraySys, LinkedListDisplaySystem& llSys,
+                   const BenchmarkConfig& config, BenchmarkResult& out) {
+    bool isArray = (structure == "array");
+    bool isList = (structure == "list");
+    bool isHash = (structure == "hash");
+
+    std::string ids[SEARCH_ID_POOL];
+    int idCount = 0;
+    int next = 0;
+
+    if (op == "search" || op == "binary") {
+        idCount = collectSearchIDs(passengers, count, ids);
+        if (idCount == 0) return false;
+    }
+
+    if (op == "search") {
+        if (isArray) {
+            out = runBenchmark([&]() { doNotOptimize(arraySys.linearSearchByID(ids[next++ % idCount])); }, config);
+        } else if (isList) {
+            out = runBenchmark([&]() { doNotOptimize(llSys.linearSearchByID(ids[next++ % idCount])); }, config);
+        } else if (isHash) {
+            out = runBenchmark([&]() { doNotOptimize(llSys.hashSearchByID(ids[next++ % idCount])); }, config);
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    if (op == "binary") {
+        if (!isArray) return false;
+        arraySys.sortByPassengerID();
+        out = runBenchmark([&]() { doNotOptimize(arraySys.binarySearchByID(ids[next++ % idCount])); }, config);
+        return true;
+    }
+
+    if (op == "query") {
+        SeatQuery queries[STANDARD_QUERY_COUNT];
+        standardSeatQueries(queries);
+        if (structure == "columns") {
+            SeatColumns columns;
+            arraySys.buildSeatColumns(columns);
+            out = measureColumnarQueryTime(columns, queries, STANDARD_QUERY_COUNT, config);
+        } else if (isArray) {
+            out = arraySys.measureSeatQueryTime(queries, STANDARD_QUERY_COUNT, config);
+        } else if (isList) {
+            out = llSys.measureSeatQueryTime(queries, STANDARD_QUERY_COUNT, config);
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    if (!isArray && !isList) return false;  // remaining operations have no hash-specific variant
+
+    if (op == "sort") {
+        out = isArray ? arraySys.measureSortingTime(config) : llSys.measureSortingTime(config);
+    } else if (op == "chart-build") {
+        out = isArray ? arraySys.measureChartBuildTime(config) : llSys.measureChartBuildTime(config);
+    } else if (op == "chart") {
+        out = isArray ? arraySys.measureSeatingChartTime(config) : llSys.measureSeatingChartTime(config);
+    } else if (op == "manifest") {
+        out = isArray ? arraySys.measureUnsortedManifestTime(config) : llSys.measureUnsortedManifestTime(config);
+    } else if (op == "sorted-manifest") {
+        out = isArray ? arraySys.measureSortedManifestTime(config) : llSys.measureSortedManifestTime(config);
+    } else if (op == "export") {
+        out = isArray ? arraySys.measureManifestExportTime(config) : llSys.measureManifestExportTime(config);
+    } else if (op == "export-page") {
+        out = isArray ? arraySys.measureManifestPageTime(MANIFEST_DISPLAY_LIMIT, config)
+                      : llSys.measureManifestPageTime(MANIFEST_DISPLAY_LIMIT, config);
+    } else if (op == "column-build") {
+        out = isArray ? arraySys.measureColumnBuildTime(config) : llSys.measureColumnBuildTime(config);
+    } else if (op == "display") {
+        out = isArray ? arraySys.measureDisplayOnlyTime(config) : llSys.measureDisplayOnlyTime(config);
+    } else if (op == "reserve") {
+        int maxID = findMaxNumericID(passengers, count);
+        if (isArray) {
+            return benchReserve<ArrayReservation>(layout, passengers, count, maxID, config, out);
+        }
+        return benchReserve<LinkedListReservation>(layout, passengers, count, maxID, config, out);
+    } else if (op == "reserve-fixed") {
+        // Compile-time geometry; only layouts with a built-in instantiation
+        int maxID = findMaxNumericID(passengers, count);
+        int rows = layout.getRows();
+        int cols = layout.getCols();
+        if (rows == DEFAULT_LAYOUT_ROWS && cols == DEFAULT_LAYOUT_COLS) {
+            return isArray
+                ? benchReserve<FixedArrayReservation<DEFAULT_LAYOUT_ROWS, DEFAULT_LAYOUT_COLS> >(layout, passengers, count, maxID, config, out)
+                : benchReserve<FixedLinkedListReservation<DEFAULT_LAYOUT_ROWS, DEFAULT_LAYOUT_COLS> >(layout, passengers, count, maxID, config, out);
+        }
+        if (rows == NARROW_LAYOUT_ROWS && cols == NARROW_LAYOUT_COLS) {
+            return isArray
+                ? benchReserve<FixedArrayReservation<NARROW_LAYOUT_ROWS, NARROW_LAYOUT_COLS> >(layout, passengers, count, maxID, config, out)
+                : benchReserve<FixedLinkedListReservation<NARROW_LAYOUT_ROWS, NARROW_LAYOUT_COLS> >(layout, passengers, count, maxID, config, out);
+        }
+        if (rows == WIDE_LAYOUT_ROWS && cols == WIDE_LAYOUT_COLS) {
+            return isArray
+                ? benchReserve<FixedArrayReservation<WIDE_LAYOUT_ROWS, WIDE_LAYOUT_COLS> >(layout, passengers, count, maxID, config, out)
+                : benchReserve<FixedLinkedListReservation<WIDE_LAYOUT_ROWS, WIDE_LAYOUT_COLS> >(layout, passengers, count, maxID, config, out);
+        }
+        return false;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// ==================== HEAP OPERATION COUNTS ====================
+
+// Longer than the small-string buffer, so a record copy that allocates shows up
+static const char* const ALLOC_BENCH_NAME = "Heap Operation Count Passenger";
+
+struct HeapOpResult {
+    BenchmarkResult timing;
+    double allocsPerOp;
+    double freesPerOp;
+};
+
+// runBenchmarkWithSetup that also counts the allocations and frees made inside
+// `fn` during the timed samples (warmup runs and setup are not counted)
+template <class Setup, class Fn>
+static HeapOpResult countHeapOps(Setup setup, Fn fn, long opsPerCall, const BenchmarkConfig& config) {
+    size_t allocations = 0;
+    size_t frees = 0;
+    long calls = 0;
+    long counted = 0;
+    HeapOpResult r;
+    r.timing = runBenchmarkWithSetup(setup, [&]() {
+        HeapOpCounts before = threadHeapOps();
+        fn();
+        HeapOpCounts after = threadHeapOps();
+        if (calls++ < config.warmupRuns) return;
+        allocations += after.allocations - before.allocations;
+        frees += after.frees - before.frees;
+        counted++;
+    }, opsPerCall, config);
+
+    double ops = (double)counted * opsPerCall;
+    r.allocsPerOp = ops > 0 ? allocations / ops : 0.0;
+    r.freesPerOp = ops > 0 ? frees / ops : 0.0;
+    return r;
+}
+
+// Batches of indexed reservations into the free seats, as in benchReserve
+template <class Reservation>
+static bool countReserveHeapOps(const AircraftLayout& layout, const Passenger* passengers, int count,
+                                const BenchmarkConfig& config, HeapOpResult& out) {
+    int maxID = findMaxNumericID(passengers, count);
+    Reservation* res = new Reservation(layout);
+    res->init(passengers, count, maxID);
+
+    int batch = layout.getSeatCount() - res->getPassengerCount();
+    if (batch > 300) batch = 300;
+    if (batch <= 0) {
+        delete res;
+        return false;
+    }
+
+    const std::string name = ALLOC_BENCH_NAME;   // built once, not per call
+    const std::string cls = "Economy";
+    Passenger booked;
+    out = countHeapOps(
+        [&]() { res->init(passengers, count, maxID); },
+        [&]() { for (int i = 0; i < batch; i++) res->reserveWithIndex(name, cls, booked); },
+        batch, config);
+    delete res;
+    return true;
+}
+
+// Cancels the search ID pool from a fresh copy of the loaded records: linear
+// search + shift for the array, sentinel search + unlink for the list
+static bool countCancelHeapOps(bool isArray, const Passenger* passengers, int count,
+                               const BenchmarkConfig& config, HeapOpResult& out) {
+    std::string ids[SEARCH_ID_POOL];
+    int idCount = collectSearchIDs(passengers, count, ids);
+    if (idCount == 0) return false;
+
+    if (isArray) {
+        ArrayCancellation* base = new ArrayCancellation(count);
+        ArrayCancellation* work = new ArrayCancellation(count);
+        base->loadFromArray(passengers, count);
+        out = countHeapOps(
+            [&]() { work->copyFrom(*base); },
+            [&]() { for (int i = 0; i < idCount; i++) work->cancelByLinear(ids[i]); },
+            idCount, config);
+        delete work;
+        delete base;
+    } else {
+        LinkedListCancellation* base = new LinkedListCancellation();
+        LinkedListCancellation* work = new LinkedListCancellation();
+        base->loadFromArray(passengers, count);
+        out = countHeapOps(
+            [&]() { work->copyFrom(*base); },
+            [&]() { for (int i = 0; i < idCount; i++) work->cancelBySentinel(ids[i]); },
+            idCount, config);
+        delete work;
+        delete base;
+    }
+    return true;
+}
+
+// One whole sort by ID: the display systems' merge sort over an array, or
+// PassengerSystem's merge sort over a linked list
+static bool countSortHeapOps(bool isArray, const Passenger* passengers, int count,
+                             const BenchmarkConfig& config, HeapOpResult& out) {
+    if (count < 2) return false;
+
+    if (isArray) {
+        Passenger* work = new Passenger[count];
+        out = countHeapOps(
+            [&]() { for (int i = 0; i < count; i++) work[i] = passengers[i]; },
+            [&]() { mergeSort(work, 0, count - 1, true); },
+            1, config);
+        delete[] work;
+    } else {
+        PassengerSystem<ListStorage, NoIndex, MergeSort>* sys = new PassengerSystem<ListStorage, NoIndex, MergeSort>();
+        out = countHeapOps(
+            [&]() {
+                sys->clear();
+                sys->loadFromArray(passengers, count);
+            },
+            [&]() { sys->sortByID(); },
+            1, config);
+        delete sys;
+    }
+    return true;
+}
+
+// ==================== FLEET BENCHMARKS ====================
+
+static const int FLEET_BATCH = 256;      // bookings per timed sample
+static const int FLEET_ID_POOL = 4096;   // lookup keys spread over the whole index (power of two)
+
+static uint64_t nextRandom(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static int greatestCommonDivisor(int a, int b) {
+    while (b) { int t = a % b; a = b; b = t; }
+    return a;
+}
+
+// 500 flight numbers per day, consecutive dates
+static void fleetFlightKey(int index, std::string& number, int& date) {
+    number = "FR" + std::to_string(1000 + index % 500);
+    date = 20260101 + index / 500;
+}
+
+// Builds a fleet of `flights` flights with `load` passengers each (untimed), then
+// times booking (directory lookup + seat + global index) or global ID lookup
+static bool runFleetOne(const std::string& op, const AircraftLayout& layout, int flights, int load,
+                        const BenchmarkConfig& config, BenchmarkResult& out, long& heapBytes) {
+    if (op != "fleet-book" && op != "fleet-search") return false;
+
+    int freePerFlight = layout.getSeatCount() - load;
+    if (load <= 0 || freePerFlight <= 0) return false;
+
+    FleetStore fleet;
+    std::string number;
+    int date;
+    Passenger tmp;
+    for (int f = 0; f < flights; f++) {
+        fleetFlightKey(f, number, date);
+        FlightShard* flight = fleet.addFlight(number, date, layout);
+        for (int k = 0; k < load; k++) fleet.book(flight, "Passenger", "Economy", tmp);
+    }
+    heapBytes = (long)(fleet.shardHeapStats().footprintBytes + fleet.indexHeapStats().footprintBytes);
+
+    uint64_t rng = 42;
+
+    if (op == "fleet-book") {
+        // Spread the batch over the flights (stride coprime to the fleet size) so
+        // no flight receives more bookings than it has free seats
+        long capacityLeft = (long)flights * freePerFlight;
+        int batch = capacityLeft < FLEET_BATCH ? (int)capacityLeft : FLEET_BATCH;
+        int stride = greatestCommonDivisor(7919, flights) == 1 ? 7919 : 1;
+        int start = (int)(nextRandom(rng) % (uint64_t)flights);
+
+        std::string numbers[FLEET_BATCH];
+        int dates[FLEET_BATCH];
+        for (int i = 0; i < batch; i++) {
+            fleetFlightKey((int)((start + (long)i * stride) % flights), numbers[i], dates[i]);
+        }
+
+        // Each sample cancels the previous sample's bookings first (untimed)
+        std::string booked[FLEET_BATCH];
+        int bookedCount = 0;
+        out = runBenchmarkWithSetup(
+            [&]() {
+                for (int i = 0; i < bookedCount; i++) fleet.cancel(booked[i]);
+                bookedCount = 0;
+            },
+            [&]() {
+                for (int i = 0; i < batch; i++) {
+                    if (fleet.book(fleet.findFlight(numbers[i], dates[i]), "Bench", "Economy", tmp)) {
+                        booked[bookedCount++] = tmp.passengerID;
+                    }
+                }
+            },
+            batch, config);
+        return true;
+    }
+
+    // fleet-search: IDs drawn uniformly from every booked passenger
+    int total = fleet.getPassengerCount();
+    std::string* ids = new std::string[FLEET_ID_POOL];
+    for (int i = 0; i < FLEET_ID_POOL; i++) {
+        ids[i] = std::to_string(1 + (long)(nextRandom(rng) % (uint64_t)total));
+    }
+    int next = 0;
+    out = runBenchmark([&]() { doNotOptimize(fleet.findPassenger(ids[next++ & (FLEET_ID_POOL - 1)])); }, config);
+    delete[] ids;
+    return true;
+}
+
+// ==================== BATCH SEARCH ====================
+
+// Random dataset IDs, every 16th replaced by one that is not loaded, so the
+// batch mixes hits with full-length misses
+static void buildBatchIDs(const Passenger* passengers, int count, std::string* ids, int batch) {
+    uint64_t state = 0x2545F4914F6CDD1Dull;
+    for (int i = 0; i < batch; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        if (i % 16 == 15) {
+            ids[i] = "missing-" + std::to_string(i);
+            continue;
+        }
+        ids[i] = "missing";
+        for (int attempt = 0; attempt < 64; attempt++) {
+            const Passenger& p = passengers[(state >> (attempt % 32)) % (uint64_t)count];
+            if (!p.isEmpty) { ids[i] = p.passengerID; break; }
+        }
+    }
+}
+
+// One batch lookup of `ids`; returns false if the structure has no variant for `op`
+static bool runBatchSearch(const std::string& structure, const std::string& op,
+                           ArrayDisplaySystem& arraySys, const LinkedListDisplaySystem& llSys,
+                           const std::string* ids, int batch, Passenger** results,
+                           WorkStealingPool* pool) {
+    if (op == "batch-search") {
+        if (structure == "array") arraySys.batchLinearSearchByID(ids, batch, results, pool);
+        else if (structure == "list") llSys.batchLinearSearchByID(ids, batch, results, pool);
+        else if (structure == "hash") llSys.batchHashSearchByID(ids, batch, results, pool);
+        else return false;
+        return true;
+    }
+    if (op == "batch-binary" && structure == "array") {
+        arraySys.batchBinarySearchByID(ids, batch, results, pool);
+        return true;
+    }
+    return false;
+}
+
+// ==================== GROUP LOOKUPS ====================
+
+static const int GROUP_HASH_KEYS = 65536;   // key pool per timed call (hash)
+static const int GROUP_LIST_KEYS = 64;      // key pool per timed call (list walks are O(n))
+
+// Times one sweep over `keys` in groups of `group`, per key lookup vs the
+// interleaved group path; returns false if the structure has no group path
+static bool runGroupLookup(const std::string& structure, const LinkedListDisplaySystem& llSys,
+                           const std::string* keys, int keyCount, int group,
+                           const BenchmarkConfig& config, Passenger** results,
+                           BenchmarkResult& single, BenchmarkResult& interleaved) {
+    bool isHash = (structure == "hash");
+    if (!isHash && structure != "list") return false;
+
+    single = runBenchmarkWithSetup([]() {}, [&]() {
+        for (int i = 0; i < keyCount; i++) {
+            results[i] = isHash ? llSys.hashSearchByID(keys[i]) : llSys.linearSearchByID(keys[i]);
+        }
+    }, keyCount, config);
+
+    interleaved = runBenchmarkWithSetup([]() {}, [&]() {
+        for (int base = 0; base < keyCount; base += group) {
+            int n = keyCount - base < group ? keyCount - base : group;
+            if (isHash) llSys.hashSearchGroup(keys + base, n, results + base);
+            else llSys.linearSearchGroup(keys + base, n, results + base);
+        }
+    }, keyCount, config);
+    return true;
+}
+
+// ==================== OUTPUT ====================
+
+static std::string jsonEscape(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') { out += '\\'; out += c; }
+        else if (c == '\n') out += "\\n";
+        else if ((unsigned char)c < 0x20) out += ' ';
+        else out += c;
+    }
+    return out;
+}
+
+static std::string timestampUTC() {
+    char buf[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+    return buf;
+}
+
+static std::string compilerVersion() {
+#if defined(__VERSION__)
+    return __VERSION__;
+#elif defined(_MSC_VER)
+    return "MSVC " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+static bool writeJSON(const std::string& path, const BenchOptions& opts,
+                      const BenchRecord* records, int recordCount) {
+    std::ofstream out(path.c_str());
+    if (!out.is_open()) return false;
+
+    out << std::fixed << std::setprecision(2);
+    out << "{\n";
+    out << "  \"label\": \"" << jsonEscape(opts.label) << "\",\n";
+    out << "  \"timestamp\": \"" << timestampUTC() << "\",\n";
+    out << "  \"compiler\": \"" << jsonEscape(compilerVersion()) << "\",\n";
+    out << "  \"dataset\": \"" << jsonEscape(opts.dataset) << "\",\n";
+    out << "  \"layout\": \"" << jsonEscape(opts.layout.getName()) << "\",\n";
+    out << "  \"warmup\": " << opts.config.warmupRuns << ",\n";
+    out << "  \"reps\": " << opts.config.samples << ",\n";
+    out << "  \"results\": [\n";
+    for (int i = 0; i < recordCount; i++) {
+        const BenchRecord& r = records[i];
+        out << "    {\"layout\": \"" << jsonEscape(r.layout) << "\""
+            << ", \"structure\": \"" << r.structure << "\""
+            << ", \"operation\": \"" << r.operation << "\""
+            << ", \"size\": " << r.size
+            << ", \"samples\": " << r.result.samples
+            << ", \"iterations\": " << r.result.iterations
+            << ", \"min_ns\": " << r.result.minNs
+            << ", \"median_ns\": " << r.result.medianNs
+            << ", \"p90_ns\": " << r.result.p90Ns
+            << ", \"p99_ns\": " << r.result.p99Ns
+            << ", \"mean_ns\": " << r.result.meanNs
+            << ", \"stddev_ns\": " << r.result.stddevNs;
+        if (r.heapBytes > 0) out << ", \"heap_bytes\": " << r.heapBytes;
+        if (r.threads > 0) out << ", \"threads\": " << r.threads;
+        if (r.allocsPerOp >= 0.0) out << ", \"allocs_per_op\": " << r.allocsPerOp << ", \"frees_per_op\": " << r.freesPerOp;
+        out << "}" << (i + 1 < recordCount ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+    return true;
+}
+
+static bool writeCSV(const std::string& path, const BenchOptions& opts,
+                     const BenchRecord* records, int recordCount) {
+    std::ofstream out(path.c_str());
+    if (!out.is_open()) return false;
+
+    out << std::fixed << std::setprecision(2);
+    out << "label,layout,structure,operation,size,samples,iterations,min_ns,median_ns,p90_ns,p99_ns,mean_ns,stddev_ns,heap_bytes,threads,allocs_per_op,frees_per_op\n";
+    for (int i = 0; i < recordCount; i++) {
+        const BenchRecord& r = records[i];
+        out << opts.label << ','
+            << r.layout << ','
+            << r.structure << ','
+            << r.operation << ','
+            << r.size << ','
+            << r.result.samples << ','
+            << r.result.iterations << ','
+            << r.result.minNs << ','
+            << r.result.medianNs << ','
+            << r.result.p90Ns << ','
+            << r.result.p99Ns << ','
+            << r.result.meanNs << ','
+            << r.result.stddevNs << ',';
+        if (r.heapBytes > 0) out << r.heapBytes;
+        out << ',';
+        if (r.threads > 0) out << r.threads;
+        out << ',';
+        if (r.allocsPerOp >= 0.0) out << r.allocsPerOp << ',' << r.freesPerOp;
+        else out << ',';
+        out << '\n';
+    }
+    return true;
+}
+
+// ==================== ENTRY POINT ====================
+
+int runBenchCli(int argc, char** argv) {
+    BenchOptions opts;
+    if (!parseOptions(argc, argv, opts)) {
+        printBenchUsage();
+        return 2;
+    }
+
+    // Class lookup and chart cabins follow the benchmarked aircraft
+    setActiveLayout(opts.layout);
+
+    int loadedCount = 0;
+    Passenger* loaded = readPassengersFromFile(opts.dataset.c_str(), &loadedCount);
+    if (!loaded || loadedCount == 0) {
+        std::cerr << "No data loaded from " << opts.dataset << "\n";
+        delete[] loaded;
+        return 1;
+    }
+
+    if (opts.sizeCount == 0) {
+        opts.sizes[0] = loadedCount;
+        opts.sizeCount = 1;
+    }
+
+    int maxRecords = opts.opCount * (opts.structureCount * opts.sizeCount + opts.flightCount + 4 * opts.threadCount) +
+                     opts.opCount * opts.structureCount * (opts.threadCount + 2 * opts.groupCount) +
+                     opts.opCount * opts.commitWindowCount * opts.threadCount +
+                     opts.opCount * opts.sizeCount * POLICY_COMBINATIONS * 4 +
+                     opts.opCount * opts.sizeCount * opts.structureCount * 3;
+    BenchRecord* records = new BenchRecord[maxRecords > 0 ? maxRecords : 1];
+    int recordCount = 0;
+
+    int status = 0;
+    bool displayOps = false;
+    bool queryOps = false;
+    for (int o = 0; o < opts.opCount; o++) {
+        if (isDisplayOp(opts.ops[o])) displayOps = true;
+        if (isQueryOp(opts.ops[o])) queryOps = true;
+    }
+
+    std::cout << std::fixed << std::setprecision(1);
+    for (int s = 0; s < opts.sizeCount; s++) {
+        int size = opts.sizes[s] < loadedCount ? opts.sizes[s] : loadedCount;
+
+        ArrayDisplaySystem arraySys(opts.layout.getRows(), opts.layout.getCols());
+        LinkedListDisplaySystem llSys(opts.layout.getRows(), opts.layout.getCols());
+        arraySys.loadPassengersFromArray(loaded, size);
+        llSys.loadPassengersFromArray(loaded, size);
+
+        // Timings of output operations only count if both structures
+        // produce the same bytes, and of queries if they give the same answers
+        if (displayOps) {
+            std::cout << "size " << size << ": ";
+            if (verifyDisplayOutputs(arraySys, llSys, std::cout) > 0) status = 1;
+        }
+        if (queryOps) {
+            std::cout << "size " << size << ": ";
+            if (verifySeatQueries(arraySys, llSys, std::cout) > 0) status = 1;
+        }
+
+        for (int o = 0; o < opts.opCount; o++) {
+            if (isFleetOp(opts.ops[o]) || isBatchOp(opts.ops[o]) || opts.ops[o] == "group-lookup" ||
+                opts.ops[o] == "reserve-mt" || opts.ops[o] == "mixed" || opts.ops[o] == "wal-commit" ||
+                opts.ops[o] == "policy-matrix" || opts.ops[o] == "alloc") {
+                continue;
+            }
+            for (int k = 0; k < opts.structureCount; k++) {
+                BenchmarkResult result;
+                if (!runOne(opts.structures[k], opts.ops[o], opts.layout, loaded, size,
+                            arraySys, llSys, opts.config, result)) {
+                    continue;
+                }
+
+                BenchRecord& rec = records[recordCount++];
+                rec.layout = opts.layout.getName();
+                rec.structure = opts.structures[k];
+                rec.operation = opts.ops[o];
+                rec.size = size;
+                rec.result = result;
+
+                std::cout << std::left << std::setw(11) << rec.structure
+                          << std::setw(14) << rec.operation
+                          << std::right << std::setw(9) << size
+                          << "  median " << std::setw(14) << result.medianNs << " ns"
+                          << "  p99 " << std::setw(14) << result.p99Ns << " ns\n";
+            }
+        }
+    }
+
+    // Fleet operations scale the number of flights instead of the dataset size.
+    // A fleet of 400-row aircraft does not fit in memory at 10,000 flights, so
+    // they use the narrow-body preset unless --layout was given.
+    AircraftLayout fleetLayout = opts.layout;
+    if (!opts.layoutGiven) AircraftLayout::preset("narrow", fleetLayout);
+    int fleetLoad = opts.fleetLoad > 0 ? opts.fleetLoad : fleetLayout.getSeatCount() / 2;
+
+    for (int o = 0; o < opts.opCount; o++) {
+        if (!isFleetOp(opts.ops[o])) continue;
+        for (int f = 0; f < opts.flightCount; f++) {
+            BenchmarkResult result;
+            long heapBytes = 0;
+            if (!runFleetOne(opts.ops[o], fleetLayout, opts.flights[f], fleetLoad,
+                             opts.config, result, heapBytes)) {
+                continue;
+            }
+
+            BenchRecord& rec = records[recordCount++];
+            rec.layout = fleetLayout.getName();
+            rec.structure = "fleet";
+            rec.operation = opts.ops[o];
+            rec.size = opts.flights[f];
+            rec.result = result;
+            rec.heapBytes = heapBytes;
+
+            std::cout << std::left << std::setw(11) << rec.structure
+                      << std::setw(14) << rec.operation
+                      << std::right << std::setw(9) << rec.size
+                      << "  median " << std::setw(14) << result.medianNs << " ns"
+                      << "  p99 " << std::setw(14) << result.p99Ns << " ns"
+                      << "  heap " << (heapBytes / 1024) << " KB\n";
+        }
+    }
+
+    // Concurrent booking: fills an empty aircraft from 1..N threads, verified per run
+    for (int o = 0; o < opts.opCount; o++) {
+        if (opts.ops[o] != "reserve-mt") continue;
+        for (int t = 0; t < opts.threadCount; t++) {
+            ConcurrentStressResult stress =
+                runConcurrentBookingStress(opts.layout, opts.threads[t], opts.config.samples);
+
+            BenchRecord& rec = records[recordCount++];
+            rec.layout = opts.layout.getName();
+            rec.structure = "concurrent";
+            rec.operation = opts.ops[o];
+            rec.size = opts.threads[t];
+            rec.result = stress.timing;
+
+            std::cout << std::left << std::setw(11) << rec.structure
+                      << std::setw(14) << rec.operation
+                      << std::right << std::setw(9) << rec.size
+                      << "  median " << std::setw(14) << stress.timing.medianNs << " ns"
+                      << "  " << std::setprecision(0) << stress.bookingsPerSecond << " bookings/s"
+                      << std::setprecision(1) << (stress.verified() ? "  verified\n" : "  VERIFICATION FAILED\n");
+            if (!stress.verified()) status = 1;
+        }
+    }
+
+    // Batch lookups: serial loop first, then the work-stealing pool at each
+    // thread count. Pool results must match the serial ones slot for slot.
+    bool anyBatch = false;
+    for (int o = 0; o < opts.opCount; o++) anyBatch = anyBatch || isBatchOp(opts.ops[o]);
+    if (anyBatch && opts.batchSize > 0) {
+        int batch = opts.batchSize;
+        ArrayDisplaySystem arraySys(opts.layout.getRows(), opts.layout.getCols());
+        LinkedListDisplaySystem llSys(opts.layout.getRows(), opts.layout.getCols());
+        arraySys.loadPassengersFromArray(loaded, loadedCount);
+        llSys.loadPassengersFromArray(loaded, loadedCount);
+
+        std::string* ids = new std::string[batch];
+        Passenger** expected = new Passenger*[batch];
+        Passenger** results = new Passenger*[batch];
+        buildBatchIDs(loaded, loadedCount, ids, batch);
+
+        for (int o = 0; o < opts.opCount; o++) {
+            if (!isBatchOp(opts.ops[o])) continue;
+            const std::string& op = opts.ops[o];
+            for (int k = 0; k < opts.structureCount; k++) {
+                const std::string& structure = opts.structures[k];
+                if (!runBatchSearch(structure, op, arraySys, llSys, ids, batch, expected, nullptr)) continue;
+
+                BenchmarkResult serial = runBenchmarkWithSetup(
+                    []() {},
+                    [&]() { runBatchSearch(structure, op, arraySys, llSys, ids, batch, results, nullptr); },
+                    batch, opts.config);
+                std::cout << std::left << std::setw(11) << structure
+                          << std::setw(14) << op
+                          << std::right << std::setw(9) << "serial"
+                          << "  median " << std::setw(14) << serial.medianNs << " ns/id\n";
+
+                for (int t = 0; t < opts.threadCount; t++) {
+                    WorkStealingPool pool(opts.threads[t]);
+                    BenchmarkResult result = runBenchmarkWithSetup(
+                        []() {},
+                        [&]() { runBatchSearch(structure, op, arraySys, llSys, ids, batch, results, &pool); },
+                        batch, opts.config);
+
+                    int mismatches = 0;
+                    for (int i = 0; i < batch; i++) {
+                        if (results[i] != expected[i]) mismatches++;
+                    }
+                    if (mismatches > 0) status = 1;
+
+                    BenchRecord& rec = records[recordCount++];
+                    rec.layout = opts.layout.getName();
+                    rec.structure = structure;
+                    rec.operation = op;
+                    rec.size = opts.threads[t];
+                    rec.result = result;
+
+                    double speedup = result.medianNs > 0.0 ? serial.medianNs / result.medianNs : 0.0;
+                    std::cout << std::left << std::setw(11) << rec.structure
+                              << std::setw(14) << rec.operation
+                              << std::right << std::setw(9) << rec.size
+                              << "  median " << std::setw(14) << result.medianNs << " ns/id"
+                              << "  " << std::setprecision(0) << (result.medianNs > 0.0 ? 1e9 / result.medianNs : 0.0)
+                              << " ids/s" << std::setprecision(2) << "  speedup " << speedup << "x"
+                              << std::setprecision(1)
+                              << (mismatches == 0 ? "" : "  RESULT MISMATCH") << "\n";
+                }
+            }
+        }
+
+        delete[] results;
+        delete[] expected;
+        delete[] ids;
+    }
+
+    // Group lookups: per-key lookups vs the interleaved paths, per group size.
+    // The gap grows once the list or hash chains no longer fit in cache
+    // (e.g. --dataset of a --generate'd million-row file).
+    for (int o = 0; o < opts.opCount; o++) {
+        if (opts.ops[o] != "group-lookup") continue;
+        LinkedListDisplaySystem llSys(opts.layout.getRows(), opts.layout.getCols());
+        llSys.loadPassengersFromArray(loaded, loadedCount);
+
+        for (int k = 0; k < opts.structureCount; k++) {
+            const std::string& structure = opts.structures[k];
+            int keyCount = structure == "hash" ? GROUP_HASH_KEYS : GROUP_LIST_KEYS;
+            std::string* keys = new std::string[keyCount];
+            Passenger** results = new Passenger*[keyCount];
+            Passenger** expected = new Passenger*[keyCount];
+            buildBatchIDs(loaded, loadedCount, keys, keyCount);
+            for (int i = 0; i < keyCount; i++) {
+                expected[i] = structure == "hash" ? llSys.hashSearchByID(keys[i]) : llSys.linearSearchByID(keys[i]);
+            }
+
+            for (int g = 0; g < opts.groupCount; g++) {
+                BenchmarkResult single, interleaved;
+                if (!runGroupLookup(structure, llSys, keys, keyCount, opts.groups[g], opts.config, results,
+                                    single, interleaved)) {
+                    break;
+                }
+                int mismatches = 0;
+                for (int i = 0; i < keyCount; i++) {
+                    if (results[i] != expected[i]) mismatches++;
+                }
+                if (mismatches > 0) status = 1;
+
+                const BenchmarkResult* sides[2] = {&single, &interleaved};
+                const char* sideOps[2] = {"group-single", "group-interleaved"};
+                for (int side = 0; side < 2; side++) {
+                    BenchRecord& rec = records[recordCount++];
+                    rec.layout = opts.layout.getName();
+                    rec.structure = structure;
+                    rec.operation = sideOps[side];
+                    rec.size = opts.groups[g];
+                    rec.result = *sides[side];
+                }
+
+                std::cout << std::left << std::setw(11) << structure
+                          << std::setw(14) << "group-lookup"
+                          << std::right << std::setw(9) << opts.groups[g]
+                          << "  single " << std::setw(10) << single.medianNs << " ns/key"
+                          << "  interleaved " << std::setw(10) << interleaved.medianNs << " ns/key"
+                          << std::setprecision(2) << "  speedup "
+                          << (interleaved.medianNs > 0.0 ? single.medianNs / interleaved.medianNs : 0.0) << "x"
+                          << std::setprecision(1)
+                          << (mismatches == 0 ? "" : "  RESULT MISMATCH") << "\n";
+            }
+            delete[] expected;
+            delete[] results;
+            delete[] keys;
+        }
+    }
+
+    // Mixed searches + bookings: snapshot reads vs the single-mutex baseline.
+    // One record per structure for each side of the mix, sized by thread count.
+    for (int o = 0; o < opts.opCount; o++) {
+        if (opts.ops[o] != "mixed") continue;
+        for (int t = 0; t < opts.threadCount; t++) {
+            for (int useSnapshot = 1; useSnapshot >= 0; useSnapshot--) {
+                MixedWorkloadResult mixed = runMixedWorkload(useSnapshot != 0, loaded, loadedCount,
+                                                             opts.threads[t], opts.mixedOps, opts.readPercent);
+                const BenchmarkResult* sides[2] = {&mixed.readLatency, &mixed.writeLatency};
+                const char* sideOps[2] = {"mixed-read", "mixed-write"};
+
+                for (int side = 0; side < 2; side++) {
+                    if (sides[side]->samples == 0) continue;
+                    BenchRecord& rec = records[recordCount++];
+                    rec.layout = opts.layout.getName();
+                    rec.structure = useSnapshot ? "snapshot" : "mutex";
+                    rec.operation = sideOps[side];
+                    rec.size = opts.threads[t];
+                    rec.result = *sides[side];
+
+                    std::cout << std::left << std::setw(11) << rec.structure
+                              << std::setw(14) << rec.operation
+                              << std::right << std::setw(9) << rec.size
+                              << "  p50 " << std::setw(10) << rec.result.medianNs << " ns"
+                              << "  p90 " << std::setw(10) << rec.result.p90Ns << " ns"
+                              << "  p99 " << std::setw(10) << rec.result.p99Ns << " ns";
+                    if (side == 0) std::cout << "  " << std::setprecision(0) << mixed.opsPerSecond << " ops/s" << std::setprecision(1);
+                    std::cout << "\n";
+                }
+            }
+        }
+    }
+
+    // Policy matrix: every storage x index x sort instantiation of
+    // PassengerSystem at each size. Structure = "storage/index/sort".
+    for (int o = 0; o < opts.opCount; o++) {
+        if (opts.ops[o] != "policy-matrix") continue;
+        PolicyMatrixResult* matrix = new PolicyMatrixResult[POLICY_COMBINATIONS];
+        for (int s = 0; s < opts.sizeCount; s++) {
+            int size = opts.sizes[s] < loadedCount ? opts.sizes[s] : loadedCount;
+            int combinations = runPolicyMatrix(loaded, size, opts.config, matrix);
+
+            for (int c = 0; c < combinations; c++) {
+                const PolicyMatrixResult& m = matrix[c];
+                if (!m.verified) status = 1;
+                const BenchmarkResult* sides[4] = {&m.load, &m.find, &m.churn, &m.sort};
+                const char* sideOps[4] = {"policy-load", "policy-find", "policy-churn", "policy-sort"};
+                for (int side = 0; side < 4; side++) {
+                    BenchRecord& rec = records[recordCount++];
+                    rec.layout = opts.layout.getName();
+                    rec.structure = m.name;
+                    rec.operation = sideOps[side];
+                    rec.size = size;
+                    rec.result = *sides[side];
+                    rec.heapBytes = m.heapBytes;
+                }
+
+                std::cout << std::left << std::setw(27) << m.name
+                          << std::right << std::setw(9) << size
+                          << "  load " << std::setw(8) << m.load.medianNs << " ns/rec"
+                          << "  find " << std::setw(10) << m.find.medianNs << " ns"
+                          << "  churn " << std::setw(10) << m.churn.medianNs << " ns"
+                          << "  sort " << std::setw(9) << m.sort.medianNs / 1e6 << " ms"
+                          << "  heap " << (m.heapBytes / 1024) << " KB"
+                          << (m.verified ? "" : "  VERIFICATION FAILED") << "\n";
+            }
+        }
+        delete[] matrix;
+    }
+
+    // Heap operations per reservation, cancellation and sort. The timings come
+    // from the same samples; the goal is zero allocations per reservation.
+    for (int o = 0; o < opts.opCount; o++) {
+        if (opts.ops[o] != "alloc") continue;
+        for (int s = 0; s < opts.sizeCount; s++) {
+            int size = opts.sizes[s] < loadedCount ? opts.sizes[s] : loadedCount;
+            for (int k = 0; k < opts.structureCount; k++) {
+                bool isArray = opts.structures[k] == "array";
+                if (!isArray && opts.structures[k] != "list") continue;
+
+                const char* sideOps[3] = {"alloc-reserve", "alloc-cancel", "alloc-sort"};
+                HeapOpResult sides[3];
+                bool ran[3];
+                ran[0] = isArray
+                    ? countReserveHeapOps<ArrayReservation>(opts.layout, loaded, size, opts.config, sides[0])
+                    : countReserveHeapOps<LinkedListReservation>(opts.layout, loaded, size, opts.config, sides[0]);
+                ran[1] = countCancelHeapOps(isArray, loaded, size, opts.config, sides[1]);
+                ran[2] = countSortHeapOps(isArray, loaded, size, opts.config, sides[2]);
+
+                for (int side = 0; side < 3; side++) {
+                    if (!ran[side]) continue;
+                    BenchRecord& rec = records[recordCount++];
+                    rec.layout = opts.layout.getName();
+                    rec.structure = opts.structures[k];
+                    rec.operation = sideOps[side];
+                    rec.size = size;
+                    rec.result = sides[side].timing;
+                    rec.allocsPerOp = sides[side].allocsPerOp;
+                    rec.freesPerOp = sides[side].freesPerOp;
+
+                    std::cout << std::left << std::setw(11) << rec.structure
+                              << std::setw(14) << rec.operation
+                              << std::right << std::setw(9) << size
+                              << "  median " << std::setw(12) << rec.result.medianNs << " ns/op"
+                              << std::setprecision(3)
+                              << "  allocs/op " << std::setw(9) << rec.allocsPerOp
+                              << "  frees/op " << std::setw(9) << rec.freesPerOp
+                              << std::setprecision(1) << "\n";
+                }
+            }
+        }
+    }
+
+    // Group commit: durable reservations per second and fsyncs issued, per
+    // commit window and thread count. Sized by window; threads recorded separately.
+    for (int o = 0; o < opts.opCount; o++) {
+        if (opts.ops[o] != "wal-commit" || opts.walOps <= 0) continue;
+        for (int w = 0; w < opts.commitWindowCount; w++) {
+            for (int t = 0; t < opts.threadCount; t++) {
+                WalCommitResult wal = runWalCommitBenchmark(opts.walPath, opts.threads[t], opts.walOps,
+                                                            opts.commitWindows[w]);
+                if (wal.operations == 0) {
+                    std::cerr << "Error: could not write " << opts.walPath << "\n";
+                    status = 1;
+                    continue;
+                }
+
+                BenchRecord& rec = records[recordCount++];
+                rec.layout = opts.layout.getName();
+                rec.structure = "wal";
+                rec.operation = opts.ops[o];
+                rec.size = opts.commitWindows[w];
+                rec.threads = opts.threads[t];
+                rec.result = wal.commitLatency;
+
+                std::cout << std::left << std::setw(11) << rec.structure
+                          << std::setw(14) << rec.operation
+                          << std::right << std::setw(7) << rec.size << "us"
+                          << "  threads " << std::setw(2) << rec.threads
+                          << "  p50 " << std::setw(10) << rec.result.medianNs << " ns"
+                          << "  p99 " << std::setw(10) << rec.result.p99Ns << " ns"
+                          << "  " << std::setprecision(0) << wal.opsPerSecond << " ops/s"
+                          << "  " << wal.syncs << " fsyncs" << std::setprecision(1)
+                          << "  " << (wal.syncs > 0 ? (double)wal.operations / wal.syncs : 0.0) << " ops/fsync\n";
+            }
+        }
+    }
+
+    if (!opts.jsonPath.empty()) {
+        if (writeJSON(opts.jsonPath, opts, records, recordCount)) {
+            std::cout << "JSON written to " << opts.jsonPath << "\n";
+        } else {
+            std::cerr << "Error: could not write " << opts.jsonPath << "\n";
+            status = 1;
+        }
+    }
+    if (!opts.csvPath.empty()) {
+        if (writeCSV(opts.csvPath, opts, records, recordCount)) {
+            std::cout << "CSV written to " << opts.csvPath << "\n";
+        } else {
+            std::cerr << "Error: could not write " << opts.csvPath << "\n";
+            status = 1;
+        }
+    }
+
+    delete[] records;
+    delete[] loaded;
+    return status;
+}
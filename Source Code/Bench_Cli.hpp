@@ -0,0 +1,44 @@
+#ifndef BENCH_CLI_HPP
+#define BENCH_CLI_HPP
+
+// Non-interactive benchmark mode: `<program> --bench [options]`.
+// Runs the selected operations on each structure and dataset size without
+// prompting and writes the results as JSON and/or CSV.
+//
+// Options:
+//   --dataset PATH        CSV or .bin file to load (default Updated_Passenger_List.csv)
+//   --layout SPEC         aircraft: default, narrow, wide or a seat-map file
+//   --ops LIST            comma list of: search,binary,sort,chart,manifest,display,
+//                         reserve,reserve-fixed (fixed-geometry instantiation),
+//                         fleet-book,fleet-search (multi-flight FleetStore),
+//                         reserve-mt (concurrent booking, verified for double-booking),
+//                         mixed (concurrent searches + bookings, snapshot vs mutex store),
+//                         batch-search,batch-binary (batch lookups on a work-stealing pool),
+//                         group-lookup (per-key vs prefetched/interleaved group lookups),
+//                         wal-commit (durable reservations through the write-ahead log),
+//                         policy-matrix (every PassengerSystem storage x index x sort combination),
+//                         alloc (heap allocations/frees per reservation, cancellation and sort)
+//   --structures LIST     comma list of: array,list,hash
+//   --sizes LIST          comma list of record counts (default: whole dataset)
+//   --flights LIST        fleet sizes for fleet-* ops (default 1,10,100,1000,10000)
+//   --fleet-load N        passengers booked per flight before timing (default half the seats)
+//   --threads LIST        thread counts for reserve-mt, mixed, batch-* and wal-commit (default 1,2,4,8)
+//   --groups LIST         keys per call for group-lookup (default 8,16,32,64)
+//   --batch N             IDs per batch-* lookup call (default 4096)
+//   --read-pct N          searches as a percentage of mixed operations (default 95)
+//   --mixed-ops N         operations per thread for mixed (default 20000)
+//   --commit-windows LIST group commit windows in microseconds (default 0,100,1000)
+//   --wal-ops N           committed operations per wal-commit run (default 2000)
+//   --wal-path PATH       scratch log file for wal-commit (default bench.wal)
+//   --reps N              timed samples per benchmark (default 31)
+//   --warmup N            untimed warmup runs (default 3)
+//   --min-sample-ns N     calibration target per sample (default 100000)
+//   --label TEXT          build/run label stored with every result
+//   --json PATH           write results as JSON
+//   --csv PATH            write results as CSV
+// Returns a process exit code (0 on success).
+int runBenchCli(int argc, char** argv);
+
+void printBenchUsage();
+
+#endif
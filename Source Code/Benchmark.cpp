@@ -0,0 +1,54 @@
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+// Nearest-rank percentile on an ascending array
+static double percentile(const double* sorted, int count, double pct) {
+    if (count <= 0) return 0.0;
+    int rank = (int)std::ceil(pct / 100.0 * count);
+    if (rank < 1) rank = 1;
+    if (rank > count) rank = count;
+    return sorted[rank - 1];
+}
+
+BenchmarkResult summarizeSamples(double* perOpNs, int count, long iterations) {
+    BenchmarkResult r;
+    if (count <= 0) return r;
+
+    std::sort(perOpNs, perOpNs + count);
+
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) sum += perOpNs[i];
+    double mean = sum / count;
+
+    double sq = 0.0;
+    for (int i = 0; i < count; i++) sq += (perOpNs[i] - mean) * (perOpNs[i] - mean);
+
+    r.minNs = perOpNs[0];
+    r.medianNs = (count % 2) ? perOpNs[count / 2]
+                             : (perOpNs[count / 2 - 1] + perOpNs[count / 2]) / 2.0;
+    r.p90Ns = percentile(perOpNs, count, 90.0);
+    r.p99Ns = percentile(perOpNs, count, 99.0);
+    r.p999Ns = percentile(perOpNs, count, 99.9);
+    r.meanNs = mean;
+    r.stddevNs = count > 1 ? std::sqrt(sq / (count - 1)) : 0.0;
+    r.iterations = iterations;
+    r.samples = count;
+    return r;
+}
+
+void printBenchmarkResult(std::ostream& out, const std::string& label, const BenchmarkResult& r) {
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    out << label << ": median " << std::fixed << std::setprecision(1) << r.medianNs << " ns"
+        << " (min " << r.minNs
+        << ", p90 " << r.p90Ns
+        << ", p99 " << r.p99Ns
+        << ", mean " << r.meanNs << " +/- " << r.stddevNs
+        << ", " << r.samples << " x " << r.iterations << " ops)\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
@@ -0,0 +1,175 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include "PerfCounters.hpp"
+
+// ==================== COMPILER BARRIERS ====================
+
+// Forces the compiler to materialize `value`, so a computation whose result
+// is otherwise unused cannot be deleted by the optimizer
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// Prevents the compiler from caching memory across the barrier
+inline void clobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+// Output stream that discards what it is given. Formatting still runs, so
+// output code can be timed end to end without terminal or file I/O.
+class NullStream : public std::ostream {
+private:
+    struct Discard : public std::streambuf {
+        int overflow(int c) override { return traits_type::not_eof(c); }
+        std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+    };
+    Discard discard;
+
+public:
+    NullStream() : std::ostream(nullptr) { rdbuf(&discard); }
+};
+
+// ==================== CONFIGURATION & RESULTS ====================
+
+struct BenchmarkConfig {
+    int warmupRuns;        // untimed calls before calibration
+    int samples;           // timed repetitions used for the statistics
+    double minSampleNs;    // calibrate iterations until one sample lasts this long
+    long maxIterations;    // calibration upper bound per sample
+    bool collectCounters;  // record hardware counters over the timed samples
+
+    BenchmarkConfig(int warmup = 3, int reps = 31, double minNs = 100000.0, long maxIter = 1L << 20,
+                    bool counters = false)
+        : warmupRuns(warmup), samples(reps), minSampleNs(minNs), maxIterations(maxIter),
+          collectCounters(counters) {}
+};
+
+// All times are nanoseconds per single operation
+struct BenchmarkResult {
+    double minNs;
+    double medianNs;
+    double p90Ns;
+    double p99Ns;
+    double p999Ns;
+    double meanNs;
+    double stddevNs;
+    long iterations;   // operations per sample after calibration
+    int samples;
+    PerfCounterValues counters;  // per operation; all invalid unless collected
+
+    BenchmarkResult()
+        : minNs(0), medianNs(0), p90Ns(0), p99Ns(0), p999Ns(0), meanNs(0), stddevNs(0),
+          iterations(0), samples(0) {}
+};
+
+// Sorts `perOpNs` in place and fills in the summary statistics
+BenchmarkResult summarizeSamples(double* perOpNs, int count, long iterations);
+
+// "median 1234.5 ns (min ..., p90 ..., p99 ..., mean ... +/- ...)"
+void printBenchmarkResult(std::ostream& out, const std::string& label, const BenchmarkResult& r);
+
+inline double elapsedNs(const std::chrono::steady_clock::time_point& a,
+                        const std::chrono::steady_clock::time_point& b) {
+    return std::chrono::duration<double, std::nano>(b - a).count();
+}
+
+// ==================== HARNESS ====================
+
+// Repeatable operations: warmup, auto-calibrated iteration count, then
+// `samples` timed batches. `fn` must be callable repeatedly without setup.
+template <typename Fn>
+BenchmarkResult runBenchmark(Fn fn, const BenchmarkConfig& config = BenchmarkConfig()) {
+    for (int i = 0; i < config.warmupRuns; i++) {
+        fn();
+        clobberMemory();
+    }
+
+    // Double the batch size until one batch is long enough to time reliably
+    long iterations = 1;
+    while (iterations < config.maxIterations) {
+        auto start = std::chrono::steady_clock::now();
+        for (long i = 0; i < iterations; i++) {
+            fn();
+            clobberMemory();
+        }
+        auto end = std::chrono::steady_clock::now();
+        if (elapsedNs(start, end) >= config.minSampleNs) break;
+        iterations *= 2;
+    }
+
+    PerfCounterSet counters;
+    if (config.collectCounters) counters.open();
+
+    int samples = config.samples > 0 ? config.samples : 1;
+    double* perOpNs = new double[samples];
+    for (int s = 0; s < samples; s++) {
+        counters.start();
+        auto start = std::chrono::steady_clock::now();
+        for (long i = 0; i < iterations; i++) {
+            fn();
+            clobberMemory();
+        }
+        auto end = std::chrono::steady_clock::now();
+        counters.stop();
+        perOpNs[s] = elapsedNs(start, end) / iterations;
+    }
+
+    BenchmarkResult result = summarizeSamples(perOpNs, samples, iterations);
+    result.counters = counters.read((double)samples * iterations);
+    delete[] perOpNs;
+    return result;
+}
+
+// Mutating operations (reserve, cancel): `setup` restores state untimed
+// before every sample and `fn` runs exactly once per sample. `opsPerCall`
+// converts the sample time to per-operation time when `fn` is a batch.
+template <typename Setup, typename Fn>
+BenchmarkResult runBenchmarkWithSetup(Setup setup, Fn fn, long opsPerCall = 1,
+                                      const BenchmarkConfig& config = BenchmarkConfig()) {
+    if (opsPerCall < 1) opsPerCall = 1;
+
+    for (int i = 0; i < config.warmupRuns; i++) {
+        setup();
+        fn();
+        clobberMemory();
+    }
+
+    PerfCounterSet counters;
+    if (config.collectCounters) counters.open();
+
+    int samples = config.samples > 0 ? config.samples : 1;
+    double* perOpNs = new double[samples];
+    for (int s = 0; s < samples; s++) {
+        setup();
+        clobberMemory();
+        counters.start();  // setup stays outside the counted region
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        clobberMemory();
+        auto end = std::chrono::steady_clock::now();
+        counters.stop();
+        perOpNs[s] = elapsedNs(start, end) / opsPerCall;
+    }
+
+    BenchmarkResult result = summarizeSamples(perOpNs, samples, opsPerCall);
+    result.counters = counters.read((double)samples * opsPerCall);
+    delete[] perOpNs;
+    return result;
+}
+
+#endif
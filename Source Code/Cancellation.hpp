@@ -1,294 +1,174 @@
-#ifndef CANCELLATION_HPP
-#define CANCELLATION_HPP
-#include "Passenger.hpp"
-#include <iostream>
-#include <fstream>
-#include <sstream>
-#include <string>
-
-/*
-=======================================
-        ARRAY CANCELLATION
-=======================================
-*/
-
-class ArrayCancellation {
-private:
-    Passenger* arr;
-    int size;
-    int capacity;
-
-public:
-    ArrayCancellation(int cap) {
-        capacity = cap;
-        size = 0;
-        arr = new Passenger[capacity];
-    }
-
-    ~ArrayCancellation() {
-        delete[] arr;
-    }
-
-    void loadFromFile(const char* filename) {
-        std::ifstream file(filename);
-        std::string line;
-        std::getline(file, line); 
-
-        while (std::getline(file, line)) {
-            Passenger p;
-            std::string token;
-            std::stringstream ss(line);
-
-            std::getline(ss, p.passengerID, ',');
-            std::getline(ss, p.name, ',');
-            
-            std::getline(ss, token, ','); 
-            p.seatRow = std::stoi(token);
-            
-            std::getline(ss, token, ','); 
-            p.seatColumn = token[0];
-            
-            std::getline(ss, p.seatClass, ',');
-
-            p.passengerID.erase(0, p.passengerID.find_first_not_of(" \t"));
-            p.passengerID.erase(p.passengerID.find_last_not_of(" \t") + 1);
-            
-            p.name.erase(0, p.name.find_first_not_of(" \t"));
-            p.name.erase(p.name.find_last_not_of(" \t") + 1);
-            
-            p.seatClass.erase(0, p.seatClass.find_first_not_of(" \t"));
-            p.seatClass.erase(p.seatClass.find_last_not_of(" \t") + 1);
-            
-            // Check for empty seat
-            p.isEmpty = (p.passengerID == "Empty" || p.passengerID == "EMPTY");
-
-            if (size < capacity) {
-                arr[size++] = p;
-            }
-        }
-        file.close();
-    }
-
-    int linearSearch(const std::string& id) {
-        for (int i = 0; i < size; i++) {
-            if (arr[i].passengerID == id && !arr[i].isEmpty) {
-                return i;
-            }
-        }
-        return -1;
-    }
-
-    int binarySearch(const std::string& id) {
-        int low = 0, high = size - 1;
-        while (low <= high) {
-            int mid = (low + high) / 2;
-            if (arr[mid].passengerID == id && !arr[mid].isEmpty) return mid;
-            else if (id < arr[mid].passengerID) high = mid - 1;
-            else low = mid + 1;
-        }
-        return -1;
-    }
-
-    bool cancelByLinear(const std::string& id) {
-        int index = linearSearch(id);
-        if (index == -1) return false;
-
-        for (int i = index; i < size - 1; i++)
-            arr[i] = arr[i + 1];
-
-        size--;
-        return true;
-    }
-
-    bool cancelByBinary(const std::string& id) {
-        int index = binarySearch(id);
-        if (index == -1) return false;
-
-        for (int i = index; i < size - 1; i++)
-            arr[i] = arr[i + 1];
-
-        size--;
-        return true;
-    }
-
-    void sortByID() {
-        for (int i = 0; i < size - 1; i++) {
-            for (int j = 0; j < size - i - 1; j++) {
-                if (arr[j].passengerID > arr[j + 1].passengerID) {
-                    Passenger temp = arr[j];
-                    arr[j] = arr[j + 1];
-                    arr[j + 1] = temp;
-                }
-            }
-        }
-    }
-
-    int getSize() const {
-        return size;
-    }
-    
-    int getCapacity() const {
-        return capacity;
-    }
-    
-    // Helper to get array for iteration
-    const Passenger* getArray() const {
-        return arr;
-    }
-};
-
-/*
-=======================================
-       LINKED LIST CANCELLATION
-=======================================
-*/
-
-class LinkedListCancellation {
-private:
-    SimpleNode* head;
-
-public:
-    LinkedListCancellation() {
-        head = nullptr;
-    }
-    
-    ~LinkedListCancellation() {
-        SimpleNode* current = head;
-        while (current != nullptr) {
-            SimpleNode* next = current->next;
-            delete current;
-            current = next;
-        }
-    }
-
-    void loadFromFile(const char* filename) {
-        std::ifstream file(filename);
-        std::string line;
-        std::getline(file, line); 
-
-        while (std::getline(file, line)) {
-            Passenger p;
-            std::string token;
-            std::stringstream ss(line);
-
-            std::getline(ss, p.passengerID, ',');
-            std::getline(ss, p.name, ',');
-            
-            std::getline(ss, token, ','); 
-            p.seatRow = std::stoi(token);
-            
-            std::getline(ss, token, ','); 
-            p.seatColumn = token[0];
-            
-            std::getline(ss, p.seatClass, ',');
-            
-            p.passengerID.erase(0, p.passengerID.find_first_not_of(" \t"));
-            p.passengerID.erase(p.passengerID.find_last_not_of(" \t") + 1);
-            
-            p.name.erase(0, p.name.find_first_not_of(" \t"));
-            p.name.erase(p.name.find_last_not_of(" \t") + 1);
-            
-            p.seatClass.erase(0, p.seatClass.find_first_not_of(" \t"));
-            p.seatClass.erase(p.seatClass.find_last_not_of(" \t") + 1);
-            
-            // Check for empty seat
-            p.isEmpty = (p.passengerID == "Empty" || p.passengerID == "EMPTY");
-
-            SimpleNode* newNode = new SimpleNode(p, head);
-            head = newNode;
-        }
-        file.close();
-    }
-
-    SimpleNode* linearSearch(const std::string& id) {
-        SimpleNode* temp = head;
-        while (temp != nullptr) {
-            if (temp->data.passengerID == id && !temp->data.isEmpty)
-                return temp;
-            temp = temp->next;
-        }
-        return nullptr;
-    }
-
-    SimpleNode* sentinelSearch(const std::string& id) {
-        if (head == nullptr) return nullptr;
-
-        Passenger sentinelPassenger;
-        sentinelPassenger.passengerID = id;
-        sentinelPassenger.name = "";
-        sentinelPassenger.seatRow = 0;
-        sentinelPassenger.seatColumn = 'A';
-        sentinelPassenger.seatClass = "";
-        sentinelPassenger.isEmpty = false;
-        
-        SimpleNode* sentinel = new SimpleNode(sentinelPassenger, nullptr);
-
-        SimpleNode* last = head;
-        while (last->next != nullptr) {
-            last = last->next;
-        }
-
-        last->next = sentinel;
-
-        SimpleNode* current = head;
-        while (current->data.passengerID != id && !current->data.isEmpty) {
-            current = current->next;
-        }
-
-        last->next = nullptr;
-        
-        SimpleNode* result = nullptr;
-        if (current != sentinel) {
-            result = current;
-        }
-        
-        delete sentinel;
-        return result;
-    }
-
-    bool cancelByLinear(const std::string& id) {
-        SimpleNode* temp = head;
-        SimpleNode* prev = nullptr;
-
-        while (temp != nullptr && (temp->data.passengerID != id || temp->data.isEmpty)) {
-            prev = temp;
-            temp = temp->next;
-        }
-
-        if (temp == nullptr) return false;
-
-        if (prev == nullptr)
-            head = temp->next;
-        else
-            prev->next = temp->next;
-
-        delete temp;
-        return true;
-    }
-
-    bool cancelBySentinel(const std::string& id) {
-        SimpleNode* nodeToDelete = sentinelSearch(id);
-        if (nodeToDelete == nullptr) return false;
-        
-        return cancelByLinear(id);
-    }
-
-    int getSize() const {
-        int count = 0;
-        SimpleNode* temp = head;
-        while (temp != nullptr) {
-            if (!temp->data.isEmpty) {
-                count++;
-            }
-            temp = temp->next;
-        }
-        return count;
-    }
-    
-    // Helper to get head for iteration
-    SimpleNode* getHead() const {
-        return head;
-    }
-};
-
-#endif
\ No newline at end of file
+#ifndef CANCELLATION_HPP
+#define CANCELLATION_HPP
+#include "Passenger.hpp"
+#include "PassengerSystem.hpp"
+#include "HeapTracker.hpp"
+#include "Trace.hpp"
+#include <string>
+#include <type_traits>
+
+/*
+=======================================
+        CANCELLATION SYSTEM
+=======================================
+*/
+
+// Cancellation on top of PassengerSystem. Records are loaded as they are,
+// empty seats included. Cancelling removes the first occupied record with
+// the ID and keeps the rest in order, so a sorted system stays sorted:
+// contiguous storage shifts the later records down, lists unlink the node.
+template <class Storage, class Sort>
+class CancellationSystem : public PassengerSystem<Storage, NoIndex, Sort> {
+private:
+    int capacity;   // record limit, 0 = none
+
+    static void ignoreMove(Passenger*, Passenger*) {}
+
+    void removeInOrder(Passenger* p, std::true_type) {
+        int last = this->size() - 1;
+        for (int i = (int)(p - &this->storage.at(0)); i < last; i++)
+            this->storage.at(i) = std::move(this->storage.at(i + 1));
+        this->storage.remove(&this->storage.at(last), ignoreMove);
+    }
+
+    void removeInOrder(Passenger* p, std::false_type) {
+        this->storage.remove(p, ignoreMove);
+    }
+
+    // Contiguous storage is overwritten in place, so the records and their
+    // buffers stay where they were
+    void refill(const CancellationSystem& source, std::true_type) {
+        HeapScope scope(this->heap);
+        while (this->size() > source.size())
+            this->storage.remove(&this->storage.at(this->size() - 1), ignoreMove);
+        int kept = this->size();
+        for (int i = 0; i < kept; i++)
+            this->storage.at(i) = source.storage.at(i);
+        this->reserve(capacity > source.size() ? capacity : source.size());
+        for (int i = kept; i < source.size(); i++)
+            this->storage.append(source.storage.at(i), ignoreMove);
+    }
+
+    void refill(const CancellationSystem& source, std::false_type) {
+        this->clear();
+        source.forEach([&](const Passenger& p) { this->add(p); });
+    }
+
+    // Contiguous: find, then shift. Linked: unlink during the same walk.
+    bool cancelFirst(const std::string& id, std::true_type) {
+        return cancel(linearSearch(id));
+    }
+
+    bool cancelFirst(const std::string& id, std::false_type) {
+        HeapScope scope(this->heap);
+        return this->storage.removeFirst([&](const Passenger& p) {
+            return p.passengerID == id && !p.isEmpty;
+        });
+    }
+
+public:
+    explicit CancellationSystem(int cap = 0) : capacity(cap) {
+        if (capacity > 0) this->reserve(capacity);
+    }
+
+    // Stops at the capacity, if there is one
+    void loadFromArray(const Passenger* passengers, int count) {
+        if (capacity > 0 && count > capacity - this->size()) count = capacity - this->size();
+        PassengerSystem<Storage, NoIndex, Sort>::loadFromArray(passengers, count);
+    }
+
+    // Restores this system to the contents of `source`, in the same order
+    // (used to reset benchmarks)
+    void copyFrom(const CancellationSystem& source) {
+        refill(source, std::integral_constant<bool, Storage::RANDOM_ACCESS>());
+        this->sorted = source.sorted;
+    }
+
+    Passenger* linearSearch(const std::string& id) const {
+        TRACE_SPAN("search", "CancellationSystem::linearSearch");
+        for (auto it = this->storage.begin(); it != this->storage.end(); ++it) {
+            if (it->passengerID == id && !it->isEmpty) return &*it;
+        }
+        return nullptr;
+    }
+
+    // O(log n) over records sorted by sortByID(); random-access storage only
+    Passenger* binarySearch(const std::string& id) const {
+        static_assert(Storage::RANDOM_ACCESS, "binary search needs random-access storage");
+        TRACE_SPAN("search", "CancellationSystem::binarySearch");
+        int low = 0, high = this->size() - 1;
+        while (low <= high) {
+            int mid = low + (high - low) / 2;
+            Passenger& p = this->storage.at(mid);
+            if (p.passengerID == id) return p.isEmpty ? nullptr : &p;
+            if (id < p.passengerID) high = mid - 1;
+            else low = mid + 1;
+        }
+        return nullptr;
+    }
+
+    // `p` must be a record of this system
+    bool cancel(Passenger* p) {
+        if (!p) return false;
+        HeapScope scope(this->heap);
+        removeInOrder(p, std::integral_constant<bool, Storage::RANDOM_ACCESS>());
+        return true;
+    }
+
+    bool cancelByLinear(const std::string& id) {
+        TRACE_SPAN("cancel", "CancellationSystem::cancelByLinear");
+        return cancelFirst(id, std::integral_constant<bool, Storage::RANDOM_ACCESS>());
+    }
+
+    int getSize() const { return this->size(); }
+    int getCapacity() const { return capacity; }
+    HeapStats heapStats() const { return this->heap.stats(); }
+};
+
+/*
+=======================================
+        ARRAY CANCELLATION
+=======================================
+*/
+
+// Contiguous storage sorted by merge sort, so binary search can find the record
+class ArrayCancellation : public CancellationSystem<ArrayStorage, MergeSort> {
+public:
+    explicit ArrayCancellation(int cap) : CancellationSystem<ArrayStorage, MergeSort>(cap) {}
+
+    bool cancelByBinary(const std::string& id) {
+        TRACE_SPAN("cancel", "ArrayCancellation::cancelByBinary");
+        return cancel(binarySearch(id));
+    }
+};
+
+/*
+=======================================
+       LINKED LIST CANCELLATION
+=======================================
+*/
+
+// Singly linked list whose extra technique is the sentinel search
+class LinkedListCancellation : public CancellationSystem<ListStorage, MergeSort> {
+private:
+    SimpleNode sentinel;   // reused by every sentinel search; its ID buffer is kept
+
+public:
+    LinkedListCancellation() : sentinel(Passenger()) {}
+
+    Passenger* sentinelSearch(const std::string& id) {
+        TRACE_SPAN("search", "LinkedListCancellation::sentinelSearch");
+        {
+            HeapScope scope(heap);  // a long ID grows the sentinel's buffer once
+            sentinel.data.passengerID = id;
+        }
+        return storage.findWithSentinel(sentinel);
+    }
+
+    bool cancelBySentinel(const std::string& id) {
+        TRACE_SPAN("cancel", "LinkedListCancellation::cancelBySentinel");
+        return cancel(sentinelSearch(id));
+    }
+};
+
+#endif
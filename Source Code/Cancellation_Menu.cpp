@@ -6,8 +6,19 @@
 using namespace std;
 using namespace chrono;
 
-void showCancellationMenu(const char* file) {
+// Each sample restores the loaded data (untimed) and times one cancellation
+static const BenchmarkConfig cancelConfig(1, 25);
+
+// Commits a cancellation that the benchmarks above found; returns the status line
+static string persistCancellation(ReservationJournal* journal, const string& id) {
+    if (!journal) return "";
+    if (journal->recordCancellation(id)) return "Saved: committed to " + journal->getLogPath() + "\n";
+    return "WARNING: cancellation not saved\n";
+}
+
+void showCancellationMenu(const Passenger* passengers, int passengerCount, ReservationJournal* journal) {
     int cancelChoice;
+    int capacity = passengerCount > 10400 ? passengerCount : 10400;
 
     do {
         cout << "\n==================\n";
@@ -32,72 +43,74 @@ void showCancellationMenu(const char* file) {
 
         switch (cancelChoice) {
         case 1: {
+            TRACE_SPAN("menu", "Cancellation: array");
             string id;
             cout << "\nEnter Passenger ID to cancel: ";
             getline(cin, id); // Use getline for strings
 
-            ArrayCancellation arrLinear(10400);
-            arrLinear.loadFromFile(file);
-            arrLinear.sortByID();
+            // Load and sort once; both techniques cancel from a copy of this
+            ArrayCancellation arrLoaded(capacity);
+            arrLoaded.loadFromArray(passengers, passengerCount);
+            arrLoaded.sortByID();
 
-            size_t memArrayLin = arrLinear.getCapacity() * sizeof(Passenger);
+            ArrayCancellation arrLinear(capacity);
+            size_t memArrayLin = arrLoaded.heapStats().footprintBytes;
 
-            auto start = high_resolution_clock::now();
-            bool linearSuccess = arrLinear.cancelByLinear(id);
-            auto end = high_resolution_clock::now();
+            bool linearSuccess = false;
+            BenchmarkResult linearTime = runBenchmarkWithSetup(
+                [&]() { arrLinear.copyFrom(arrLoaded); },
+                [&]() { linearSuccess = arrLinear.cancelByLinear(id); },
+                1, cancelConfig);
 
             cout << "\n[ARRAY - LINEAR SEARCH]\n";
-            cout << "Time: "
-                << duration_cast<microseconds>(end - start).count()
-                << " microseconds\n";
+            printBenchmarkResult(cout, "Time", linearTime);
             cout << "Memory: "
                 << memArrayLin << " bytes ("
                 << memArrayLin / 1024.0 << " KB)\n";
             cout << "Result: "
                 << (linearSuccess ? "Found & Canceled" : "Not Found") << endl;
 
-            ArrayCancellation arrBinary(10400);
-            arrBinary.loadFromFile(file);
-            arrBinary.sortByID();
-
-            size_t memArrayBin = arrBinary.getCapacity() * sizeof(Passenger);
+            ArrayCancellation arrBinary(capacity);
+            size_t memArrayBin = arrLoaded.heapStats().footprintBytes;
 
-            start = high_resolution_clock::now();
-            bool binarySuccess = arrBinary.cancelByBinary(id);
-            end = high_resolution_clock::now();
+            bool binarySuccess = false;
+            BenchmarkResult binaryTime = runBenchmarkWithSetup(
+                [&]() { arrBinary.copyFrom(arrLoaded); },
+                [&]() { binarySuccess = arrBinary.cancelByBinary(id); },
+                1, cancelConfig);
 
             cout << "\n[ARRAY - BINARY SEARCH]\n";
-            cout << "Time: "
-                << duration_cast<microseconds>(end - start).count()
-                << " microseconds\n";
+            printBenchmarkResult(cout, "Time", binaryTime);
             cout << "Memory: "
                 << memArrayBin << " bytes ("
                 << memArrayBin / 1024.0 << " KB)\n";
             cout << "Result: "
                 << (binarySuccess ? "Found & Canceled" : "Not Found") << endl;
+            if (linearSuccess || binarySuccess) cout << persistCancellation(journal, id);
 
             break;
         }
 
         case 2: {
+            TRACE_SPAN("menu", "Cancellation: linked list");
             string id;
             cout << "\nEnter Passenger ID to cancel: ";
             getline(cin, id); // Use getline for strings
 
-            LinkedListCancellation llLinear;
-            llLinear.loadFromFile(file);
+            LinkedListCancellation llLoaded;
+            llLoaded.loadFromArray(passengers, passengerCount);
 
-            int n3 = llLinear.getSize();
-            size_t memListLin = n3 * (sizeof(SimpleNode) + sizeof(Passenger));
+            LinkedListCancellation llLinear;
+            size_t memListLin = llLoaded.heapStats().footprintBytes;
 
-            auto start = high_resolution_clock::now();
-            bool llLinearSuccess = llLinear.cancelByLinear(id);
-            auto end = high_resolution_clock::now();
+            bool llLinearSuccess = false;
+            BenchmarkResult llLinearTime = runBenchmarkWithSetup(
+                [&]() { llLinear.copyFrom(llLoaded); },
+                [&]() { llLinearSuccess = llLinear.cancelByLinear(id); },
+                1, cancelConfig);
 
             cout << "\n[LINKED LIST - LINEAR SEARCH]\n";
-            cout << "Time: "
-                << duration_cast<microseconds>(end - start).count()
-                << " microseconds\n";
+            printBenchmarkResult(cout, "Time", llLinearTime);
             cout << "Memory: "
                 << memListLin << " bytes ("
                 << memListLin / 1024.0 << " KB)\n";
@@ -105,68 +118,71 @@ void showCancellationMenu(const char* file) {
                 << (llLinearSuccess ? "Found & Canceled" : "Not Found") << endl;
 
             LinkedListCancellation llSentinel;
-            llSentinel.loadFromFile(file);
+            size_t memListSen = llLoaded.heapStats().footprintBytes;
 
-            int n4 = llSentinel.getSize();
-            size_t memListSen = n4 * (sizeof(SimpleNode) + sizeof(Passenger));
-
-            start = high_resolution_clock::now();
-            bool llSentinelSuccess = llSentinel.cancelBySentinel(id);
-            end = high_resolution_clock::now();
+            bool llSentinelSuccess = false;
+            BenchmarkResult llSentinelTime = runBenchmarkWithSetup(
+                [&]() { llSentinel.copyFrom(llLoaded); },
+                [&]() { llSentinelSuccess = llSentinel.cancelBySentinel(id); },
+                1, cancelConfig);
 
             cout << "\n[LINKED LIST - SENTINEL SEARCH]\n";
-            cout << "Time: "
-                << duration_cast<microseconds>(end - start).count()
-                << " microseconds\n";
+            printBenchmarkResult(cout, "Time", llSentinelTime);
             cout << "Memory: "
                 << memListSen << " bytes ("
                 << memListSen / 1024.0 << " KB)\n";
             cout << "Result: "
                 << (llSentinelSuccess ? "Found & Canceled" : "Not Found") << endl;
+            if (llLinearSuccess || llSentinelSuccess) cout << persistCancellation(journal, id);
 
             break;
         }
 
         case 3: {
+            TRACE_SPAN("menu", "Cancellation: comparison table");
             string id;
             cout << "\nEnter Passenger ID to test: ";
             getline(cin, id); // Use getline for strings
 
-            ArrayCancellation arrTest(10400);
-            arrTest.loadFromFile(file);
-
-            size_t memArr = arrTest.getCapacity() * sizeof(Passenger);
+            ArrayCancellation arrLoaded(capacity);
+            arrLoaded.loadFromArray(passengers, passengerCount);
+            ArrayCancellation arrTest(capacity);
 
-            auto start = high_resolution_clock::now();
-            bool arrResult = arrTest.cancelByLinear(id);
-            auto end = high_resolution_clock::now();
+            size_t memArr = arrLoaded.heapStats().footprintBytes;
 
-            auto arrTime = duration_cast<microseconds>(end - start).count();
+            bool arrResult = false;
+            BenchmarkResult arrTime = runBenchmarkWithSetup(
+                [&]() { arrTest.copyFrom(arrLoaded); },
+                [&]() { arrResult = arrTest.cancelByLinear(id); },
+                1, cancelConfig);
 
+            LinkedListCancellation llLoaded;
+            llLoaded.loadFromArray(passengers, passengerCount);
             LinkedListCancellation llTest;
-            llTest.loadFromFile(file);
-
-            int nList = llTest.getSize();
-            size_t memList = nList * (sizeof(SimpleNode) + sizeof(Passenger));
-
-            start = high_resolution_clock::now();
-            bool llResult = llTest.cancelByLinear(id);
-            end = high_resolution_clock::now();
-
-            auto llTime = duration_cast<microseconds>(end - start).count();
 
-            cout << "\n========================================\n";
-            cout << "   LINEAR SEARCH PERFORMANCE COMPARISON\n";
-            cout << "========================================\n";
-            cout << "Structure      Time (us)     Memory (KB)\n";
-            cout << "----------------------------------------\n";
-            cout << "Array           "
-                << arrTime << "           "
+            size_t memList = llLoaded.heapStats().footprintBytes;
+
+            bool llResult = false;
+            BenchmarkResult llTime = runBenchmarkWithSetup(
+                [&]() { llTest.copyFrom(llLoaded); },
+                [&]() { llResult = llTest.cancelByLinear(id); },
+                1, cancelConfig);
+
+            cout << "\n========================================================\n";
+            cout << "       LINEAR SEARCH PERFORMANCE COMPARISON\n";
+            cout << "========================================================\n";
+            cout << "Structure      Median (ns)    p99 (ns)      Memory (KB)\n";
+            cout << "--------------------------------------------------------\n";
+            cout << fixed << setprecision(1);
+            cout << "Array          "
+                << setw(11) << arrTime.medianNs << "    "
+                << setw(8) << arrTime.p99Ns << "      "
                 << memArr / 1024.0 << endl;
-            cout << "Linked List     "
-                << llTime << "           "
+            cout << "Linked List    "
+                << setw(11) << llTime.medianNs << "    "
+                << setw(8) << llTime.p99Ns << "      "
                 << memList / 1024.0 << endl;
-            cout << "----------------------------------------\n";
+            cout << "--------------------------------------------------------\n";
 
             cout << "\nResult Check:\n";
             cout << "Array: "
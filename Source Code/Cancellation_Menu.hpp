@@ -2,9 +2,15 @@
 #define CANCELLATION_MENU_HPP
 
 #include "Cancellation.hpp"
+#include "Benchmark.hpp"
+#include "Trace.hpp"
+#include "ReservationJournal.hpp"
 #include <chrono>
 #include <string>
 
-void showCancellationMenu(const char* filename);
+// Works on the given passengers; successful cancellations from options 1 and 2
+// are committed to `journal` when one is given
+void showCancellationMenu(const Passenger* passengers, int passengerCount,
+                          ReservationJournal* journal = nullptr);
 
 #endif 
\ No newline at end of file
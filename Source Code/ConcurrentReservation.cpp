@@ -0,0 +1,312 @@
+#include "ConcurrentReservation.hpp"
+#include "SeatOccupancy.hpp"
+#include "Trace.hpp"
+#include <thread>
+#include <cstdlib>
+#include <chrono>
+#include <string>
+
+// ==================== CONSTRUCTION ====================
+
+ConcurrentReservation::ConcurrentReservation(const AircraftLayout& seatMap)
+    : layout(seatMap), rows(seatMap.getRows()), cols(seatMap.getCols()),
+      rowBits(nullptr), records(nullptr), cabins(nullptr), cabinCount(0),
+      nextID(1), idToSeat(nullptr), idCapacity(0), passengerCount(0) {
+    fullRowMask = (cols == 32) ? 0xFFFFFFFFu : ((1u << cols) - 1u);
+
+    HeapScope scope(heap);
+    rowBits = new std::atomic<uint32_t>[rows > 0 ? rows : 1];
+    records = new SeatRecord[rows * cols > 0 ? rows * cols : 1];
+
+    cabinCount = layout.getCabinCount();
+    cabins = new CabinRange[cabinCount > 0 ? cabinCount : 1];
+    for (int i = 0; i < cabinCount; i++) {
+        const CabinSection& section = layout.getCabin(i);
+        cabins[i].seatClass = section.seatClass;
+        cabins[i].firstRow = section.firstRow - 1;
+        cabins[i].lastRow = section.lastRow - 1;
+    }
+
+    init(nullptr, 0, 0);
+}
+
+ConcurrentReservation::~ConcurrentReservation() {
+    delete[] rowBits;
+    delete[] records;
+    delete[] cabins;
+    delete[] idToSeat;
+}
+
+void ConcurrentReservation::init(const Passenger* passengers, int count, int maxID) {
+    TRACE_SPAN("index", "ConcurrentReservation::init");
+    int seatCount = rows * cols;
+
+    // New IDs run from maxID + 1 and there is at most one per seat
+    long neededIDs = (long)maxID + seatCount + 1;
+    if (neededIDs > idCapacity) {
+        HeapScope scope(indexHeap);
+        delete[] idToSeat;
+        idCapacity = neededIDs;
+        idToSeat = new std::atomic<int>[idCapacity];
+    }
+    for (long i = 0; i < idCapacity; i++) idToSeat[i].store(-1, std::memory_order_relaxed);
+
+    for (int r = 0; r < rows; r++) rowBits[r].store(0, std::memory_order_relaxed);
+    for (int s = 0; s < seatCount; s++) records[s].published.store(false, std::memory_order_relaxed);
+    for (int i = 0; i < cabinCount; i++) {
+        cabins[i].openRow.store(cabins[i].firstRow, std::memory_order_relaxed);
+    }
+
+    // Blocked seats are never claimable
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            if (layout.isBlocked(r + 1, c)) rowBits[r].fetch_or(1u << c, std::memory_order_relaxed);
+        }
+    }
+
+    HeapScope scope(heap);
+    int loaded = 0;
+    for (int i = 0; i < count; i++) {
+        const Passenger& p = passengers[i];
+        int r = p.seatRow - 1;
+        int c = p.seatColumn - 'A';
+        if (p.isEmpty || r < 0 || r >= rows || c < 0 || c >= cols) continue;
+
+        uint32_t bit = 1u << c;
+        if (rowBits[r].load(std::memory_order_relaxed) & bit) continue;   // duplicate seat
+        rowBits[r].fetch_or(bit, std::memory_order_relaxed);
+
+        int seat = r * cols + c;
+        records[seat].data = p;
+        records[seat].published.store(true, std::memory_order_relaxed);
+        long id = std::atol(p.passengerID.c_str());
+        if (id > 0 && id < idCapacity) idToSeat[id].store(seat, std::memory_order_relaxed);
+        loaded++;
+    }
+
+    nextID.store((long)maxID + 1, std::memory_order_relaxed);
+    passengerCount.store(loaded, std::memory_order_relaxed);
+    // Relaxed is enough: threads started (or joined with) after init() see these stores
+}
+
+// ==================== SEAT CLAIMING ====================
+
+// Lowest free seat of the cabin; CAS retries only when another thread
+// changed the same row word in between
+bool ConcurrentReservation::claimInCabin(int cabin, int& rowIndex, int& colIndex) {
+    CabinRange& range = cabins[cabin];
+    for (int r = range.openRow.load(std::memory_order_relaxed); r <= range.lastRow; r++) {
+        uint32_t word = rowBits[r].load(std::memory_order_relaxed);
+        while (true) {
+            uint32_t open = ~word & fullRowMask;
+            if (!open) break;
+
+            int c = lowestBit32(open);
+            uint32_t claimed = word | (1u << c);
+            if (rowBits[r].compare_exchange_weak(word, claimed, std::memory_order_acq_rel,
+                                                 std::memory_order_relaxed)) {
+                rowIndex = r;
+                colIndex = c;
+                if (claimed == fullRowMask) {
+                    int expected = r;
+                    range.openRow.compare_exchange_strong(expected, r + 1, std::memory_order_relaxed);
+                }
+                return true;
+            }
+        }
+
+        // Row is full: move the hint past it unless another thread already did
+        int expected = r;
+        range.openRow.compare_exchange_strong(expected, r + 1, std::memory_order_relaxed);
+    }
+    return false;
+}
+
+bool ConcurrentReservation::claimSeat(int preferredCabin, int& rowIndex, int& colIndex) {
+    if (preferredCabin >= 0 && claimInCabin(preferredCabin, rowIndex, colIndex)) return true;
+    for (int i = 0; i < cabinCount; i++) {
+        if (i != preferredCabin && claimInCabin(i, rowIndex, colIndex)) return true;
+    }
+    return false;
+}
+
+int ConcurrentReservation::cabinForClass(const std::string& cls) const {
+    for (int i = 0; i < cabinCount; i++) {
+        if (cabins[i].seatClass == cls) return i;
+    }
+    return -1;
+}
+
+// ==================== BOOKING / LOOKUP ====================
+
+bool ConcurrentReservation::reserve(const std::string& name, const std::string& cls, Passenger& out) {
+    TRACE_SPAN("reserve", "ConcurrentReservation::reserve");
+    int r, c;
+    if (!claimSeat(cabinForClass(cls), r, c)) return false;
+
+    // The seat is ours alone from here on; fill its record, then publish
+    long id = nextID.fetch_add(1, std::memory_order_relaxed);
+    int seat = r * cols + c;
+    SeatRecord& rec = records[seat];
+    {
+        HeapScope scope(heap);
+        rec.data.passengerID = std::to_string(id);
+        rec.data.name = name;
+        rec.data.seatRow = r + 1;
+        rec.data.seatColumn = (char)('A' + c);
+        rec.data.seatClass = cls;
+        rec.data.isEmpty = false;
+        out = rec.data;
+    }
+    rec.published.store(true, std::memory_order_release);
+    if (id < idCapacity) idToSeat[id].store(seat, std::memory_order_release);
+
+    passengerCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+const Passenger* ConcurrentReservation::searchIndexed(const std::string& id) const {
+    long numID = std::atol(id.c_str());
+    if (numID <= 0 || numID >= idCapacity) return nullptr;
+
+    int seat = idToSeat[numID].load(std::memory_order_acquire);
+    return seat >= 0 ? &records[seat].data : nullptr;
+}
+
+const Passenger* ConcurrentReservation::findBySeat(int row, char column) const {
+    int r = row - 1;
+    int c = column - 'A';
+    if (r < 0 || r >= rows || c < 0 || c >= cols) return nullptr;
+
+    const SeatRecord& rec = records[r * cols + c];
+    return rec.published.load(std::memory_order_acquire) ? &rec.data : nullptr;
+}
+
+int ConcurrentReservation::countReservedSeats() const {
+    int total = 0;
+    for (int r = 0; r < rows; r++) total += popcount32(rowBits[r].load(std::memory_order_relaxed));
+    return total - layout.getBlockedCount();
+}
+
+long ConcurrentReservation::memoryUsage() const {
+    return (long)(heap.stats().footprintBytes + indexHeap.stats().footprintBytes);
+}
+
+// ==================== STRESS BENCHMARK ====================
+
+namespace {
+
+struct StressWorker {
+    ConcurrentReservation* engine;
+    const AircraftLayout* layout;
+    int threadIndex;
+    int* seats;          // seat index of every booking this thread made
+    long* ids;
+    int booked;
+    std::atomic<int>* ready;
+    std::atomic<bool>* go;
+    std::atomic<int>* done;
+
+    void run() {
+        ready->fetch_add(1);
+        while (!go->load(std::memory_order_acquire)) std::this_thread::yield();
+
+        // Rotate through the cabins so every cabin hint sees traffic
+        int cabinCount = layout->getCabinCount();
+        Passenger p;
+        for (int i = 0; ; i++) {
+            const std::string& cls = layout->getCabin((threadIndex + i) % cabinCount).seatClass;
+            if (!engine->reserve("Stress", cls, p)) break;
+            seats[booked] = (p.seatRow - 1) * layout->getCols() + (p.seatColumn - 'A');
+            ids[booked] = std::atol(p.passengerID.c_str());
+            booked++;
+        }
+        done->fetch_add(1, std::memory_order_release);
+    }
+};
+
+}  // namespace
+
+ConcurrentStressResult runConcurrentBookingStress(const AircraftLayout& layout, int threads, int reps) {
+    TRACE_SPAN("bench", "runConcurrentBookingStress");
+    if (threads < 1) threads = 1;
+    if (reps < 1) reps = 1;
+
+    int seatCount = layout.getRows() * layout.getCols();
+    ConcurrentStressResult result;
+    result.threads = threads;
+    result.bookings = 0;
+    result.doubleBooked = 0;
+    result.indexErrors = 0;
+    result.fillErrors = 0;
+
+    ConcurrentReservation* engine = new ConcurrentReservation(layout);
+    StressWorker* workers = new StressWorker[threads];
+    for (int t = 0; t < threads; t++) {
+        workers[t].seats = new int[seatCount > 0 ? seatCount : 1];
+        workers[t].ids = new long[seatCount > 0 ? seatCount : 1];
+    }
+    int* claims = new int[seatCount > 0 ? seatCount : 1];
+    double* perBookingNs = new double[reps];
+
+    for (int rep = 0; rep < reps; rep++) {
+        engine->init(nullptr, 0, 0);
+
+        std::atomic<int> ready(0);
+        std::atomic<bool> go(false);
+        std::atomic<int> done(0);
+        std::thread* pool = new std::thread[threads];
+        for (int t = 0; t < threads; t++) {
+            StressWorker& w = workers[t];
+            w.engine = engine;
+            w.layout = &layout;
+            w.threadIndex = t;
+            w.booked = 0;
+            w.ready = &ready;
+            w.go = &go;
+            w.done = &done;
+            pool[t] = std::thread(&StressWorker::run, &w);
+        }
+
+        // Time from the start signal until the last worker finishes
+        while (ready.load() < threads) std::this_thread::yield();
+        auto start = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+        while (done.load(std::memory_order_acquire) < threads) std::this_thread::yield();
+        auto end = std::chrono::steady_clock::now();
+        for (int t = 0; t < threads; t++) pool[t].join();
+        delete[] pool;
+
+        // --- VERIFY: every seat handed out once, every booking indexed at its seat ---
+        for (int s = 0; s < seatCount; s++) claims[s] = 0;
+        long total = 0;
+        for (int t = 0; t < threads; t++) {
+            const StressWorker& w = workers[t];
+            for (int i = 0; i < w.booked; i++) {
+                if (++claims[w.seats[i]] == 2) result.doubleBooked++;
+                const Passenger* p = engine->searchIndexed(std::to_string(w.ids[i]));
+                if (!p || (p->seatRow - 1) * layout.getCols() + (p->seatColumn - 'A') != w.seats[i]) {
+                    result.indexErrors++;
+                }
+            }
+            total += w.booked;
+        }
+        if (total != layout.getSeatCount() || engine->countReservedSeats() != total) result.fillErrors++;
+
+        result.bookings = total;
+        perBookingNs[rep] = elapsedNs(start, end) / (total > 0 ? total : 1);
+    }
+
+    result.timing = summarizeSamples(perBookingNs, reps, result.bookings);
+    result.bookingsPerSecond = result.timing.medianNs > 0.0 ? 1e9 / result.timing.medianNs : 0.0;
+
+    delete[] perBookingNs;
+    delete[] claims;
+    for (int t = 0; t < threads; t++) {
+        delete[] workers[t].seats;
+        delete[] workers[t].ids;
+    }
+    delete[] workers;
+    delete engine;
+    return result;
+}
@@ -0,0 +1,99 @@
+#ifndef CONCURRENT_RESERVATION_HPP
+#define CONCURRENT_RESERVATION_HPP
+
+#include "Passenger.hpp"
+#include "AircraftLayout.hpp"
+#include "HeapTracker.hpp"
+#include "Benchmark.hpp"
+#include <atomic>
+#include <string>
+
+// Reservation engine that accepts bookings from many threads at once.
+//
+// - Seats are claimed with compare-and-swap on the row's 32-bit occupancy
+//   word; each cabin keeps its own "first open row" hint, so bookings for
+//   different classes do not contend on the same words.
+// - Passenger IDs come from one atomic counter.
+// - Each seat owns its record slot, so the claiming thread fills it without
+//   locking, then publishes it (release store). Readers go through the
+//   ID -> seat index with acquire loads and never see a half-written record.
+//
+// init() is single-threaded; reserve(), searchIndexed() and findBySeat() may
+// run concurrently. There is no cancellation, so claimed seats stay claimed.
+class ConcurrentReservation {
+public:
+    explicit ConcurrentReservation(const AircraftLayout& layout = activeLayout());
+    ~ConcurrentReservation();
+
+    ConcurrentReservation(const ConcurrentReservation&) = delete;
+    ConcurrentReservation& operator=(const ConcurrentReservation&) = delete;
+
+    // Loads existing passengers; must finish before concurrent use
+    void init(const Passenger* passengers, int passengerCount, int maxID);
+
+    // Thread-safe. Tries the cabin named by `cls` first, then the rest of the aircraft.
+    bool reserve(const std::string& name, const std::string& cls, Passenger& out);
+
+    // Thread-safe readers; nullptr until the booking is published
+    const Passenger* searchIndexed(const std::string& id) const;
+    const Passenger* findBySeat(int row, char column) const;
+
+    int getPassengerCount() const { return passengerCount.load(std::memory_order_relaxed); }
+    int countReservedSeats() const;
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+    long memoryUsage() const;
+
+private:
+    struct SeatRecord {
+        Passenger data;
+        std::atomic<bool> published;
+    };
+
+    struct CabinRange {
+        std::string seatClass;
+        int firstRow;                // 0-indexed, inclusive
+        int lastRow;
+        std::atomic<int> openRow;    // every row of the cabin before this one is full
+    };
+
+    bool claimInCabin(int cabin, int& rowIndex, int& colIndex);
+    bool claimSeat(int preferredCabin, int& rowIndex, int& colIndex);
+    int cabinForClass(const std::string& cls) const;
+
+    HeapAccount heap;        // seat words, records + their strings
+    HeapAccount indexHeap;   // ID -> seat index
+    AircraftLayout layout;
+    int rows;
+    int cols;
+    uint32_t fullRowMask;
+
+    std::atomic<uint32_t>* rowBits;   // bit c set = seat c taken
+    SeatRecord* records;              // rows * cols, indexed by seat
+    CabinRange* cabins;
+    int cabinCount;
+
+    std::atomic<long> nextID;
+    std::atomic<int>* idToSeat;       // -1 = not published
+    long idCapacity;
+    std::atomic<int> passengerCount;
+};
+
+// ==================== STRESS BENCHMARK ====================
+
+struct ConcurrentStressResult {
+    int threads;
+    long bookings;            // per run (every free seat of an empty aircraft)
+    BenchmarkResult timing;   // wall time per booking across all threads
+    double bookingsPerSecond; // from the median run
+    int doubleBooked;         // seats handed out more than once (must be 0)
+    int indexErrors;          // bookings not found, or found at the wrong seat
+    int fillErrors;           // runs that left free seats or lost a booking
+    bool verified() const { return doubleBooked == 0 && indexErrors == 0 && fillErrors == 0; }
+};
+
+// Fills an empty aircraft of `layout` from `threads` threads, `reps` times,
+// and checks every run for double-booked seats and index consistency
+ConcurrentStressResult runConcurrentBookingStress(const AircraftLayout& layout, int threads, int reps);
+
+#endif
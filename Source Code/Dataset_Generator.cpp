@@ -0,0 +1,316 @@
+#include "Dataset_Generator.hpp"
+#include "PassengerBinary.hpp"
+#include "Seat_Manifest.hpp"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <cstdio>
+
+// ==================== DETERMINISTIC RANDOMNESS ====================
+
+// SplitMix64: tiny, fast, and identical on every platform for a given seed
+struct SplitMix64 {
+    uint64_t state;
+
+    explicit SplitMix64(uint64_t seed) : state(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t nextBelow(uint64_t bound) { return bound ? next() % bound : 0; }
+    double nextDouble() { return (next() >> 11) * (1.0 / 9007199254740992.0); }
+};
+
+static uint64_t gcd64(uint64_t a, uint64_t b) {
+    while (b) {
+        uint64_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// Bijection on [0, n): k -> (a*k + b) mod n with gcd(a, n) = 1.
+// Streams a full permutation in O(1) memory, which a 100M-row shuffle needs.
+// n must stay below 2^32 so a*k fits in 64 bits.
+struct AffinePermutation {
+    uint64_t n;
+    uint64_t a;
+    uint64_t b;
+
+    AffinePermutation(uint64_t size, SplitMix64& rng) : n(size ? size : 1), a(1), b(0) {
+        if (n > 1) {
+            a = rng.nextBelow(n - 1) + 1;
+            while (gcd64(a, n) != 1) a = a % (n - 1) + 1;
+            b = rng.nextBelow(n);
+        }
+    }
+
+    uint64_t operator()(uint64_t k) const {
+        return ((a * k) % n + b) % n;
+    }
+};
+
+// ==================== OPTIONS ====================
+
+enum IdMode { IDS_SEQUENTIAL, IDS_SHUFFLED, IDS_SPARSE };
+
+struct GeneratorOptions {
+    long long records;
+    int cols;
+    double occupancy;
+    double emptyFraction;
+    IdMode idMode;
+    int nameMin;
+    int nameMax;
+    int flights;
+    uint64_t seed;
+    bool writeCSV;
+    bool writeBinary;
+    std::string outPrefix;
+
+    GeneratorOptions()
+        : records(10400), cols(26), occupancy(1.0), emptyFraction(0.04), idMode(IDS_SEQUENTIAL),
+          nameMin(8), nameMax(20), flights(1), seed(42), writeCSV(true), writeBinary(true),
+          outPrefix("synthetic") {}
+};
+
+static void printGenerateUsage() {
+    std::cout << "Usage: <program> --generate [options]\n"
+              << "  --records N        rows per flight incl. empty seats (default 10400)\n"
+              << "  --cols N           seats per row, 1-26 (default 26)\n"
+              << "  --occupancy F      fraction of aircraft seats listed (default 1.0)\n"
+              << "  --empty F          fraction of rows that are empty seats (default 0.04)\n"
+              << "  --ids MODE         sequential | shuffled | sparse\n"
+              << "  --name-min N       minimum name length (default 8)\n"
+              << "  --name-max N       maximum name length (default 20)\n"
+              << "  --flights N        number of flights (default 1)\n"
+              << "  --seed N           random seed (default 42)\n"
+              << "  --format LIST      csv,bin (default both)\n"
+              << "  --out PREFIX       output path prefix (default synthetic)\n";
+}
+
+static bool parseGeneratorOptions(int argc, char** argv, GeneratorOptions& opts) {
+    for (int i = 0; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") return false;
+
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << "\n";
+            return false;
+        }
+        std::string value = argv[++i];
+
+        if (arg == "--records") opts.records = std::atoll(value.c_str());
+        else if (arg == "--cols") opts.cols = std::atoi(value.c_str());
+        else if (arg == "--occupancy") opts.occupancy = std::atof(value.c_str());
+        else if (arg == "--empty") opts.emptyFraction = std::atof(value.c_str());
+        else if (arg == "--name-min") opts.nameMin = std::atoi(value.c_str());
+        else if (arg == "--name-max") opts.nameMax = std::atoi(value.c_str());
+        else if (arg == "--flights") opts.flights = std::atoi(value.c_str());
+        else if (arg == "--seed") opts.seed = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--out") opts.outPrefix = value;
+        else if (arg == "--ids") {
+            if (value == "sequential") opts.idMode = IDS_SEQUENTIAL;
+            else if (value == "shuffled") opts.idMode = IDS_SHUFFLED;
+            else if (value == "sparse") opts.idMode = IDS_SPARSE;
+            else {
+                std::cerr << "Unknown ID mode: " << value << "\n";
+                return false;
+            }
+        } else if (arg == "--format") {
+            opts.writeCSV = value.find("csv") != std::string::npos;
+            opts.writeBinary = value.find("bin") != std::string::npos;
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            return false;
+        }
+    }
+
+    if (opts.records < 1 || opts.records > 0x7FFFFFFFll) {
+        std::cerr << "--records must be between 1 and 2147483647\n";
+        return false;
+    }
+    if (opts.cols < 1 || opts.cols > 26) {
+        std::cerr << "--cols must be between 1 and 26\n";
+        return false;
+    }
+    if (opts.occupancy <= 0.0 || opts.occupancy > 1.0) {
+        std::cerr << "--occupancy must be in (0, 1]\n";
+        return false;
+    }
+    if (opts.emptyFraction < 0.0 || opts.emptyFraction > 1.0) {
+        std::cerr << "--empty must be in [0, 1]\n";
+        return false;
+    }
+    if (opts.nameMin < 1) opts.nameMin = 1;
+    if (opts.nameMax > 255) opts.nameMax = 255;
+    if (opts.nameMax < opts.nameMin) opts.nameMax = opts.nameMin;
+    if (opts.flights < 1) opts.flights = 1;
+    if (!opts.writeCSV && !opts.writeBinary) {
+        std::cerr << "--format must include csv and/or bin\n";
+        return false;
+    }
+    if (opts.records * opts.flights > 0xFFFFFFFFll) {
+        std::cerr << "--records x --flights must stay below 4294967296\n";
+        return false;
+    }
+    if (opts.idMode == IDS_SPARSE && opts.records * opts.flights > 900000000ll) {
+        std::cerr << "sparse IDs support at most 900000000 records in total\n";
+        return false;
+    }
+    return true;
+}
+
+// ==================== RECORD GENERATION ====================
+
+// Same name pools as the shipped dataset, so duplicates occur naturally
+static const char* FIRST_NAMES[] = {
+    "Alice", "Bob", "Carol", "David", "Eve", "Frank", "Grace", "Henry", "Ivy", "Jack",
+    "Kate", "Leo", "Mia", "Noah", "Olivia", "Paul", "Quinn", "Ryan", "Sara", "Tom"
+};
+static const char* LAST_NAMES[] = {
+    "Anderson", "Brown", "Davis", "Garcia", "Harris", "Jackson", "Johnson", "Jones",
+    "Martin", "Martinez", "Miller", "Rodriguez", "Smith", "Taylor", "Thomas", "White",
+    "Williams", "Wilson"
+};
+static const int FIRST_NAME_COUNT = sizeof(FIRST_NAMES) / sizeof(FIRST_NAMES[0]);
+static const int LAST_NAME_COUNT = sizeof(LAST_NAMES) / sizeof(LAST_NAMES[0]);
+
+// "First Last", extended with extra surnames up to a random target length
+static void makeName(SplitMix64& rng, int minLen, int maxLen, std::string& name) {
+    int target = minLen + (int)rng.nextBelow((uint64_t)(maxLen - minLen + 1));
+
+    name = FIRST_NAMES[rng.nextBelow(FIRST_NAME_COUNT)];
+    name += ' ';
+    name += LAST_NAMES[rng.nextBelow(LAST_NAME_COUNT)];
+    while ((int)name.size() < target) {
+        name += '-';
+        name += LAST_NAMES[rng.nextBelow(LAST_NAME_COUNT)];
+    }
+    if ((int)name.size() > maxLen) name.resize(maxLen);
+}
+
+static uint64_t makeID(IdMode mode, uint64_t globalIndex, const AffinePermutation& idPerm) {
+    switch (mode) {
+        case IDS_SHUFFLED: return 100000 + idPerm(globalIndex);
+        case IDS_SPARSE:   return 100000000 + idPerm(globalIndex);
+        default:           return 100000 + globalIndex;
+    }
+}
+
+static std::string flightPath(const GeneratorOptions& opts, int flight, const char* ext) {
+    if (opts.flights == 1) return opts.outPrefix + ext;
+    char suffix[16];
+    std::snprintf(suffix, sizeof(suffix), "_F%04d", flight + 1);
+    return opts.outPrefix + suffix + ext;
+}
+
+static bool generateFlight(const GeneratorOptions& opts, int flight, int rows,
+                           const AffinePermutation& idPerm) {
+    // Independent, reproducible stream per flight
+    SplitMix64 rng(opts.seed * 0x100000001B3ull + (uint64_t)flight);
+
+    uint64_t totalSeats = (uint64_t)rows * opts.cols;
+    AffinePermutation seatPerm(totalSeats, rng);
+
+    std::ofstream csv;
+    static char csvBuffer[1 << 20];
+    if (opts.writeCSV) {
+        csv.rdbuf()->pubsetbuf(csvBuffer, sizeof(csvBuffer));
+        csv.open(flightPath(opts, flight, ".csv").c_str(), std::ios::trunc);
+        if (!csv.is_open()) return false;
+        csv << "PassengerID,Name,SeatRow,SeatColumn,Class\n";
+    }
+
+    PassengerBinaryWriter bin;
+    if (opts.writeBinary && !bin.open(flightPath(opts, flight, ".bin").c_str(), rows, opts.cols)) {
+        return false;
+    }
+
+    std::string id, name, seatClass, line;
+    for (long long k = 0; k < opts.records; k++) {
+        // Records are in ID order with scattered seats, like the shipped dataset
+        uint64_t seat = seatPerm((uint64_t)k);
+        int seatRow = (int)(seat / opts.cols) + 1;
+        char seatColumn = (char)('A' + seat % opts.cols);
+        seatClass = getClassFromRow(seatRow);
+
+        bool isEmpty = rng.nextDouble() < opts.emptyFraction;
+        if (isEmpty) {
+            id = "Empty";
+            name = "Empty";
+        } else {
+            uint64_t globalIndex = (uint64_t)flight * opts.records + k;
+            id = std::to_string(makeID(opts.idMode, globalIndex, idPerm));
+            makeName(rng, opts.nameMin, opts.nameMax, name);
+        }
+
+        if (opts.writeCSV) {
+            line = id;
+            line += ',';
+            line += name;
+            line += ',';
+            line += std::to_string(seatRow);
+            line += ',';
+            line += seatColumn;
+            line += ',';
+            line += seatClass;
+            line += '\n';
+            csv.write(line.data(), (std::streamsize)line.size());
+        }
+        if (opts.writeBinary) {
+            bin.write(id, name, seatRow, seatColumn, seatClass, isEmpty);
+        }
+    }
+
+    bool ok = true;
+    if (opts.writeCSV) {
+        csv.close();
+        ok = !csv.fail();
+    }
+    if (opts.writeBinary) ok = bin.close() && ok;
+    return ok;
+}
+
+// ==================== ENTRY POINT ====================
+
+int runGenerateCli(int argc, char** argv) {
+    GeneratorOptions opts;
+    if (!parseGeneratorOptions(argc, argv, opts)) {
+        printGenerateUsage();
+        return 2;
+    }
+
+    // Aircraft just large enough for the requested occupancy
+    long long seatsNeeded = (long long)(opts.records / opts.occupancy + 0.5);
+    if (seatsNeeded < opts.records) seatsNeeded = opts.records;
+    int rows = (int)((seatsNeeded + opts.cols - 1) / opts.cols);
+
+    uint64_t totalRecords = (uint64_t)opts.records * opts.flights;
+    SplitMix64 idRng(opts.seed ^ 0xA5A5A5A5A5A5A5A5ull);
+    AffinePermutation idPerm(opts.idMode == IDS_SPARSE ? 900000000ull : totalRecords, idRng);
+
+    std::cout << "Generating " << opts.flights << " flight(s) x " << opts.records
+              << " records (" << rows << " rows x " << opts.cols << " seats, seed "
+              << opts.seed << ")\n";
+
+    for (int f = 0; f < opts.flights; f++) {
+        if (!generateFlight(opts, f, rows, idPerm)) {
+            std::cerr << "Error: could not write flight " << (f + 1) << " output\n";
+            return 1;
+        }
+    }
+
+    std::cout << "Wrote " << opts.flights * ((opts.writeCSV ? 1 : 0) + (opts.writeBinary ? 1 : 0))
+              << " file(s): " << flightPath(opts, 0, opts.writeCSV ? ".csv" : ".bin")
+              << (opts.flights > 1 ? " ..." : "") << "\n";
+    return 0;
+}
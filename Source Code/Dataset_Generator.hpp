@@ -0,0 +1,23 @@
+#ifndef DATASET_GENERATOR_HPP
+#define DATASET_GENERATOR_HPP
+
+// Synthetic dataset mode: `<program> --generate [options]`.
+// Writes deterministic (seeded) passenger datasets of any size as CSV and/or
+// the binary layout from PassengerBinary.hpp, optionally for many flights.
+//
+// Options:
+//   --records N        passenger rows per flight, including empty seats (default 10400)
+//   --cols N           seats per row, 1-26 (default 26)
+//   --occupancy F      fraction of aircraft seats that appear in the file (default 1.0)
+//   --empty F          fraction of rows marked as empty seats (default 0.04)
+//   --ids MODE         sequential | shuffled | sparse (distinct 9-digit IDs)
+//   --name-min N       minimum name length (default 8)
+//   --name-max N       maximum name length (default 20)
+//   --flights N        number of flights; one file pair per flight (default 1)
+//   --seed N           random seed (default 42)
+//   --format LIST      csv,bin (default both)
+//   --out PREFIX       output path prefix (default synthetic)
+// Returns a process exit code (0 on success).
+int runGenerateCli(int argc, char** argv);
+
+#endif
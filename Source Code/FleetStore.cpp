@@ -0,0 +1,329 @@
+#include "FleetStore.hpp"
+#include "Trace.hpp"
+#include <cstring>
+#include <cstdlib>
+
+// ==================== HASHING ====================
+
+// FNV-1a; tables are power-of-two sized, so the result is mixed before masking
+static uint32_t hashText(const std::string& text) {
+    uint32_t hash = 2166136261u;
+    for (char c : text) {
+        hash ^= (unsigned char)c;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t mixHash(uint32_t h) {
+    h ^= h >> 16;
+    h *= 0x45d9f3bu;
+    h ^= h >> 16;
+    return h;
+}
+
+static uint32_t flightHash(const std::string& flightNumber, int date) {
+    return mixHash(hashText(flightNumber) ^ ((uint32_t)date * 0x9E3779B1u));
+}
+
+// ==================== FLIGHT SHARD ====================
+
+FlightShard::FlightShard(const std::string& number, int flightDate, const AircraftLayout& layout)
+    : flightNumber(number), date(flightDate), fleetIndex(-1),
+      seats(layout.getRows(), layout.getCols()), seatToSlot(nullptr),
+      manifest(nullptr), count(0), capacity(0) {
+    layout.markBlocked(seats);
+
+    int seatCount = layout.getRows() * layout.getCols();
+    seatToSlot = new int[seatCount > 0 ? seatCount : 1];
+    for (int i = 0; i < seatCount; i++) seatToSlot[i] = -1;
+}
+
+FlightShard::~FlightShard() {
+    delete[] seatToSlot;
+    delete[] manifest;
+}
+
+// Manifest grows on demand so lightly booked flights stay small
+void FlightShard::growManifest() {
+    int newCapacity = capacity == 0 ? 16 : capacity * 2;
+    Passenger* grown = new Passenger[newCapacity];
+    for (int i = 0; i < count; i++) grown[i] = std::move(manifest[i]);
+    delete[] manifest;
+    manifest = grown;
+    capacity = newCapacity;
+}
+
+int FlightShard::book(const std::string& id, const std::string& name, const std::string& cls) {
+    int r, c;
+    if (!seats.findFirstAvailable(r, c)) return -1;
+    return fill(r, c, id, name, cls);
+}
+
+int FlightShard::bookSeat(int r, int c, const std::string& id, const std::string& name, const std::string& cls) {
+    if (r < 0 || r >= seats.getRows() || c < 0 || c >= seats.getCols() || seats.isReserved(r, c)) return -1;
+    return fill(r, c, id, name, cls);
+}
+
+int FlightShard::fill(int r, int c, const std::string& id, const std::string& name, const std::string& cls) {
+    if (count == capacity) growManifest();
+
+    int slot = count++;
+    Passenger& p = manifest[slot];
+    p.passengerID = id;
+    p.name = name;
+    p.seatRow = r + 1;
+    p.seatColumn = (char)('A' + c);
+    p.seatClass = cls;
+    p.isEmpty = false;
+
+    seats.reserve(r, c);
+    seatToSlot[r * seats.getCols() + c] = slot;
+    return slot;
+}
+
+int FlightShard::remove(int slot) {
+    const Passenger& gone = manifest[slot];
+    int r = gone.seatRow - 1;
+    int c = gone.seatColumn - 'A';
+    seats.release(r, c);
+    seatToSlot[r * seats.getCols() + c] = -1;
+
+    int last = --count;
+    if (slot == last) return -1;
+
+    manifest[slot] = std::move(manifest[last]);
+    const Passenger& moved = manifest[slot];
+    seatToSlot[(moved.seatRow - 1) * seats.getCols() + (moved.seatColumn - 'A')] = slot;
+    return slot;
+}
+
+const Passenger* FlightShard::findBySeat(int row, char column) const {
+    int r = row - 1;
+    int c = column - 'A';
+    if (r < 0 || r >= seats.getRows() || c < 0 || c >= seats.getCols()) return nullptr;
+    int slot = seatToSlot[r * seats.getCols() + c];
+    return slot >= 0 ? &manifest[slot] : nullptr;
+}
+
+// ==================== FLEET STORE ====================
+
+FleetStore::FleetStore(long firstPassengerID)
+    : shards(nullptr), shardCount(0), shardCapacity(0),
+      directory(nullptr), directoryCapacity(0),
+      idTable(nullptr), idCapacity(0), idCount(0), nextID(firstPassengerID) {
+    HeapScope scope(indexHeap);
+    directoryCapacity = 64;
+    directory = new int[directoryCapacity];
+    for (int i = 0; i < directoryCapacity; i++) directory[i] = -1;
+
+    idCapacity = 1024;
+    idTable = new IdEntry[idCapacity];
+    for (int i = 0; i < idCapacity; i++) idTable[i].shard = -1;
+}
+
+FleetStore::~FleetStore() {
+    for (int i = 0; i < shardCount; i++) delete shards[i];
+    delete[] shards;
+    delete[] directory;
+    delete[] idTable;
+}
+
+// --- FLIGHT DIRECTORY ---
+
+void FleetStore::growDirectory() {
+    HeapScope scope(indexHeap);
+    int newCapacity = directoryCapacity * 2;
+    int* grown = new int[newCapacity];
+    for (int i = 0; i < newCapacity; i++) grown[i] = -1;
+
+    for (int s = 0; s < shardCount; s++) {
+        uint32_t pos = flightHash(shards[s]->flightNumber, shards[s]->date) & (newCapacity - 1);
+        while (grown[pos] >= 0) pos = (pos + 1) & (newCapacity - 1);
+        grown[pos] = s;
+    }
+    delete[] directory;
+    directory = grown;
+    directoryCapacity = newCapacity;
+}
+
+FlightShard* FleetStore::addFlight(const std::string& flightNumber, int date,
+                                   const AircraftLayout& layout) {
+    if (findFlight(flightNumber, date)) return nullptr;
+    if ((shardCount + 1) * 10 > directoryCapacity * 7) growDirectory();
+
+    FlightShard* flight;
+    {
+        HeapScope scope(heap);
+        if (shardCount == shardCapacity) {
+            int newCapacity = shardCapacity == 0 ? 16 : shardCapacity * 2;
+            FlightShard** grown = new FlightShard*[newCapacity];
+            for (int i = 0; i < shardCount; i++) grown[i] = shards[i];
+            delete[] shards;
+            shards = grown;
+            shardCapacity = newCapacity;
+        }
+        flight = new FlightShard(flightNumber, date, layout);
+    }
+
+    flight->fleetIndex = shardCount;
+    shards[shardCount] = flight;
+
+    uint32_t pos = flightHash(flightNumber, date) & (directoryCapacity - 1);
+    while (directory[pos] >= 0) pos = (pos + 1) & (directoryCapacity - 1);
+    directory[pos] = shardCount++;
+    return flight;
+}
+
+FlightShard* FleetStore::findFlight(const std::string& flightNumber, int date) const {
+    uint32_t pos = flightHash(flightNumber, date) & (directoryCapacity - 1);
+    while (directory[pos] >= 0) {
+        FlightShard* flight = shards[directory[pos]];
+        if (flight->date == date && flight->flightNumber == flightNumber) return flight;
+        pos = (pos + 1) & (directoryCapacity - 1);
+    }
+    return nullptr;
+}
+
+// --- GLOBAL PASSENGER INDEX ---
+
+void FleetStore::growIdTable() {
+    HeapScope scope(indexHeap);
+    int newCapacity = idCapacity * 2;
+    IdEntry* grown = new IdEntry[newCapacity];
+    for (int i = 0; i < newCapacity; i++) grown[i].shard = -1;
+
+    for (int i = 0; i < idCapacity; i++) {
+        IdEntry& e = idTable[i];
+        if (e.shard < 0) continue;
+        uint32_t pos = e.hash & (newCapacity - 1);
+        while (grown[pos].shard >= 0) pos = (pos + 1) & (newCapacity - 1);
+        grown[pos].id.swap(e.id);
+        grown[pos].hash = e.hash;
+        grown[pos].shard = e.shard;
+        grown[pos].slot = e.slot;
+    }
+    delete[] idTable;
+    idTable = grown;
+    idCapacity = newCapacity;
+}
+
+// Table slot holding `id`, or -1
+int FleetStore::findIdSlot(const std::string& id, uint32_t hash) const {
+    uint32_t pos = hash & (idCapacity - 1);
+    while (idTable[pos].shard >= 0) {
+        if (idTable[pos].hash == hash && idTable[pos].id == id) return (int)pos;
+        pos = (pos + 1) & (idCapacity - 1);
+    }
+    return -1;
+}
+
+void FleetStore::insertId(const std::string& id, int shard, int slot) {
+    if ((idCount + 1) * 10 > idCapacity * 7) growIdTable();
+
+    uint32_t hash = mixHash(hashText(id));
+    uint32_t pos = hash & (idCapacity - 1);
+    while (idTable[pos].shard >= 0) pos = (pos + 1) & (idCapacity - 1);
+
+    HeapScope scope(indexHeap);
+    idTable[pos].id = id;
+    idTable[pos].hash = hash;
+    idTable[pos].shard = shard;
+    idTable[pos].slot = slot;
+    idCount++;
+}
+
+// Backward-shift deletion keeps probe chains intact without tombstones
+void FleetStore::eraseIdSlot(int tableSlot) {
+    uint32_t mask = (uint32_t)idCapacity - 1;
+    uint32_t hole = (uint32_t)tableSlot;
+    uint32_t pos = (hole + 1) & mask;
+
+    while (idTable[pos].shard >= 0) {
+        uint32_t home = idTable[pos].hash & mask;
+        // Move the entry back if its home is not within (hole, pos]
+        if (((pos - home) & mask) >= ((pos - hole) & mask)) {
+            idTable[hole].id.swap(idTable[pos].id);
+            idTable[hole].hash = idTable[pos].hash;
+            idTable[hole].shard = idTable[pos].shard;
+            idTable[hole].slot = idTable[pos].slot;
+            hole = pos;
+        }
+        pos = (pos + 1) & mask;
+    }
+    idTable[hole].shard = -1;
+    idTable[hole].id.clear();
+    idCount--;
+}
+
+// --- BOOKING / LOOKUP ---
+
+bool FleetStore::book(FlightShard* flight, const std::string& name, const std::string& cls,
+                      Passenger& out) {
+    TRACE_SPAN("reserve", "FleetStore::book");
+    if (!flight) return false;
+
+    std::string id = std::to_string(nextID);
+    int slot;
+    {
+        HeapScope scope(heap);
+        slot = flight->book(id, name, cls);
+    }
+    if (slot < 0) return false;
+
+    nextID++;
+    insertId(id, flight->fleetIndex, slot);
+    out = flight->manifest[slot];
+    return true;
+}
+
+bool FleetStore::place(FlightShard* flight, const Passenger& p) {
+    if (!flight || findPassenger(p.passengerID)) return false;
+
+    int slot;
+    {
+        HeapScope scope(heap);
+        slot = flight->bookSeat(p.seatRow - 1, p.seatColumn - 'A', p.passengerID, p.name, p.seatClass);
+    }
+    if (slot < 0) return false;
+    insertId(p.passengerID, flight->fleetIndex, slot);
+
+    // Keep assigned IDs clear of numeric IDs restored this way
+    char* end = nullptr;
+    long numeric = std::strtol(p.passengerID.c_str(), &end, 10);
+    if (!p.passengerID.empty() && *end == '\0' && numeric >= nextID) nextID = numeric + 1;
+    return true;
+}
+
+bool FleetStore::cancel(const std::string& passengerID) {
+    TRACE_SPAN("cancel", "FleetStore::cancel");
+    int tableSlot = findIdSlot(passengerID, mixHash(hashText(passengerID)));
+    if (tableSlot < 0) return false;
+
+    FlightShard* flight = shards[idTable[tableSlot].shard];
+    int movedSlot;
+    {
+        HeapScope scope(heap);
+        movedSlot = flight->remove(idTable[tableSlot].slot);
+    }
+    eraseIdSlot(tableSlot);
+
+    // The flight's last passenger now lives in the freed manifest slot
+    if (movedSlot >= 0) {
+        const std::string& movedID = flight->manifest[movedSlot].passengerID;
+        int movedEntry = findIdSlot(movedID, mixHash(hashText(movedID)));
+        if (movedEntry >= 0) idTable[movedEntry].slot = movedSlot;
+    }
+    return true;
+}
+
+const Passenger* FleetStore::findPassenger(const std::string& passengerID,
+                                           const FlightShard** flightOut) const {
+    int tableSlot = findIdSlot(passengerID, mixHash(hashText(passengerID)));
+    if (tableSlot < 0) return nullptr;
+
+    const IdEntry& e = idTable[tableSlot];
+    const FlightShard* flight = shards[e.shard];
+    if (flightOut) *flightOut = flight;
+    return &flight->manifest[e.slot];
+}
@@ -0,0 +1,121 @@
+#ifndef FLEET_STORE_HPP
+#define FLEET_STORE_HPP
+
+#include "Passenger.hpp"
+#include "SeatOccupancy.hpp"
+#include "AircraftLayout.hpp"
+#include "HeapTracker.hpp"
+#include <string>
+#include <cstdint>
+
+// Many independent flights keyed by (flight number, date). Each flight is a
+// shard holding its own seat map, seat index and manifest; passengers are
+// found across the whole fleet through one global ID index.
+
+class FleetStore;
+
+// One flight: seat bitmap, seat -> manifest slot index and the manifest
+class FlightShard {
+    friend class FleetStore;
+
+private:
+    std::string flightNumber;
+    int date;              // YYYYMMDD
+    int fleetIndex;        // position in the owning FleetStore
+    SeatOccupancy seats;
+    int* seatToSlot;       // rows * cols entries, -1 = seat empty
+    Passenger* manifest;   // booking order; a cancellation moves the last entry into the gap
+    int count;
+    int capacity;
+
+    void growManifest();
+    int fill(int r, int c, const std::string& id, const std::string& name, const std::string& cls);
+
+    // Books the first free seat; returns the manifest slot or -1 when full
+    int book(const std::string& id, const std::string& name, const std::string& cls);
+    // Books one seat (0-indexed); -1 if it is taken, blocked or outside the layout
+    int bookSeat(int r, int c, const std::string& id, const std::string& name, const std::string& cls);
+    // Removes a slot; returns the slot whose passenger moved into it, or -1
+    int remove(int slot);
+
+public:
+    FlightShard(const std::string& number, int flightDate, const AircraftLayout& layout);
+    ~FlightShard();
+
+    FlightShard(const FlightShard&) = delete;
+    FlightShard& operator=(const FlightShard&) = delete;
+
+    const std::string& getFlightNumber() const { return flightNumber; }
+    int getDate() const { return date; }
+    int getPassengerCount() const { return count; }
+    int getAvailableSeats() const { return seats.countAvailable(); }
+    const Passenger& at(int slot) const { return manifest[slot]; }
+
+    // Passenger in a seat (1-indexed row, letter column), or nullptr
+    const Passenger* findBySeat(int row, char column) const;
+};
+
+class FleetStore {
+private:
+    // Open-addressing slot of the global passenger index (linear probing)
+    struct IdEntry {
+        std::string id;
+        uint32_t hash;
+        int shard;       // -1 = empty slot
+        int slot;
+    };
+
+    HeapAccount heap;        // shards: seat maps, seat indexes, manifests
+    HeapAccount indexHeap;   // flight directory + global passenger index
+
+    FlightShard** shards;
+    int shardCount;
+    int shardCapacity;
+
+    int* directory;          // shard index per slot, -1 = empty (power-of-two size)
+    int directoryCapacity;
+
+    IdEntry* idTable;        // power-of-two size, kept under 70% full
+    int idCapacity;
+    int idCount;
+    long nextID;
+
+    void growDirectory();
+    void growIdTable();
+    int findIdSlot(const std::string& id, uint32_t hash) const;
+    void insertId(const std::string& id, int shard, int slot);
+    void eraseIdSlot(int tableSlot);
+
+public:
+    explicit FleetStore(long firstPassengerID = 1);
+    ~FleetStore();
+
+    FleetStore(const FleetStore&) = delete;
+    FleetStore& operator=(const FleetStore&) = delete;
+
+    // --- FLIGHTS ---
+    // nullptr if the flight already exists
+    FlightShard* addFlight(const std::string& flightNumber, int date,
+                           const AircraftLayout& layout = activeLayout());
+    FlightShard* findFlight(const std::string& flightNumber, int date) const;
+    int getFlightCount() const { return shardCount; }
+    FlightShard* getFlight(int index) const { return shards[index]; }
+
+    // --- PASSENGERS ---
+    // Assigns a fleet-wide unique ID and the flight's first free seat
+    bool book(FlightShard* flight, const std::string& name, const std::string& cls, Passenger& out);
+    // Restores an existing booking with its own ID and seat (e.g. from a dataset);
+    // false if the seat is unavailable or the ID is already booked
+    bool place(FlightShard* flight, const Passenger& p);
+    bool cancel(const std::string& passengerID);
+    // Cross-flight lookup through the global ID index
+    const Passenger* findPassenger(const std::string& passengerID,
+                                   const FlightShard** flightOut = nullptr) const;
+    int getPassengerCount() const { return idCount; }
+
+    // --- MEMORY ---
+    HeapStats shardHeapStats() const { return heap.stats(); }
+    HeapStats indexHeapStats() const { return indexHeap.stats(); }
+};
+
+#endif
@@ -0,0 +1,212 @@
+#include "HeapTracker.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#define HEAP_USABLE_SIZE(p) _msize(p)
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#define HEAP_USABLE_SIZE(p) malloc_size(p)
+#elif defined(__GLIBC__)
+#include <malloc.h>
+#define HEAP_USABLE_SIZE(p) malloc_usable_size(p)
+#endif
+
+// ==================== ACCOUNT REGISTRY ====================
+
+// Fixed table so the allocator never allocates; slot 0 means "untracked".
+// Generations make blocks that outlive their account harmless on free.
+static const int MAX_HEAP_ACCOUNTS = 256;
+
+struct AccountSlot {
+    std::atomic<unsigned> generation;
+    std::atomic<int> parent;
+    std::atomic<size_t> liveBytes;
+    std::atomic<size_t> footprintBytes;
+    std::atomic<size_t> liveBlocks;
+    std::atomic<size_t> peakBytes;
+    std::atomic<size_t> totalAllocations;
+    bool inUse;
+};
+
+static AccountSlot accountSlots[MAX_HEAP_ACCOUNTS];
+static std::mutex registryMutex;
+static thread_local int currentSlot = 0;
+static thread_local size_t threadAllocations = 0;
+static thread_local size_t threadFrees = 0;
+
+// Block header; 16 bytes keeps the user pointer at malloc's alignment
+struct BlockHeader {
+    uint32_t slot;
+    uint32_t generation;
+    uint64_t size;
+};
+static const size_t HEADER_SIZE = 16;
+static_assert(sizeof(BlockHeader) <= HEADER_SIZE, "block header must fit");
+
+// What the allocator really spends on a request of `size` bytes
+static size_t footprintOf(void* raw, size_t size) {
+#ifdef HEAP_USABLE_SIZE
+    size_t usable = HEAP_USABLE_SIZE(raw);
+    size_t inner = usable > HEADER_SIZE ? usable - HEADER_SIZE : size;
+    return (inner > size ? inner : size) + sizeof(size_t);
+#else
+    (void)raw;
+    return ((size + sizeof(size_t) + 15) / 16) * 16;
+#endif
+}
+
+static void creditAllocation(int slot, size_t size, size_t footprint) {
+    while (slot > 0) {
+        AccountSlot& s = accountSlots[slot];
+        size_t live = s.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        s.footprintBytes.fetch_add(footprint, std::memory_order_relaxed);
+        s.liveBlocks.fetch_add(1, std::memory_order_relaxed);
+        s.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+
+        size_t peak = s.peakBytes.load(std::memory_order_relaxed);
+        while (live > peak && !s.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+        slot = s.parent.load(std::memory_order_relaxed);
+    }
+}
+
+static void debitAllocation(int slot, size_t size, size_t footprint) {
+    while (slot > 0) {
+        AccountSlot& s = accountSlots[slot];
+        s.liveBytes.fetch_sub(size, std::memory_order_relaxed);
+        s.footprintBytes.fetch_sub(footprint, std::memory_order_relaxed);
+        s.liveBlocks.fetch_sub(1, std::memory_order_relaxed);
+        slot = s.parent.load(std::memory_order_relaxed);
+    }
+}
+
+// ==================== HEAP ACCOUNT / SCOPE ====================
+
+HeapAccount::HeapAccount(HeapAccount* parent) : slot(0), generation(0) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (int i = 1; i < MAX_HEAP_ACCOUNTS; i++) {
+        AccountSlot& s = accountSlots[i];
+        if (s.inUse) continue;
+
+        s.inUse = true;
+        s.parent.store(parent ? parent->slot : 0);
+        s.liveBytes.store(0);
+        s.footprintBytes.store(0);
+        s.liveBlocks.store(0);
+        s.peakBytes.store(0);
+        s.totalAllocations.store(0);
+        generation = s.generation.load();
+        slot = i;
+        break;
+    }
+}
+
+HeapAccount::~HeapAccount() {
+    if (slot == 0) return;
+    std::lock_guard<std::mutex> lock(registryMutex);
+    accountSlots[slot].generation.fetch_add(1);  // orphan any blocks still alive
+    accountSlots[slot].inUse = false;
+}
+
+HeapStats HeapAccount::stats() const {
+    HeapStats result;
+    if (slot == 0) return result;
+
+    const AccountSlot& s = accountSlots[slot];
+    result.liveBytes = s.liveBytes.load(std::memory_order_relaxed);
+    result.footprintBytes = s.footprintBytes.load(std::memory_order_relaxed);
+    result.liveBlocks = s.liveBlocks.load(std::memory_order_relaxed);
+    result.peakBytes = s.peakBytes.load(std::memory_order_relaxed);
+    result.totalAllocations = s.totalAllocations.load(std::memory_order_relaxed);
+    return result;
+}
+
+HeapScope::HeapScope(HeapAccount& account) : previousSlot(currentSlot) {
+    currentSlot = account.slot;
+}
+
+HeapScope::~HeapScope() {
+    currentSlot = previousSlot;
+}
+
+HeapOpCounts threadHeapOps() {
+    HeapOpCounts counts;
+    counts.allocations = threadAllocations;
+    counts.frees = threadFrees;
+    return counts;
+}
+
+// ==================== GLOBAL OPERATOR NEW / DELETE ====================
+
+static void* trackedAlloc(size_t size) {
+    void* raw = std::malloc(size + HEADER_SIZE);
+    if (!raw) return nullptr;
+    threadAllocations++;
+
+    BlockHeader* header = static_cast<BlockHeader*>(raw);
+    int slot = currentSlot;
+    header->slot = (uint32_t)slot;
+    header->generation = slot > 0 ? accountSlots[slot].generation.load(std::memory_order_relaxed) : 0;
+    header->size = size;
+
+    if (slot > 0) creditAllocation(slot, size, footprintOf(raw, size));
+    return static_cast<char*>(raw) + HEADER_SIZE;
+}
+
+static void trackedFree(void* ptr) {
+    if (!ptr) return;
+    threadFrees++;
+
+    void* raw = static_cast<char*>(ptr) - HEADER_SIZE;
+    BlockHeader* header = static_cast<BlockHeader*>(raw);
+    int slot = (int)header->slot;
+    if (slot > 0 && slot < MAX_HEAP_ACCOUNTS &&
+        accountSlots[slot].generation.load(std::memory_order_relaxed) == header->generation) {
+        size_t size = (size_t)header->size;
+        debitAllocation(slot, size, footprintOf(raw, size));
+    }
+    std::free(raw);
+}
+
+// Standard new semantics: retry through the new-handler, then throw
+static void* allocOrThrow(size_t size) {
+    if (size == 0) size = 1;
+    for (;;) {
+        void* p = trackedAlloc(size);
+        if (p) return p;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* operator new(size_t size) { return allocOrThrow(size); }
+void* operator new[](size_t size) { return allocOrThrow(size); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocOrThrow(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocOrThrow(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
@@ -0,0 +1,65 @@
+#ifndef HEAP_TRACKER_HPP
+#define HEAP_TRACKER_HPP
+
+#include <cstddef>
+
+// Instrumented heap accounting.
+// HeapTracker.cpp replaces the global operator new/delete. Every block gets a
+// small header naming the account that was active (via HeapScope) when it was
+// allocated, so frees are credited back to the right data structure no matter
+// where they happen. Child accounts (e.g. an index inside a larger structure)
+// also roll up into their parent.
+
+// Snapshot of one account
+struct HeapStats {
+    size_t liveBytes;         // bytes requested by live allocations
+    size_t footprintBytes;    // live bytes plus allocator rounding and chunk headers
+    size_t liveBlocks;        // live allocation count
+    size_t peakBytes;         // high-water mark of liveBytes
+    size_t totalAllocations;  // allocations made over the account's lifetime
+
+    HeapStats() : liveBytes(0), footprintBytes(0), liveBlocks(0), peakBytes(0), totalAllocations(0) {}
+};
+
+// One per data structure instance. Declare it before the members whose
+// allocations it should own so it is destroyed after them.
+class HeapAccount {
+private:
+    int slot;        // 0 = untracked (registry full)
+    unsigned generation;
+
+public:
+    explicit HeapAccount(HeapAccount* parent = nullptr);
+    ~HeapAccount();
+
+    HeapStats stats() const;
+
+    HeapAccount(const HeapAccount&) = delete;
+    HeapAccount& operator=(const HeapAccount&) = delete;
+
+    friend class HeapScope;
+};
+
+// Attributes allocations on this thread to `account` until destroyed (nestable)
+class HeapScope {
+private:
+    int previousSlot;
+
+public:
+    explicit HeapScope(HeapAccount& account);
+    ~HeapScope();
+
+    HeapScope(const HeapScope&) = delete;
+    HeapScope& operator=(const HeapScope&) = delete;
+};
+
+// Heap operations made by the calling thread, tracked account or not.
+// Take one before and one after a piece of work to count what it allocated.
+struct HeapOpCounts {
+    size_t allocations;
+    size_t frees;
+};
+
+HeapOpCounts threadHeapOps();
+
+#endif
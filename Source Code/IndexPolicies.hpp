@@ -0,0 +1,453 @@
+#ifndef INDEX_POLICIES_HPP
+#define INDEX_POLICIES_HPP
+
+#include "Passenger.hpp"
+#include "Prefetch.hpp"
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+
+// ID index policies for PassengerSystem. Entries map a passenger ID to the
+// record's current address; duplicate IDs are kept as separate entries and
+// told apart by address.
+//
+//   bool find(id, out) const     false = the index cannot answer, scan instead
+//   void insert(id, p)
+//   void erase(id, p)
+//   void update(id, from, to)    the record moved
+//   void clear()
+
+// ==================== NO INDEX ====================
+
+class NoIndex {
+public:
+    static const char* name() { return "none"; }
+
+    bool find(const std::string&, Passenger*&) const { return false; }
+    void insert(const std::string&, Passenger*) {}
+    void erase(const std::string&, Passenger*) {}
+    void update(const std::string&, Passenger*, Passenger*) {}
+    void clear() {}
+};
+
+// ==================== DENSE (DIRECT-ADDRESS) INDEX ====================
+
+// Numeric IDs below DENSE_ID_LIMIT index a pointer table directly. Any other
+// ID (or a second record with the same ID) is left out and marks the index
+// incomplete, so misses fall back to a scan.
+class DenseIndex {
+public:
+    static const long DENSE_ID_LIMIT = 1L << 22;
+
+private:
+    Passenger** slots;
+    long capacity;
+    bool complete;   // every inserted record is in `slots`
+
+    static long slotFor(const std::string& id) {
+        if (id.empty() || id.size() > 9) return -1;
+        long value = 0;
+        for (char c : id) {
+            if (c < '0' || c > '9') return -1;
+            value = value * 10 + (c - '0');
+        }
+        return value < DENSE_ID_LIMIT ? value : -1;
+    }
+
+    void grow(long needed) {
+        long newCapacity = capacity < 1024 ? 1024 : capacity;
+        while (newCapacity <= needed) newCapacity *= 2;
+        Passenger** grown = new Passenger*[newCapacity];
+        for (long i = 0; i < capacity; i++) grown[i] = slots[i];
+        for (long i = capacity; i < newCapacity; i++) grown[i] = nullptr;
+        delete[] slots;
+        slots = grown;
+        capacity = newCapacity;
+    }
+
+public:
+    static const char* name() { return "dense"; }
+
+    DenseIndex() : slots(nullptr), capacity(0), complete(true) {}
+    ~DenseIndex() { delete[] slots; }
+
+    DenseIndex(const DenseIndex&) = delete;
+    DenseIndex& operator=(const DenseIndex&) = delete;
+
+    bool find(const std::string& id, Passenger*& out) const {
+        long slot = slotFor(id);
+        out = (slot >= 0 && slot < capacity) ? slots[slot] : nullptr;
+        return out != nullptr || complete;
+    }
+
+    void insert(const std::string& id, Passenger* p) {
+        long slot = slotFor(id);
+        if (slot < 0) {
+            complete = false;
+            return;
+        }
+        if (slot >= capacity) grow(slot);
+        if (slots[slot]) complete = false;   // duplicate: only the first is indexed
+        else slots[slot] = p;
+    }
+
+    void erase(const std::string& id, Passenger* p) {
+        long slot = slotFor(id);
+        if (slot >= 0 && slot < capacity && slots[slot] == p) slots[slot] = nullptr;
+    }
+
+    void update(const std::string& id, Passenger* from, Passenger* to) {
+        long slot = slotFor(id);
+        if (slot >= 0 && slot < capacity && slots[slot] == from) slots[slot] = to;
+    }
+
+    void clear() {
+        delete[] slots;
+        slots = nullptr;
+        capacity = 0;
+        complete = true;
+    }
+};
+
+// ==================== HASH INDEX ====================
+
+// Open addressing with linear probing (power-of-two table, under 70% full);
+// backward-shift deletion keeps probe chains intact without tombstones
+class HashIndex {
+public:
+    static const int BATCH_WIDTH = 16;   // home slots prefetched ahead in findBatch()
+
+private:
+    struct Entry {
+        std::string id;
+        uint32_t hash;
+        Passenger* value;   // nullptr = empty slot
+    };
+
+    Entry* table;
+    uint32_t mask;
+    int count;
+
+    static uint32_t hashOf(const std::string& id) {
+        uint32_t h = 2166136261u;
+        for (char c : id) {
+            h ^= (unsigned char)c;
+            h *= 16777619u;
+        }
+        h ^= h >> 16;
+        h *= 0x45d9f3bu;
+        h ^= h >> 16;
+        return h;
+    }
+
+    void grow() {
+        uint32_t newSize = table ? (mask + 1) * 2 : 1024;
+        Entry* grown = new Entry[newSize];
+        for (uint32_t i = 0; i < newSize; i++) grown[i].value = nullptr;
+        if (table) {
+            // Old slots in order keep equal IDs in insertion order along each chain
+            for (uint32_t i = 0; i <= mask; i++) {
+                Entry& e = table[i];
+                if (!e.value) continue;
+                uint32_t pos = e.hash & (newSize - 1);
+                while (grown[pos].value) pos = (pos + 1) & (newSize - 1);
+                grown[pos].id.swap(e.id);
+                grown[pos].hash = e.hash;
+                grown[pos].value = e.value;
+            }
+        }
+        delete[] table;
+        table = grown;
+        mask = newSize - 1;
+    }
+
+    // Slot holding (id, p), or (id, any) when p is nullptr; -1 if none
+    long slotOf(const std::string& id, Passenger* p) const {
+        return table ? slotOf(id, hashOf(id), p) : -1;
+    }
+
+    long slotOf(const std::string& id, uint32_t hash, Passenger* p) const {
+        for (uint32_t pos = hash & mask; table[pos].value; pos = (pos + 1) & mask) {
+            const Entry& e = table[pos];
+            if (e.hash == hash && (!p || e.value == p) && e.id == id) return (long)pos;
+        }
+        return -1;
+    }
+
+public:
+    static const char* name() { return "hash"; }
+
+    HashIndex() : table(nullptr), mask(0), count(0) {}
+    ~HashIndex() { delete[] table; }
+
+    HashIndex(const HashIndex&) = delete;
+    HashIndex& operator=(const HashIndex&) = delete;
+
+    bool find(const std::string& id, Passenger*& out) const {
+        long slot = slotOf(id, nullptr);
+        out = slot >= 0 ? table[slot].value : nullptr;
+        return true;
+    }
+
+    // Same results as find() per ID. Each group of BATCH_WIDTH IDs is hashed
+    // and its home slots prefetched before any is probed, so the table's
+    // cache misses overlap instead of queueing.
+    void findBatch(const std::string* ids, int count, Passenger** out) const {
+        uint32_t hashes[BATCH_WIDTH];
+        for (int base = 0; base < count; base += BATCH_WIDTH) {
+            int n = count - base < BATCH_WIDTH ? count - base : BATCH_WIDTH;
+            if (!table) {
+                for (int k = 0; k < n; k++) out[base + k] = nullptr;
+                continue;
+            }
+            for (int k = 0; k < n; k++) {
+                hashes[k] = hashOf(ids[base + k]);
+                prefetchRead(&table[hashes[k] & mask]);
+            }
+            for (int k = 0; k < n; k++) {
+                long slot = slotOf(ids[base + k], hashes[k], nullptr);
+                out[base + k] = slot >= 0 ? table[slot].value : nullptr;
+            }
+        }
+    }
+
+    void insert(const std::string& id, Passenger* p) {
+        if (!table || (uint32_t)(count + 1) * 10 > (mask + 1) * 7) grow();
+        uint32_t hash = hashOf(id);
+        uint32_t pos = hash & mask;
+        while (table[pos].value) pos = (pos + 1) & mask;
+        table[pos].id = id;
+        table[pos].hash = hash;
+        table[pos].value = p;
+        count++;
+    }
+
+    void erase(const std::string& id, Passenger* p) {
+        long slot = slotOf(id, p);
+        if (slot < 0) return;
+
+        uint32_t hole = (uint32_t)slot;
+        for (uint32_t pos = (hole + 1) & mask; table[pos].value; pos = (pos + 1) & mask) {
+            uint32_t home = table[pos].hash & mask;
+            // Move the entry back if its home is not within (hole, pos]
+            if (((pos - home) & mask) >= ((pos - hole) & mask)) {
+                table[hole].id.swap(table[pos].id);
+                table[hole].hash = table[pos].hash;
+                table[hole].value = table[pos].value;
+                hole = pos;
+            }
+        }
+        table[hole].value = nullptr;
+        table[hole].id.clear();
+        count--;
+    }
+
+    void update(const std::string& id, Passenger* from, Passenger* to) {
+        long slot = slotOf(id, from);
+        if (slot >= 0) table[slot].value = to;
+    }
+
+    void clear() {
+        delete[] table;
+        table = nullptr;
+        mask = 0;
+        count = 0;
+    }
+};
+
+// ==================== B-TREE INDEX ====================
+
+// B+ tree ordered by ID: BTREE_ORDER entries per leaf, BTREE_ORDER children per
+// inner node, leaves chained left to right. Erasing does not rebalance; leaves
+// may become underfull or empty, which lookups skip over. clear() reclaims.
+class BTreeIndex {
+public:
+    static const int BTREE_ORDER = 32;
+
+private:
+    struct Node {
+        bool leaf;
+        int count;                          // entries (leaf) or children (inner)
+        std::string keys[BTREE_ORDER];      // leaf: entry IDs; inner: keys[i] splits children i and i+1
+        Passenger* values[BTREE_ORDER];     // leaf only
+        Node* children[BTREE_ORDER];        // inner only
+        Node* next;                         // next leaf
+
+        explicit Node(bool isLeaf) : leaf(isLeaf), count(0), next(nullptr) {}
+    };
+
+    Node* root;
+
+    static void destroy(Node* node) {
+        if (!node) return;
+        if (!node->leaf) {
+            for (int i = 0; i < node->count; i++) destroy(node->children[i]);
+        }
+        delete node;
+    }
+
+    // Leftmost leaf that can hold `id` (equal IDs may continue in later leaves)
+    Node* firstLeafFor(const std::string& id) const {
+        Node* node = root;
+        while (node && !node->leaf) {
+            int i = 0;
+            while (i < node->count - 1 && node->keys[i] < id) i++;
+            node = node->children[i];
+        }
+        return node;
+    }
+
+    // Entry (id, p), or (id, any) when p is nullptr
+    bool locate(const std::string& id, Passenger* p, Node*& leafOut, int& indexOut) const {
+        for (Node* leaf = firstLeafFor(id); leaf; leaf = leaf->next) {
+            for (int i = 0; i < leaf->count; i++) {
+                if (id < leaf->keys[i]) return false;
+                if (leaf->keys[i] == id && (!p || leaf->values[i] == p)) {
+                    leafOut = leaf;
+                    indexOut = i;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Inserts below `node`; returns the new right sibling if `node` split
+    Node* insertBelow(Node* node, const std::string& id, Passenger* p, std::string& separator) {
+        if (node->leaf) {
+            int pos = node->count;
+            while (pos > 0 && id < node->keys[pos - 1]) pos--;   // after equal IDs
+            if (node->count < BTREE_ORDER) {
+                for (int i = node->count; i > pos; i--) {
+                    node->keys[i].swap(node->keys[i - 1]);
+                    node->values[i] = node->values[i - 1];
+                }
+                node->keys[pos] = id;
+                node->values[pos] = p;
+                node->count++;
+                return nullptr;
+            }
+
+            // Full: split the BTREE_ORDER + 1 entries in half
+            std::string keys[BTREE_ORDER + 1];
+            Passenger* values[BTREE_ORDER + 1];
+            for (int i = 0, j = 0; i <= BTREE_ORDER; i++) {
+                if (i == pos) {
+                    keys[i] = id;
+                    values[i] = p;
+                } else {
+                    keys[i].swap(node->keys[j]);
+                    values[i] = node->values[j++];
+                }
+            }
+            int leftCount = (BTREE_ORDER + 1) / 2;
+            Node* right = new Node(true);
+            for (int i = 0; i < leftCount; i++) {
+                node->keys[i].swap(keys[i]);
+                node->values[i] = values[i];
+            }
+            for (int i = leftCount; i <= BTREE_ORDER; i++) {
+                right->keys[i - leftCount].swap(keys[i]);
+                right->values[i - leftCount] = values[i];
+            }
+            node->count = leftCount;
+            right->count = BTREE_ORDER + 1 - leftCount;
+            right->next = node->next;
+            node->next = right;
+            separator = right->keys[0];
+            return right;
+        }
+
+        int child = 0;
+        while (child < node->count - 1 && !(id < node->keys[child])) child++;
+        std::string childSeparator;
+        Node* split = insertBelow(node->children[child], id, p, childSeparator);
+        if (!split) return nullptr;
+
+        if (node->count < BTREE_ORDER) {
+            for (int i = node->count; i > child + 1; i--) {
+                node->children[i] = node->children[i - 1];
+                node->keys[i - 1].swap(node->keys[i - 2]);
+            }
+            node->children[child + 1] = split;
+            node->keys[child].swap(childSeparator);
+            node->count++;
+            return nullptr;
+        }
+
+        // Full inner node: BTREE_ORDER + 1 children, the middle key moves up
+        Node* children[BTREE_ORDER + 1];
+        std::string keys[BTREE_ORDER];
+        for (int i = 0, j = 0; i <= BTREE_ORDER; i++) {
+            children[i] = (i == child + 1) ? split : node->children[j++];
+        }
+        for (int i = 0, j = 0; i < BTREE_ORDER; i++) {
+            if (i == child) keys[i].swap(childSeparator);
+            else keys[i].swap(node->keys[j++]);
+        }
+        int leftChildren = (BTREE_ORDER + 1) / 2;
+        Node* right = new Node(false);
+        for (int i = 0; i < leftChildren; i++) node->children[i] = children[i];
+        for (int i = 0; i < leftChildren - 1; i++) node->keys[i].swap(keys[i]);
+        separator.swap(keys[leftChildren - 1]);
+        for (int i = leftChildren; i <= BTREE_ORDER; i++) right->children[i - leftChildren] = children[i];
+        for (int i = leftChildren; i < BTREE_ORDER; i++) right->keys[i - leftChildren].swap(keys[i]);
+        node->count = leftChildren;
+        right->count = BTREE_ORDER + 1 - leftChildren;
+        return right;
+    }
+
+public:
+    static const char* name() { return "btree"; }
+
+    BTreeIndex() : root(nullptr) {}
+    ~BTreeIndex() { destroy(root); }
+
+    BTreeIndex(const BTreeIndex&) = delete;
+    BTreeIndex& operator=(const BTreeIndex&) = delete;
+
+    bool find(const std::string& id, Passenger*& out) const {
+        Node* leaf;
+        int index;
+        out = locate(id, nullptr, leaf, index) ? leaf->values[index] : nullptr;
+        return true;
+    }
+
+    void insert(const std::string& id, Passenger* p) {
+        if (!root) root = new Node(true);
+        std::string separator;
+        Node* split = insertBelow(root, id, p, separator);
+        if (split) {
+            Node* top = new Node(false);
+            top->children[0] = root;
+            top->children[1] = split;
+            top->keys[0].swap(separator);
+            top->count = 2;
+            root = top;
+        }
+    }
+
+    void erase(const std::string& id, Passenger* p) {
+        Node* leaf;
+        int index;
+        if (!locate(id, p, leaf, index)) return;
+        for (int i = index; i + 1 < leaf->count; i++) {
+            leaf->keys[i].swap(leaf->keys[i + 1]);
+            leaf->values[i] = leaf->values[i + 1];
+        }
+        leaf->keys[--leaf->count].clear();
+    }
+
+    void update(const std::string& id, Passenger* from, Passenger* to) {
+        Node* leaf;
+        int index;
+        if (locate(id, from, leaf, index)) leaf->values[index] = to;
+    }
+
+    void clear() {
+        destroy(root);
+        root = nullptr;
+    }
+};
+
+#endif
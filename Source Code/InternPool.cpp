@@ -0,0 +1,112 @@
+#include "InternPool.hpp"
+#include <cstring>
+#include <new>
+
+static const uint32_t NOT_INTERNED = 0xFFFFFFFFu;
+static const uint32_t INITIAL_TABLE_SLOTS = 1024;   // power of two
+
+InternPool::InternPool() : count(0), table(nullptr) {
+    for (int i = 0; i < MAX_CHUNKS; i++) chunks[i] = nullptr;
+    {
+        HeapScope scope(heap);
+        table.store(newTable(INITIAL_TABLE_SLOTS, nullptr));
+    }
+    intern("", 0);   // handle 0
+}
+
+InternPool::~InternPool() {
+    Table* t = table.load();
+    while (t) {
+        Table* older = t->retired;
+        delete[] t->slots;
+        delete t;
+        t = older;
+    }
+    for (int i = 0; i < MAX_CHUNKS && chunks[i]; i++) delete[] chunks[i];
+}
+
+// FNV-1a
+uint32_t InternPool::hashOf(const char* s, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)s[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+InternPool::Table* InternPool::newTable(uint32_t capacity, Table* retired) {
+    Table* t = new Table;
+    t->slots = new std::atomic<uint32_t>[capacity];
+    for (uint32_t i = 0; i < capacity; i++) t->slots[i].store(0, std::memory_order_relaxed);
+    t->mask = capacity - 1;
+    t->retired = retired;
+    return t;
+}
+
+// Linear probing; the table is never more than half full, so a free slot ends
+// every miss. On a miss `slot` is where the string would go.
+uint32_t InternPool::probe(const Table* t, const char* s, size_t length, uint32_t hash, uint32_t& slot) const {
+    uint32_t i = hash & t->mask;
+    while (true) {
+        uint32_t entry = t->slots[i].load(std::memory_order_acquire);
+        if (entry == 0) {
+            slot = i;
+            return NOT_INTERNED;
+        }
+        const std::string& candidate = lookup(entry - 1);
+        if (candidate.size() == length && std::memcmp(candidate.data(), s, length) == 0) return entry - 1;
+        i = (i + 1) & t->mask;
+    }
+}
+
+uint32_t InternPool::intern(const std::string& s) {
+    return intern(s.data(), s.size());
+}
+
+uint32_t InternPool::intern(const char* s, size_t length) {
+    uint32_t hash = hashOf(s, length);
+    uint32_t slot;
+    uint32_t found = probe(table.load(std::memory_order_acquire), s, length, hash, slot);
+    if (found != NOT_INTERNED) return found;
+
+    // Another thread may have added it (or grown the table) since the probe
+    std::lock_guard<std::mutex> guard(insertLock);
+    Table* current = table.load(std::memory_order_relaxed);
+    found = probe(current, s, length, hash, slot);
+    if (found != NOT_INTERNED) return found;
+
+    int handle = count.load(std::memory_order_relaxed);
+    if (handle >= MAX_CHUNKS * CHUNK_STRINGS) throw std::bad_alloc();
+
+    HeapScope scope(heap);
+    std::string*& chunk = chunks[handle / CHUNK_STRINGS];
+    if (!chunk) chunk = new std::string[CHUNK_STRINGS];
+    chunk[handle % CHUNK_STRINGS].assign(s, length);
+
+    // The string is complete before any reader can find its handle
+    count.store(handle + 1, std::memory_order_release);
+    current->slots[slot].store((uint32_t)handle + 1, std::memory_order_release);
+    if ((uint32_t)(handle + 1) * 2 > current->mask + 1) grow();
+    return (uint32_t)handle;
+}
+
+// Called with insertLock held. Readers still probing the old table either
+// find their string there or fall through to the locked path.
+void InternPool::grow() {
+    Table* current = table.load(std::memory_order_relaxed);
+    Table* grown = newTable((current->mask + 1) * 2, current);
+    int n = count.load(std::memory_order_relaxed);
+    for (int handle = 0; handle < n; handle++) {
+        const std::string& s = lookup((uint32_t)handle);
+        uint32_t i = hashOf(s.data(), s.size()) & grown->mask;
+        while (grown->slots[i].load(std::memory_order_relaxed) != 0) i = (i + 1) & grown->mask;
+        grown->slots[i].store((uint32_t)handle + 1, std::memory_order_relaxed);
+    }
+    table.store(grown, std::memory_order_release);
+}
+
+InternPool& internPool() {
+    static InternPool pool;
+    return pool;
+}
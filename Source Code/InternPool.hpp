@@ -0,0 +1,126 @@
+#ifndef INTERN_POOL_HPP
+#define INTERN_POOL_HPP
+
+#include "HeapTracker.hpp"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+// String interning: every distinct string is stored once and passengers keep
+// a 4-byte handle to it. Names repeat heavily and seat classes take a handful
+// of values, so a record no longer carries its own copies.
+//
+// Strings are never removed (the pool is an arena) and never move, so a
+// handle resolves without locking. Lookups probe a published hash table
+// without locking; only inserting a new string takes the mutex. A table that
+// is outgrown is retired, not freed, because readers may still be probing it.
+
+class InternPool {
+public:
+    static const int CHUNK_STRINGS = 1024;   // strings per storage chunk
+    static const int MAX_CHUNKS = 16384;     // up to 16M distinct strings
+
+    InternPool();
+    ~InternPool();
+
+    InternPool(const InternPool&) = delete;
+    InternPool& operator=(const InternPool&) = delete;
+
+    // Handle of `s`, adding it on first sight. Handle 0 is the empty string.
+    uint32_t intern(const std::string& s);
+    uint32_t intern(const char* s, size_t length);
+
+    const std::string& lookup(uint32_t handle) const {
+        return chunks[handle / CHUNK_STRINGS][handle % CHUNK_STRINGS];
+    }
+
+    int getStringCount() const { return count.load(std::memory_order_acquire); }
+    HeapStats heapStats() const { return heap.stats(); }
+
+private:
+    struct Table {
+        std::atomic<uint32_t>* slots;   // handle + 1, 0 = free
+        uint32_t mask;
+        Table* retired;                 // older tables, freed with the pool
+    };
+
+    HeapAccount heap;                   // strings, chunks and tables
+    std::string* chunks[MAX_CHUNKS];
+    std::atomic<int> count;
+    std::atomic<Table*> table;
+    std::mutex insertLock;
+
+    static uint32_t hashOf(const char* s, size_t length);
+    static Table* newTable(uint32_t capacity, Table* retired);
+    uint32_t probe(const Table* t, const char* s, size_t length, uint32_t hash, uint32_t& slot) const;
+    void grow();
+};
+
+// The process-wide pool used by Passenger (all flights and structures share it)
+InternPool& internPool();
+
+// ==================== INTERNED STRING ====================
+
+// 4-byte handle with std::string-like reads. Equality between two handles is
+// one integer compare; ordering compares the text.
+class InternedString {
+private:
+    uint32_t handle;
+
+public:
+    InternedString() : handle(0) {}
+    InternedString(const std::string& s) : handle(s.empty() ? 0 : internPool().intern(s)) {}
+    InternedString(const char* s) : handle(*s ? internPool().intern(s, std::strlen(s)) : 0) {}
+
+    InternedString& operator=(const std::string& s) {
+        handle = s.empty() ? 0 : internPool().intern(s);
+        return *this;
+    }
+
+    InternedString& operator=(const char* s) {
+        handle = *s ? internPool().intern(s, std::strlen(s)) : 0;
+        return *this;
+    }
+
+    // From a raw buffer (binary loaders), without building a std::string
+    InternedString& assign(const char* s, size_t length) {
+        handle = length > 0 ? internPool().intern(s, length) : 0;
+        return *this;
+    }
+
+    const std::string& str() const { return internPool().lookup(handle); }
+    operator const std::string&() const { return str(); }
+    const char* c_str() const { return str().c_str(); }
+    const char* data() const { return str().data(); }
+    size_t size() const { return str().size(); }
+    size_t length() const { return str().size(); }
+    bool empty() const { return handle == 0; }
+    uint32_t getHandle() const { return handle; }
+
+    bool operator==(const InternedString& other) const { return handle == other.handle; }
+    bool operator!=(const InternedString& other) const { return handle != other.handle; }
+    bool operator<(const InternedString& other) const {
+        return handle != other.handle && str() < other.str();
+    }
+
+    bool operator==(const std::string& s) const { return str() == s; }
+    bool operator!=(const std::string& s) const { return str() != s; }
+    bool operator==(const char* s) const { return str() == s; }
+    bool operator!=(const char* s) const { return str() != s; }
+};
+
+inline bool operator==(const std::string& s, const InternedString& i) { return i == s; }
+inline bool operator!=(const std::string& s, const InternedString& i) { return i != s; }
+inline std::string operator+(const std::string& s, const InternedString& i) { return s + i.str(); }
+inline std::string operator+(const InternedString& i, const std::string& s) { return i.str() + s; }
+inline std::string operator+(const char* s, const InternedString& i) { return s + i.str(); }
+inline std::string operator+(const InternedString& i, const char* s) { return i.str() + s; }
+
+inline std::ostream& operator<<(std::ostream& out, const InternedString& i) {
+    return out << i.str();
+}
+
+#endif
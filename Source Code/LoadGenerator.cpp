@@ -0,0 +1,608 @@
+#include "LoadGenerator.hpp"
+#include "ServerProtocol.hpp"
+#include "Benchmark.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <chrono>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <cerrno>
+#endif
+
+// ==================== OPTIONS ====================
+
+static const int ID_POOL_PAGES = 64;   // manifest pages sampled for lookup keys
+static const int OP_SLOTS = OP_MANIFEST + 1;
+static const int STATUS_SLOTS = STATUS_NOT_SAVED + 1;
+
+struct LoadGenOptions {
+    std::string socketPath;
+    int port;
+    int connections;
+    int pipeline;
+    long requests;
+    int writePercent;
+    uint64_t seed;
+    int burst;   // > 0: run the pipelining check instead of the load
+
+    LoadGenOptions()
+        : port(7400), connections(4), pipeline(16), requests(100000), writePercent(10), seed(42), burst(0) {}
+};
+
+static bool parseLoadGenOptions(int argc, char** argv, LoadGenOptions& opts) {
+    for (int i = 0; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") return false;
+
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << "\n";
+            return false;
+        }
+        const char* value = argv[++i];
+
+        if (arg == "--socket") {
+            opts.socketPath = value;
+        } else if (arg == "--port") {
+            opts.port = std::atoi(value);
+        } else if (arg == "--connections") {
+            opts.connections = std::atoi(value);
+        } else if (arg == "--pipeline") {
+            opts.pipeline = std::atoi(value);
+        } else if (arg == "--requests") {
+            opts.requests = std::atol(value);
+        } else if (arg == "--write-pct") {
+            opts.writePercent = std::atoi(value);
+            if (opts.writePercent < 0 || opts.writePercent > 100) {
+                std::cerr << "--write-pct must be between 0 and 100\n";
+                return false;
+            }
+        } else if (arg == "--seed") {
+            opts.seed = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--burst") {
+            opts.burst = std::atoi(value);
+            if (opts.burst < 1) {
+                std::cerr << "--burst must be at least 1\n";
+                return false;
+            }
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            return false;
+        }
+    }
+    if (opts.connections < 1) opts.connections = 1;
+    if (opts.pipeline < 1) opts.pipeline = 1;
+    if (opts.requests < 1) opts.requests = 1;
+    return true;
+}
+
+void printLoadGenUsage() {
+    std::cout << "Usage: <program> --loadgen [options]\n"
+              << "  --socket PATH         connect to a Unix domain socket\n"
+              << "  --port N              connect to 127.0.0.1:N (default 7400)\n"
+              << "  --connections N       client connections (default 4)\n"
+              << "  --pipeline N          requests in flight per connection (default 16)\n"
+              << "  --requests N          total requests (default 100000)\n"
+              << "  --write-pct N         reservations + cancellations as a percentage (default 10)\n"
+              << "  --seed N              request mix seed (default 42)\n"
+              << "  --burst N             check: N pipelined full manifest pages on one connection\n";
+}
+
+#if defined(__linux__)
+
+// ==================== CONNECTIONS ====================
+
+// SplitMix64 step; the request mix is reproducible for a given seed
+static uint64_t loadRandom(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+struct ClientConnection {
+    int fd;
+    ByteBuffer in;
+    ByteBuffer out;
+    uint32_t events;
+    int inFlight;
+    std::string* bookings;   // own reservations not cancelled yet (stack)
+    int bookingCount;
+    int bookingCapacity;
+
+    ClientConnection() : fd(-1), events(0), inFlight(0), bookings(nullptr), bookingCount(0), bookingCapacity(0) {}
+    ~ClientConnection() {
+        if (fd >= 0) close(fd);
+        delete[] bookings;
+    }
+
+    void pushBooking(const std::string& id) {
+        if (bookingCount == bookingCapacity) {
+            int newCapacity = bookingCapacity == 0 ? 64 : bookingCapacity * 2;
+            std::string* grown = new std::string[newCapacity];
+            for (int i = 0; i < bookingCount; i++) grown[i].swap(bookings[i]);
+            delete[] bookings;
+            bookings = grown;
+            bookingCapacity = newCapacity;
+        }
+        bookings[bookingCount++] = id;
+    }
+};
+
+static int connectToServer(const LoadGenOptions& opts) {
+    int fd;
+    if (!opts.socketPath.empty()) {
+        sockaddr_un addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        if (opts.socketPath.size() >= sizeof(addr.sun_path)) return -1;
+        std::memcpy(addr.sun_path, opts.socketPath.c_str(), opts.socketPath.size() + 1);
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        if (connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0) {
+            close(fd);
+            return -1;
+        }
+    } else {
+        sockaddr_in addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons((uint16_t)opts.port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        if (connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0) {
+            close(fd);
+            return -1;
+        }
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    }
+    return fd;
+}
+
+// Blocking request/response on a fresh connection (setup only)
+static bool roundTrip(ClientConnection& conn) {
+    while (!conn.out.empty()) {
+        ssize_t n = send(conn.fd, conn.out.begin(), conn.out.size(), MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        conn.out.consume((size_t)n);
+    }
+    while (completeFrameLength(conn.in) == 0) {
+        unsigned char* dst = conn.in.prepare(16 * 1024);
+        ssize_t n = recv(conn.fd, dst, 16 * 1024, 0);
+        if (n <= 0) return false;
+        conn.in.commit((size_t)n);
+    }
+    return completeFrameLength(conn.in) > 0;
+}
+
+// Lookup keys: IDs and seats from manifest pages spread over the whole manifest
+static int fetchKeyPool(ClientConnection& conn, Passenger* pool, int poolCapacity) {
+    int count = 0;
+    uint32_t total = 1;
+    for (int page = 0; page < ID_POOL_PAGES && count < poolCapacity; page++) {
+        uint32_t offset = (uint32_t)((uint64_t)total * page / ID_POOL_PAGES);
+        FrameWriter request(conn.out, 0, OP_MANIFEST);
+        request.putU32(offset);
+        request.putU16(MANIFEST_PAGE_MAX);
+        request.finish();
+        if (!roundTrip(conn)) return -1;
+
+        long length = completeFrameLength(conn.in);
+        const unsigned char* frame = conn.in.begin();
+        FrameReader in(frame + 9, (size_t)length - 9);
+        if (frame[8] != STATUS_OK) return -1;
+        total = in.getU32();
+        int pageCount = (int)in.getU16();
+        for (int i = 0; i < pageCount && count < poolCapacity; i++) pool[count++] = in.getPassenger();
+        bool ok = in.ok();
+        conn.in.consume((size_t)length);
+        if (!ok) return -1;
+        if (total == 0) break;
+    }
+    return count;
+}
+
+// ==================== BURST CHECK ====================
+
+// Sends `count` full MANIFEST pages back to back, half-closes, and expects
+// every response in order followed by the server closing the connection.
+// Enough pages overrun the server's output high-water mark, so this covers
+// requests left buffered while it waits for the client to read.
+static bool runBurstCheck(ClientConnection& conn, int count) {
+    for (int i = 0; i < count; i++) {
+        FrameWriter request(conn.out, (uint32_t)i, OP_MANIFEST);
+        request.putU32(0);
+        request.putU16(MANIFEST_PAGE_MAX);
+        request.finish();
+    }
+    int flags = fcntl(conn.fd, F_GETFL, 0);
+    fcntl(conn.fd, F_SETFL, flags | O_NONBLOCK);
+
+    int received = 0;
+    long long bytes = 0;
+    bool closed = false;
+    bool halfClosed = false;
+    while (!closed) {
+        if (conn.out.empty() && !halfClosed) {
+            shutdown(conn.fd, SHUT_WR);
+            halfClosed = true;
+        }
+        pollfd pfd;
+        pfd.fd = conn.fd;
+        pfd.events = (short)(POLLIN | (conn.out.empty() ? 0 : POLLOUT));
+        int ready = poll(&pfd, 1, 5000);
+        if (ready < 0 && errno == EINTR) continue;
+        if (ready <= 0) {
+            std::cerr << "Burst stalled after " << received << " of " << count << " responses\n";
+            return false;
+        }
+
+        if (pfd.revents & POLLOUT) {
+            ssize_t n = send(conn.fd, conn.out.begin(), conn.out.size(), MSG_NOSIGNAL);
+            if (n > 0) conn.out.consume((size_t)n);
+            else if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) return false;
+        }
+        while (true) {
+            unsigned char* dst = conn.in.prepare(16 * 1024);
+            ssize_t n = recv(conn.fd, dst, 16 * 1024, 0);
+            if (n > 0) {
+                conn.in.commit((size_t)n);
+                bytes += n;
+                continue;
+            }
+            if (n == 0) closed = true;
+            else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) return false;
+            break;
+        }
+
+        while (true) {
+            long length = completeFrameLength(conn.in);
+            if (length < 0) return false;
+            if (length == 0) break;
+            const unsigned char* frame = conn.in.begin();
+            uint32_t requestID = (uint32_t)frame[4] | ((uint32_t)frame[5] << 8) |
+                                 ((uint32_t)frame[6] << 16) | ((uint32_t)frame[7] << 24);
+            if (requestID != (uint32_t)received || frame[8] != STATUS_OK) {
+                std::cerr << "Unexpected response " << requestID << " (status " << (int)frame[8]
+                          << ") at position " << received << "\n";
+                return false;
+            }
+            received++;
+            conn.in.consume((size_t)length);
+        }
+    }
+
+    std::cout << "Burst: " << received << " of " << count << " responses, " << bytes << " bytes\n";
+    if (received != count || !conn.in.empty()) {
+        std::cerr << "The server closed the connection before answering every request\n";
+        return false;
+    }
+    return true;
+}
+
+// ==================== RUN ====================
+
+struct LoadGenRun {
+    const LoadGenOptions& opts;
+    ClientConnection* conns;
+    int epollFd;
+    const Passenger* pool;
+    int poolCount;
+    uint64_t rng;
+
+    std::chrono::steady_clock::time_point start;
+    double* sentNs;              // per request ID
+    unsigned char* opcodes;      // per request ID
+    double* latencyNs;           // per completed request
+    unsigned char* latencyOps;
+    long issued;
+    long completed;
+    long statusCounts[OP_SLOTS][STATUS_SLOTS];
+    long otherStatuses;
+
+    explicit LoadGenRun(const LoadGenOptions& o)
+        : opts(o), conns(nullptr), epollFd(-1), pool(nullptr), poolCount(0), rng(o.seed),
+          issued(0), completed(0), otherStatuses(0) {
+        sentNs = new double[opts.requests];
+        opcodes = new unsigned char[opts.requests];
+        latencyNs = new double[opts.requests];
+        latencyOps = new unsigned char[opts.requests];
+        std::memset(statusCounts, 0, sizeof(statusCounts));
+    }
+
+    ~LoadGenRun() {
+        delete[] latencyOps;
+        delete[] latencyNs;
+        delete[] opcodes;
+        delete[] sentNs;
+    }
+
+    double nowNs() const { return elapsedNs(start, std::chrono::steady_clock::now()); }
+
+    void issue(ClientConnection& conn);
+    bool flush(ClientConnection& conn);
+    bool receive(ClientConnection& conn);
+    bool run();
+};
+
+// Queues one request from the mix
+void LoadGenRun::issue(ClientConnection& conn) {
+    uint32_t requestID = (uint32_t)issued;
+    uint64_t roll = loadRandom(rng);
+    int opcode;
+    if ((int)(roll % 100) < opts.writePercent) {
+        opcode = ((roll >> 8) & 1) && conn.bookingCount > 0 ? OP_CANCEL : OP_RESERVE;
+    } else {
+        int kind = (int)((roll >> 8) % 10);
+        opcode = kind < 6 ? OP_LOOKUP_ID : (kind < 9 ? OP_LOOKUP_SEAT : OP_MANIFEST);
+    }
+    const Passenger& key = pool[(roll >> 16) % (uint64_t)poolCount];
+
+    FrameWriter request(conn.out, requestID, opcode);
+    switch (opcode) {
+        case OP_RESERVE:
+            request.putString("Load Test " + std::to_string(requestID));
+            request.putString("Economy");
+            break;
+        case OP_CANCEL:
+            request.putString(conn.bookings[--conn.bookingCount]);
+            break;
+        case OP_LOOKUP_ID:
+            request.putString(key.passengerID);
+            break;
+        case OP_LOOKUP_SEAT:
+            request.putU16((uint32_t)key.seatRow);
+            request.putU8((unsigned char)key.seatColumn);
+            break;
+        default:
+            request.putU32((uint32_t)((roll >> 32) % 10000));
+            request.putU16(20);
+            break;
+    }
+    request.finish();
+
+    opcodes[requestID] = (unsigned char)opcode;
+    sentNs[requestID] = nowNs();
+    conn.inFlight++;
+    issued++;
+}
+
+bool LoadGenRun::flush(ClientConnection& conn) {
+    while (!conn.out.empty()) {
+        ssize_t n = send(conn.fd, conn.out.begin(), conn.out.size(), MSG_NOSIGNAL);
+        if (n > 0) {
+            conn.out.consume((size_t)n);
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) break;
+        return false;
+    }
+    uint32_t events = EPOLLIN | (conn.out.empty() ? 0u : (uint32_t)EPOLLOUT);
+    if (events != conn.events) {
+        epoll_event ev;
+        ev.events = events;
+        ev.data.ptr = &conn;
+        if (epoll_ctl(epollFd, EPOLL_CTL_MOD, conn.fd, &ev) != 0) return false;
+        conn.events = events;
+    }
+    return true;
+}
+
+// Reads what arrived and completes every whole response
+bool LoadGenRun::receive(ClientConnection& conn) {
+    while (true) {
+        unsigned char* dst = conn.in.prepare(16 * 1024);
+        ssize_t n = recv(conn.fd, dst, 16 * 1024, 0);
+        if (n > 0) {
+            conn.in.commit((size_t)n);
+            continue;
+        }
+        if (n == 0) return false;   // server went away
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) break;
+        return false;
+    }
+
+    double now = nowNs();
+    while (true) {
+        long length = completeFrameLength(conn.in);
+        if (length < 0) return false;
+        if (length == 0) return true;
+
+        const unsigned char* frame = conn.in.begin();
+        uint32_t requestID = (uint32_t)frame[4] | ((uint32_t)frame[5] << 8) |
+                             ((uint32_t)frame[6] << 16) | ((uint32_t)frame[7] << 24);
+        int status = frame[8];
+        if (requestID >= (uint32_t)issued) return false;
+
+        int opcode = opcodes[requestID];
+        if (opcode == OP_RESERVE && status == STATUS_OK) {
+            FrameReader in(frame + 9, (size_t)length - 9);
+            Passenger booked = in.getPassenger();
+            if (in.ok()) conn.pushBooking(booked.passengerID);
+        }
+        if (status < STATUS_SLOTS) statusCounts[opcode][status]++;
+        else otherStatuses++;
+
+        latencyNs[completed] = now - sentNs[requestID];
+        latencyOps[completed] = (unsigned char)opcode;
+        completed++;
+        conn.inFlight--;
+        conn.in.consume((size_t)length);
+    }
+}
+
+bool LoadGenRun::run() {
+    start = std::chrono::steady_clock::now();
+    epoll_event events[64];
+    while (completed < opts.requests) {
+        for (int c = 0; c < opts.connections; c++) {
+            ClientConnection& conn = conns[c];
+            while (conn.inFlight < opts.pipeline && issued < opts.requests) issue(conn);
+            if (!flush(conn)) return false;
+        }
+
+        int n = epoll_wait(epollFd, events, 64, 5000);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        if (n == 0) {
+            std::cerr << "No response for 5 s\n";
+            return false;
+        }
+        for (int i = 0; i < n; i++) {
+            ClientConnection& conn = *(ClientConnection*)events[i].data.ptr;
+            if ((events[i].events & EPOLLOUT) && !flush(conn)) return false;
+            if ((events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) && !receive(conn)) return false;
+        }
+    }
+    return true;
+}
+
+// ==================== REPORT ====================
+
+static void printLatencyRow(const char* label, double* samples, long count) {
+    BenchmarkResult r = summarizeSamples(samples, (int)count, 1);
+    std::cout << std::left << std::setw(13) << label
+              << std::right << std::setw(9) << count
+              << std::setw(11) << r.medianNs / 1000.0
+              << std::setw(11) << r.p99Ns / 1000.0
+              << std::setw(11) << r.p999Ns / 1000.0 << "\n";
+}
+
+static void printReport(LoadGenRun& run, double wallNs) {
+    const LoadGenOptions& opts = run.opts;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Requests: " << run.completed << " over " << opts.connections << " connections, pipeline "
+              << opts.pipeline << ", " << opts.writePercent << "% writes\n";
+    std::cout << "Elapsed: " << std::setprecision(3) << wallNs / 1e9 << " s   Throughput: "
+              << std::setprecision(0) << (wallNs > 0.0 ? run.completed * 1e9 / wallNs : 0.0)
+              << " requests/s\n\n";
+
+    std::cout << std::setprecision(1);
+    std::cout << std::left << std::setw(13) << "operation" << std::right << std::setw(9) << "count"
+              << std::setw(11) << "p50 us" << std::setw(11) << "p99 us" << std::setw(11) << "p999 us" << "\n";
+
+    double* samples = new double[run.completed > 0 ? run.completed : 1];
+    for (int op = OP_RESERVE; op < OP_SLOTS; op++) {
+        long count = 0;
+        for (long i = 0; i < run.completed; i++) {
+            if (run.latencyOps[i] == op) samples[count++] = run.latencyNs[i];
+        }
+        if (count > 0) printLatencyRow(opcodeName(op), samples, count);
+    }
+    for (long i = 0; i < run.completed; i++) samples[i] = run.latencyNs[i];
+    printLatencyRow("all", samples, run.completed);
+    delete[] samples;
+
+    std::cout << "\nStatuses:";
+    for (int status = 0; status < STATUS_SLOTS; status++) {
+        long total = 0;
+        for (int op = 0; op < OP_SLOTS; op++) total += run.statusCounts[op][status];
+        if (total > 0) std::cout << "  " << statusName(status) << " " << total;
+    }
+    if (run.otherStatuses > 0) std::cout << "  unknown " << run.otherStatuses;
+    std::cout << "\n";
+}
+
+// ==================== ENTRY POINT ====================
+
+int runLoadGenCli(int argc, char** argv) {
+    LoadGenOptions opts;
+    if (!parseLoadGenOptions(argc, argv, opts)) {
+        printLoadGenUsage();
+        return 2;
+    }
+
+    if (opts.burst > 0) {
+        ClientConnection conn;
+        conn.fd = connectToServer(opts);
+        if (conn.fd < 0) {
+            std::cerr << "Could not connect: " << std::strerror(errno) << "\n";
+            return 1;
+        }
+        return runBurstCheck(conn, opts.burst) ? 0 : 1;
+    }
+
+    ClientConnection* conns = new ClientConnection[opts.connections];
+    for (int c = 0; c < opts.connections; c++) {
+        conns[c].fd = connectToServer(opts);
+        if (conns[c].fd < 0) {
+            std::cerr << "Could not connect: " << std::strerror(errno) << "\n";
+            delete[] conns;
+            return 1;
+        }
+    }
+
+    Passenger* pool = new Passenger[ID_POOL_PAGES * MANIFEST_PAGE_MAX];
+    int poolCount = fetchKeyPool(conns[0], pool, ID_POOL_PAGES * MANIFEST_PAGE_MAX);
+    if (poolCount <= 0) {
+        std::cerr << (poolCount < 0 ? "Manifest request failed\n" : "The server has no passengers to look up\n");
+        delete[] pool;
+        delete[] conns;
+        return 1;
+    }
+
+    int status = 0;
+    {
+        LoadGenRun run(opts);
+        run.conns = conns;
+        run.pool = pool;
+        run.poolCount = poolCount;
+        run.epollFd = epoll_create1(0);
+        for (int c = 0; c < opts.connections; c++) {
+            int flags = fcntl(conns[c].fd, F_GETFL, 0);
+            fcntl(conns[c].fd, F_SETFL, flags | O_NONBLOCK);
+            epoll_event ev;
+            ev.events = EPOLLIN;
+            ev.data.ptr = &conns[c];
+            epoll_ctl(run.epollFd, EPOLL_CTL_ADD, conns[c].fd, &ev);
+            conns[c].events = EPOLLIN;
+        }
+
+        bool finished = run.run();
+        double wallNs = run.nowNs();
+        close(run.epollFd);
+        if (!finished) {
+            std::cerr << "Connection failed after " << run.completed << " of " << opts.requests << " responses\n";
+            status = 1;
+        }
+        printReport(run, wallNs);
+
+        for (int op = 0; op < OP_SLOTS; op++) {
+            if (run.statusCounts[op][STATUS_BAD_REQUEST] > 0 || run.statusCounts[op][STATUS_NOT_SAVED] > 0) status = 1;
+        }
+        if (run.otherStatuses > 0) status = 1;
+    }
+
+    delete[] pool;
+    delete[] conns;
+    return status;
+}
+
+#else
+
+int runLoadGenCli(int argc, char** argv) {
+    LoadGenOptions opts;
+    if (!parseLoadGenOptions(argc, argv, opts)) {
+        printLoadGenUsage();
+        return 2;
+    }
+    std::cerr << "The load generator needs Linux (epoll)\n";
+    return 1;
+}
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef LOAD_GENERATOR_HPP
+#define LOAD_GENERATOR_HPP
+
+// Load generator for the reservation server: `<program> --loadgen [options]`.
+// Fetches passenger IDs and seats through manifest pages, then drives a mix
+// of lookups by ID and seat, manifest pages, reservations and cancellations
+// over several connections, keeping a fixed number of requests in flight on
+// each (pipelining). Cancellations only target its own earlier bookings.
+// Reports throughput and p50/p99/p999 latency per operation (Linux only).
+//
+// Options:
+//   --socket PATH         connect to a Unix domain socket
+//   --port N              connect to 127.0.0.1:N (default 7400 unless --socket)
+//   --connections N       client connections (default 4)
+//   --pipeline N          requests in flight per connection (default 16)
+//   --requests N          total requests (default 100000)
+//   --write-pct N         reservations + cancellations as a percentage (default 10)
+//   --seed N              request mix seed (default 42)
+//   --burst N             instead of the load: N full manifest pages pipelined
+//                         on one connection, then a half-close; checks that all
+//                         N responses arrive in order before the server closes
+// Returns a process exit code (0 on success, 1 if any request failed).
+int runLoadGenCli(int argc, char** argv);
+
+void printLoadGenUsage();
+
+#endif
@@ -1,136 +1,243 @@
-#include <iostream>
-#include <chrono>
-#include <string>
-#include <iomanip>
-#include <cstring>
-#include "Passenger.hpp" 
-#include "Reservation_Menu.hpp" 
-#include "Cancellation.hpp"
-#include "Cancellation_Menu.hpp"
-#include "Search_Menu.hpp"
-#include "Seat_Manifest.hpp"
-#include "Report_Menu.hpp"
-
-using namespace std;
-using namespace chrono;
-
-// GLOBAL VARIABLE DEFINITIONS 
-ArrayDisplaySystem* arraySystem = nullptr;
-LinkedListDisplaySystem* linkedListSystem = nullptr;
-Passenger* loadedPassengers = nullptr;
-int loadedPassengerCount = 0;
-
-// GLOBAL FUNCTION DEFINITIONS 
-void initializeFlightSystem() {
-    if (arraySystem) delete arraySystem;
-    if (linkedListSystem) delete linkedListSystem;
-    
-    // Initialize systems with loaded passengers
-    arraySystem = new ArrayDisplaySystem(400, 26);
-    linkedListSystem = new LinkedListDisplaySystem(400, 26);
-    
-    if (loadedPassengers && loadedPassengerCount > 0) {
-        arraySystem->loadPassengersFromArray(loadedPassengers, loadedPassengerCount);
-        linkedListSystem->loadPassengersFromArray(loadedPassengers, loadedPassengerCount);
-    }
-}
-
-// Count occupied passengers function 
-int countOccupiedPassengers(const Passenger* passengers, int count) {
-    int occupied = 0;
-    for (int i = 0; i < count; i++) {
-        if (!passengers[i].isEmpty) {
-            occupied++;
-        }
-    }
-    return occupied;
-}
-
-int main() {
-    const char* file = "Updated_Passenger_List.csv";
-    
-    // Load passengers from CSV
-    loadedPassengers = readPassengersFromCSV(file, &loadedPassengerCount);
-    
-    if (!loadedPassengers || loadedPassengerCount == 0) {
-        cout << "No CSV file found or file is empty.\n";
-        return 1;
-    }
-    
-    // Initialize flight system
-    initializeFlightSystem();
-    
-    // Calculate statistics
-    int actualPassengers = countOccupiedPassengers(loadedPassengers, loadedPassengerCount);
-    int emptySeats = loadedPassengerCount - actualPassengers;
-    int totalSeats = 400 * 26; 
-    
-    cout << "=========================================\n";
-    cout << "  FLIGHT RESERVATION SYSTEM\n";
-    cout << "=========================================\n";
-    cout << "Total Records: " << loadedPassengerCount << "\n";
-    cout << "Passengers: " << actualPassengers << "\n";
-    cout << "Empty Seats: " << emptySeats << "\n";
-    cout << "Aircraft: 400 rows × 26 seats\n";
-    cout << "Total Capacity: " << totalSeats << " seats\n";
-    cout << "Seat Utilization: " 
-         << std::fixed << std::setprecision(1)
-         << (actualPassengers * 100.0 / totalSeats) << "%\n";
-    cout << "=========================================\n";
-    
-    int choice;
-
-    do {
-        cout << "\n=========================================\n";
-        cout << "  FLIGHT RESERVATION SYSTEM - MAIN MENU\n";
-        cout << "=========================================\n";
-        cout << "0. Exit Program\n";
-        cout << "1. Reservation\n";
-        cout << "2. Cancellation\n";
-        cout << "3. Search & Lookup\n";
-        cout << "4. Manifest & Seat Report\n\n";
-        cout << "Enter your choice (0-4): ";
-        cin >> choice;
-        cin.ignore(); // Clear newline from buffer
-
-        switch (choice) {
-        case 1: {
-            showReservationMenu(loadedPassengers, loadedPassengerCount);
-            break;
-        }
-
-        case 2:
-            showCancellationMenu(file);
-            break;
-
-        case 3:
-            showSearchMenu();
-            break;
-
-        case 4: {
-            if (!arraySystem || !linkedListSystem) {
-                initializeFlightSystem();
-            }
-            clearScreen(); 
-            showFlightSystemMainMenu();
-            break;
-        }
-
-        case 0:
-            cout << "\n=== EXITING PROGRAM ===\n";
-            cout << "Thank you for using the Flight Reservation System!\n";
-            break;
-
-        default:
-            cout << "\nInvalid choice! Please enter 0-4.\n";
-            break;
-        }
-
-    } while (choice != 0);
-
-    if (arraySystem) delete arraySystem;
-    if (linkedListSystem) delete linkedListSystem;
-    if (loadedPassengers) delete[] loadedPassengers;
-
-    return 0;
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <cstring>
+#include "Passenger.hpp" 
+#include "Reservation_Menu.hpp" 
+#include "Cancellation.hpp"
+#include "Cancellation_Menu.hpp"
+#include "Search_Menu.hpp"
+#include "Seat_Manifest.hpp"
+#include "ManifestExport.hpp"
+#include "Report_Menu.hpp"
+#include "Bench_Cli.hpp"
+#include "Dataset_Generator.hpp"
+#include "Trace.hpp"
+#include "ReservationJournal.hpp"
+#include "ReservationServer.hpp"
+#include "LoadGenerator.hpp"
+
+using namespace std;
+using namespace chrono;
+
+// GLOBAL VARIABLE DEFINITIONS 
+ArrayDisplaySystem* arraySystem = nullptr;
+LinkedListDisplaySystem* linkedListSystem = nullptr;
+Passenger* loadedPassengers = nullptr;
+int loadedPassengerCount = 0;
+
+// GLOBAL FUNCTION DEFINITIONS 
+void initializeFlightSystem() {
+    if (arraySystem) delete arraySystem;
+    if (linkedListSystem) delete linkedListSystem;
+    
+    // Initialize systems with loaded passengers
+    const AircraftLayout& layout = activeLayout();
+    arraySystem = new ArrayDisplaySystem(layout.getRows(), layout.getCols());
+    linkedListSystem = new LinkedListDisplaySystem(layout.getRows(), layout.getCols());
+    
+    if (loadedPassengers && loadedPassengerCount > 0) {
+        arraySystem->loadPassengersFromArray(loadedPassengers, loadedPassengerCount);
+        linkedListSystem->loadPassengersFromArray(loadedPassengers, loadedPassengerCount);
+    }
+}
+
+// Replaces the menus' working copy with the journal's current data
+static void refreshFromJournal(const ReservationJournal& journal) {
+    delete[] loadedPassengers;
+    loadedPassengerCount = journal.getPassengerCount();
+    loadedPassengers = new Passenger[loadedPassengerCount > 0 ? loadedPassengerCount : 1];
+    for (int i = 0; i < loadedPassengerCount; i++) {
+        loadedPassengers[i] = journal.getPassengers()[i];
+    }
+}
+
+// Passengers whose seat exists in the layout (a dataset may be for a larger aircraft)
+int countSeatedPassengers(const Passenger* passengers, int count, const AircraftLayout& layout) {
+    int seated = 0;
+    for (int i = 0; i < count; i++) {
+        const Passenger& p = passengers[i];
+        if (!p.isEmpty && p.seatRow >= 1 && p.seatRow <= layout.getRows() &&
+            p.seatColumn >= 'A' && p.seatColumn < 'A' + layout.getCols()) {
+            seated++;
+        }
+    }
+    return seated;
+}
+
+// Count occupied passengers function 
+int countOccupiedPassengers(const Passenger* passengers, int count) {
+    int occupied = 0;
+    for (int i = 0; i < count; i++) {
+        if (!passengers[i].isEmpty) {
+            occupied++;
+        }
+    }
+    return occupied;
+}
+
+int main(int argc, char** argv) {
+    // FRS_TRACE=<path> records spans for the whole session (written on exit)
+    Tracer::initFromEnvironment();
+    
+    // Non-interactive benchmark mode for scheduled performance jobs
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        return runBenchCli(argc - 2, argv + 2);
+    }
+    // Synthetic dataset generation for scaling studies
+    if (argc > 1 && strcmp(argv[1], "--generate") == 0) {
+        return runGenerateCli(argc - 2, argv + 2);
+    }
+    // Reservation server for the booking front-end, and its load generator
+    if (argc > 1 && strcmp(argv[1], "--serve") == 0) {
+        return runServeCli(argc - 2, argv + 2);
+    }
+    if (argc > 1 && strcmp(argv[1], "--loadgen") == 0) {
+        return runLoadGenCli(argc - 2, argv + 2);
+    }
+    // Seat-order manifest export (whole flight or one page) to a file or stdout
+    if (argc > 1 && strcmp(argv[1], "--export-manifest") == 0) {
+        return runExportCli(argc - 2, argv + 2);
+    }
+    
+    // Optional aircraft: --layout default|narrow|wide|<seat-map file>
+    if (argc > 2 && strcmp(argv[1], "--layout") == 0) {
+        AircraftLayout layout;
+        std::string error;
+        if (!loadAircraftLayout(argv[2], layout, error)) {
+            cerr << "Invalid layout: " << error << "\n";
+            return 2;
+        }
+        setActiveLayout(layout);
+    }
+    
+    const char* file = "Updated_Passenger_List.csv";
+    
+    // Load the latest snapshot (or the CSV) and replay logged bookings/cancellations
+    ReservationJournal journal(file);
+    std::string recoveryError;
+    if (!journal.recover(recoveryError)) {
+        cout << "Could not load passengers: " << recoveryError << "\n";
+        return 1;
+    }
+    refreshFromJournal(journal);
+    
+    if (loadedPassengerCount == 0) {
+        cout << "No CSV file found or file is empty.\n";
+        return 1;
+    }
+    
+    // Initialize flight system
+    initializeFlightSystem();
+    
+    // Calculate statistics
+    int actualPassengers = countOccupiedPassengers(loadedPassengers, loadedPassengerCount);
+    int emptySeats = loadedPassengerCount - actualPassengers;
+    const AircraftLayout& layout = activeLayout();
+    int totalSeats = layout.getSeatCount();
+    int seatedPassengers = countSeatedPassengers(loadedPassengers, loadedPassengerCount, layout);
+    
+    cout << "=========================================\n";
+    cout << "  FLIGHT RESERVATION SYSTEM\n";
+    cout << "=========================================\n";
+    cout << "Total Records: " << loadedPassengerCount << "\n";
+    cout << "Passengers: " << actualPassengers << "\n";
+    cout << "Empty Seats: " << emptySeats << "\n";
+    cout << "Aircraft: " << layout.getName() << " (" << layout.getRows() << " rows × "
+         << layout.getCols() << " seats";
+    if (layout.getBlockedCount() > 0) cout << ", " << layout.getBlockedCount() << " blocked";
+    cout << ")\n";
+    cout << "Total Capacity: " << totalSeats << " seats\n";
+    if (seatedPassengers != actualPassengers) {
+        cout << "Seated In Layout: " << seatedPassengers << " passengers\n";
+    }
+    cout << "Seat Utilization: " 
+         << std::fixed << std::setprecision(1)
+         << (seatedPassengers * 100.0 / totalSeats) << "%\n";
+    if (journal.restoredFromSnapshot()) {
+        cout << "Restored From: " << journal.getSnapshotPath() << " (LSN "
+             << journal.getCheckpointLSN() << ")\n";
+    }
+    if (journal.getReplayedCount() > 0) {
+        cout << "Replayed From Log: " << journal.getReplayedCount() << " operations\n";
+    }
+    cout << "=========================================\n";
+    
+    int choice;
+
+    do {
+        cout << "\n=========================================\n";
+        cout << "  FLIGHT RESERVATION SYSTEM - MAIN MENU\n";
+        cout << "=========================================\n";
+        cout << "0. Exit Program\n";
+        cout << "1. Reservation\n";
+        cout << "2. Cancellation\n";
+        cout << "3. Search & Lookup\n";
+        cout << "4. Manifest & Seat Report\n\n";
+        cout << "Enter your choice (0-4): ";
+        cin >> choice;
+        cin.ignore(); // Clear newline from buffer
+
+        switch (choice) {
+        case 1: {
+            TRACE_SPAN("menu", "Reservation menu");
+            long before = journal.getVersion();
+            showReservationMenu(loadedPassengers, loadedPassengerCount, &journal);
+            if (journal.getVersion() != before) {
+                refreshFromJournal(journal);
+                initializeFlightSystem();
+            }
+            break;
+        }
+
+        case 2: {
+            TRACE_SPAN("menu", "Cancellation menu");
+            long before = journal.getVersion();
+            showCancellationMenu(loadedPassengers, loadedPassengerCount, &journal);
+            if (journal.getVersion() != before) {
+                refreshFromJournal(journal);
+                initializeFlightSystem();
+            }
+            break;
+        }
+
+        case 3: {
+            TRACE_SPAN("menu", "Search menu");
+            showSearchMenu(loadedPassengers, loadedPassengerCount);
+            break;
+        }
+
+        case 4: {
+            TRACE_SPAN("menu", "Manifest & seat report menu");
+            if (!arraySystem || !linkedListSystem) {
+                initializeFlightSystem();
+            }
+            clearScreen(); 
+            showFlightSystemMainMenu();
+            break;
+        }
+
+        case 0:
+            cout << "\n=== EXITING PROGRAM ===\n";
+            cout << "Thank you for using the Flight Reservation System!\n";
+            break;
+
+        default:
+            cout << "\nInvalid choice! Please enter 0-4.\n";
+            break;
+        }
+
+    } while (choice != 0);
+
+    // Fold the log into a fresh snapshot so the next start replays nothing
+    if (journal.getUncheckpointedCount() > 0 && !journal.checkpoint()) {
+        cout << "Warning: checkpoint failed; changes remain in " << journal.getLogPath() << "\n";
+    }
+
+    if (arraySystem) delete arraySystem;
+    if (linkedListSystem) delete linkedListSystem;
+    if (loadedPassengers) delete[] loadedPassengers;
+
+    return 0;
 }
\ No newline at end of file
@@ -0,0 +1,294 @@
+#include "ManifestExport.hpp"
+#include "Seat_Manifest.hpp"
+#include "PassengerBinary.hpp"
+#include "AircraftLayout.hpp"
+#include "Trace.hpp"
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <unistd.h>
+
+// ==================== MANIFEST STREAM ====================
+
+static const size_t MIN_BUFFER_BYTES = 256;   // room for any one row
+
+ManifestStream::ManifestStream(int fd, size_t bufferBytes)
+    : capacity(bufferBytes < MIN_BUFFER_BYTES ? MIN_BUFFER_BYTES : bufferBytes), length(0),
+      fd(fd), out(nullptr), rowCount(0), byteCount(0), failed(false) {
+    buffer = new char[capacity];
+}
+
+ManifestStream::ManifestStream(std::ostream& out, size_t bufferBytes)
+    : capacity(bufferBytes < MIN_BUFFER_BYTES ? MIN_BUFFER_BYTES : bufferBytes), length(0),
+      fd(-1), out(&out), rowCount(0), byteCount(0), failed(false) {
+    buffer = new char[capacity];
+}
+
+ManifestStream::~ManifestStream() {
+    flush();
+    delete[] buffer;
+}
+
+bool ManifestStream::flush() {
+    if (length == 0) return !failed;
+
+    if (out) {
+        out->write(buffer, (std::streamsize)length);
+        out->flush();
+        if (!*out) failed = true;
+    } else {
+        size_t done = 0;
+        while (done < length) {
+            ssize_t n = ::write(fd, buffer + done, length - done);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                failed = true;
+                break;
+            }
+            done += (size_t)n;
+        }
+    }
+    byteCount += (long long)length;
+    length = 0;
+    return !failed;
+}
+
+void ManifestStream::append(const char* text, size_t n) {
+    while (n > 0) {
+        if (length == capacity) flush();
+        size_t chunk = capacity - length < n ? capacity - length : n;
+        std::memcpy(buffer + length, text, chunk);
+        length += chunk;
+        text += chunk;
+        n -= chunk;
+    }
+}
+
+// Like std::left << std::setw(width): pads, never truncates
+void ManifestStream::appendField(const char* text, size_t n, size_t width) {
+    append(text, n);
+    for (size_t i = n; i < width; i++) {
+        if (length == capacity) flush();
+        buffer[length++] = ' ';
+    }
+}
+
+void ManifestStream::writeHeader(long total) {
+    std::string header = "PASSENGER MANIFEST (Sorted by Seat)\n"
+                         "====================================\n"
+                         "Total Passengers: " + std::to_string(total) + "\n\n";
+    append(header.data(), header.size());
+    appendField("Seat", 4, 10);
+    appendField("Passenger ID", 12, 15);
+    appendField("Name", 4, 25);
+    appendField("Class", 5, 12);
+    append("\n", 1);
+    std::string rule(62, '-');
+    rule += '\n';
+    append(rule.data(), rule.size());
+}
+
+void ManifestStream::writeRow(const Passenger& p) {
+    // Exported passengers hold a seat in the layout, so the row is positive
+    char digits[12];
+    int d = 0;
+    unsigned int row = (unsigned int)p.seatRow;
+    do {
+        digits[d++] = (char)('0' + row % 10);
+        row /= 10;
+    } while (row > 0);
+    char seat[16];
+    int seatLength = 0;
+    while (d > 0) seat[seatLength++] = digits[--d];
+    seat[seatLength++] = p.seatColumn;
+
+    appendField(seat, (size_t)seatLength, 10);
+    appendField(p.passengerID.data(), p.passengerID.size(), 15);
+    const std::string& name = p.name;
+    appendField(name.data(), name.size(), 25);
+    const std::string& seatClass = p.seatClass;
+    appendField(seatClass.data(), seatClass.size(), 12);
+    append("\n", 1);
+    rowCount++;
+}
+
+void ManifestStream::writeRemainder(long remaining) {
+    std::string line = "... and " + std::to_string(remaining) + " more passengers\n";
+    append(line.data(), line.size());
+}
+
+// ==================== EXPORT MODE ====================
+
+struct ExportOptions {
+    std::string dataset;
+    AircraftLayout layout;
+    std::string structure;
+    std::string outPath;
+    std::string fromSeat;
+    int rows;
+    int bufferKB;
+
+    ExportOptions() : dataset("Updated_Passenger_List.csv"), structure("array"), rows(0), bufferKB(1024) {}
+};
+
+static void printExportUsage() {
+    std::cout << "Usage: <program> --export-manifest [options]\n"
+              << "  --dataset PATH     CSV or .bin dataset (default Updated_Passenger_List.csv)\n"
+              << "  --layout SPEC      default, narrow, wide or a seat-map file (default: default)\n"
+              << "  --structure NAME   array | list (default array)\n"
+              << "  --out PATH         output file (default standard output)\n"
+              << "  --from SEAT        first seat of the page, e.g. 12C (default 1A)\n"
+              << "  --rows N           page size, 0 = to the end (default 0)\n"
+              << "  --buffer-kb N      output buffer size (default 1024)\n";
+}
+
+static bool parseExportOptions(int argc, char** argv, ExportOptions& opts) {
+    for (int i = 0; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") return false;
+
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << "\n";
+            return false;
+        }
+        std::string value = argv[++i];
+
+        if (arg == "--dataset") opts.dataset = value;
+        else if (arg == "--structure") opts.structure = value;
+        else if (arg == "--out") opts.outPath = value;
+        else if (arg == "--from") opts.fromSeat = value;
+        else if (arg == "--rows") opts.rows = std::atoi(value.c_str());
+        else if (arg == "--buffer-kb") opts.bufferKB = std::atoi(value.c_str());
+        else if (arg == "--layout") {
+            std::string error;
+            if (!loadAircraftLayout(value, opts.layout, error)) {
+                std::cerr << "Invalid layout: " << error << "\n";
+                return false;
+            }
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            return false;
+        }
+    }
+
+    if (opts.structure != "array" && opts.structure != "list") {
+        std::cerr << "--structure must be array or list\n";
+        return false;
+    }
+    if (opts.rows < 0 || opts.bufferKB < 1) {
+        std::cerr << "--rows must be >= 0 and --buffer-kb >= 1\n";
+        return false;
+    }
+    return true;
+}
+
+// "12C" -> cursor; -1 if malformed or outside the layout
+static int parseSeatCursor(const std::string& seat, const AircraftLayout& layout) {
+    if (seat.size() < 2) return -1;
+    char col = seat[seat.size() - 1];
+    if (col >= 'a' && col <= 'z') col = (char)(col - 'a' + 'A');
+    int row = 0;
+    for (size_t i = 0; i + 1 < seat.size(); i++) {
+        if (seat[i] < '0' || seat[i] > '9') return -1;
+        row = row * 10 + (seat[i] - '0');
+        if (row > MAX_LAYOUT_ROWS) return -1;
+    }
+    return seatCursor(row, col, layout.getRows(), layout.getCols());
+}
+
+template <class System>
+static int exportFrom(const System& sys, ManifestStream& out, int cursor, int rows) {
+    if (cursor == 0) out.writeHeader(sys.getOccupancy().countReserved());
+    return sys.exportManifest(out, cursor, rows);
+}
+
+int runExportCli(int argc, char** argv) {
+    ExportOptions opts;
+    if (!parseExportOptions(argc, argv, opts)) {
+        printExportUsage();
+        return 2;
+    }
+    setActiveLayout(opts.layout);
+
+    int cursor = 0;
+    if (!opts.fromSeat.empty()) {
+        cursor = parseSeatCursor(opts.fromSeat, opts.layout);
+        if (cursor < 0) {
+            std::cerr << "Seat " << opts.fromSeat << " is not in the layout\n";
+            return 2;
+        }
+    }
+
+    // Progress goes to stderr so the manifest can go to stdout
+    std::streambuf* saved = std::cout.rdbuf(std::cerr.rdbuf());
+    int count = 0;
+    Passenger* loaded = readPassengersFromFile(opts.dataset.c_str(), &count);
+    std::cout.rdbuf(saved);
+    if (!loaded || count == 0) {
+        std::cerr << "No data loaded from " << opts.dataset << "\n";
+        delete[] loaded;
+        return 1;
+    }
+
+    int fd = STDOUT_FILENO;
+    if (!opts.outPath.empty()) {
+        fd = ::open(opts.outPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            std::cerr << "Error: could not open " << opts.outPath << "\n";
+            delete[] loaded;
+            return 1;
+        }
+    }
+
+    int next;
+    long written;
+    long long bytes;
+    bool failed;
+    auto start = std::chrono::steady_clock::now();
+    {
+        TRACE_SPAN("render", "runExportCli");
+        ManifestStream out(fd, (size_t)opts.bufferKB * 1024);
+        if (opts.structure == "array") {
+            ArrayDisplaySystem* sys = new ArrayDisplaySystem(opts.layout.getRows(), opts.layout.getCols());
+            sys->loadPassengersFromArray(loaded, count);
+            delete[] loaded;
+            loaded = nullptr;
+            start = std::chrono::steady_clock::now();
+            next = exportFrom(*sys, out, cursor, opts.rows);
+            out.flush();
+            delete sys;
+        } else {
+            LinkedListDisplaySystem* sys = new LinkedListDisplaySystem(opts.layout.getRows(), opts.layout.getCols());
+            sys->loadPassengersFromArray(loaded, count);
+            delete[] loaded;
+            loaded = nullptr;
+            start = std::chrono::steady_clock::now();
+            next = exportFrom(*sys, out, cursor, opts.rows);
+            out.flush();
+            delete sys;
+        }
+        written = out.getRowCount();
+        bytes = out.getByteCount();
+        failed = out.hasFailed();
+    }
+    double seconds = elapsedNs(start, std::chrono::steady_clock::now()) / 1e9;
+    if (fd != STDOUT_FILENO && ::close(fd) != 0) failed = true;
+    delete[] loaded;
+
+    if (failed) {
+        std::cerr << "Error: write failed\n";
+        return 1;
+    }
+
+    std::cerr << "Exported " << written << " passengers (" << bytes << " bytes) in "
+              << seconds * 1000.0 << " ms";
+    if (next < opts.layout.getSeatCount()) {
+        std::cerr << "; next page: --from " << (next / opts.layout.getCols() + 1)
+                  << (char)('A' + next % opts.layout.getCols());
+    }
+    std::cerr << "\n";
+    return 0;
+}
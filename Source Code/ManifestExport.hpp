@@ -0,0 +1,104 @@
+#ifndef MANIFEST_EXPORT_HPP
+#define MANIFEST_EXPORT_HPP
+
+#include "Passenger.hpp"
+#include "SeatOccupancy.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+// Streaming manifest export: passengers are written in seat order straight
+// from a display system's seat index, so nothing is copied or sorted. Rows
+// are formatted into one large buffer, which goes to a file descriptor or
+// stream whenever it fills up.
+//
+// Pages are addressed by a cursor: the row-major seat slot to start from
+// ((row - 1) * seatsPerRow + column, 0 = seat 1A). Each page returns the
+// cursor of the next one, so a page costs O(page size) plus one bitmap word
+// per row skipped.
+
+// Same bytes as ManifestWriter in Seat_Manifest.hpp
+class ManifestStream {
+private:
+    char* buffer;
+    size_t capacity;
+    size_t length;
+    int fd;                 // -1 when writing to `out`
+    std::ostream* out;
+    long rowCount;
+    long long byteCount;
+    bool failed;
+
+    void append(const char* text, size_t n);
+    void appendField(const char* text, size_t n, size_t width);   // left-aligned, space padded
+
+public:
+    static const size_t DEFAULT_BUFFER_BYTES = 1 << 20;
+
+    explicit ManifestStream(int fd, size_t bufferBytes = DEFAULT_BUFFER_BYTES);
+    explicit ManifestStream(std::ostream& out, size_t bufferBytes = DEFAULT_BUFFER_BYTES);
+    ~ManifestStream();   // flushes
+
+    ManifestStream(const ManifestStream&) = delete;
+    ManifestStream& operator=(const ManifestStream&) = delete;
+
+    void writeHeader(long total);
+    void writeRow(const Passenger& p);
+    void writeRemainder(long remaining);   // "... and N more passengers"
+    bool flush();
+
+    long getRowCount() const { return rowCount; }
+    long long getByteCount() const { return byteCount + (long long)length; }
+    bool hasFailed() const { return failed; }
+};
+
+// Cursor of seat `row`/`col` (1-indexed row, letter column); -1 if outside
+inline int seatCursor(int row, char col, int rows, int seatsPerRow) {
+    int rowIndex = row - 1;
+    int colIndex = col - 'A';
+    if (rowIndex < 0 || rowIndex >= rows || colIndex < 0 || colIndex >= seatsPerRow) return -1;
+    return rowIndex * seatsPerRow + colIndex;
+}
+
+// Walks reserved seats from `cursor` in seat order, skipping empty seats a
+// bitmap word at a time. `lookup(slot)` returns the passenger in a seat slot
+// (or nullptr). Writes at most `maxRows` rows (0 = all) and returns the cursor
+// of the first seat not written, or rows * cols when the manifest is done.
+template <class Lookup>
+int streamSeatOrder(const SeatOccupancy& seats, int cursor, int maxRows, ManifestStream& out, Lookup lookup) {
+    int rows = seats.getRows();
+    int cols = seats.getCols();
+    if (cursor < 0) cursor = 0;
+
+    int written = 0;
+    for (int row = cursor / cols; row < rows; row++) {
+        uint32_t word = seats.rowWord(row);
+        if (row == cursor / cols) word &= ~0u << (cursor % cols);
+        while (word) {
+            int col = lowestBit32(word);
+            word &= word - 1;
+            const Passenger* p = lookup(row * cols + col);
+            if (!p) continue;
+            if (maxRows > 0 && written == maxRows) return row * cols + col;
+            out.writeRow(*p);
+            written++;
+        }
+    }
+    return rows * cols;
+}
+
+// Export mode: `<program> --export-manifest [options]`.
+// Writes the whole manifest (or one page of it) of a dataset in seat order.
+//
+// Options:
+//   --dataset PATH     CSV or .bin dataset (default Updated_Passenger_List.csv)
+//   --layout SPEC      default, narrow, wide or a seat-map file (default: default)
+//   --structure NAME   array | list (default array)
+//   --out PATH         output file (default standard output)
+//   --from SEAT        start at this seat, e.g. 12C (default the first seat)
+//   --rows N           page size; 0 = to the end (default 0)
+//   --buffer-kb N      output buffer size (default 1024)
+// Returns a process exit code (0 on success).
+int runExportCli(int argc, char** argv);
+
+#endif
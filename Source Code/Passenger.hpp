@@ -1,20 +1,25 @@
 #ifndef PASSENGER_HPP
 #define PASSENGER_HPP
 
+#include "InternPool.hpp"
 #include <string>
+#include <utility>
 
+// Names and seat classes repeat across passengers, so they are interned
+// (4-byte handles, see InternPool.hpp); IDs are unique and stored directly.
 struct Passenger {
     std::string passengerID;
-    std::string name;
+    InternedString name;
+    InternedString seatClass;
     int seatRow;
     char seatColumn;
-    std::string seatClass;
     bool isEmpty;
     
-    Passenger(std::string id = "", std::string n = "", int row = 0, 
-              char col = 'A', std::string cls = "", bool empty = false)
-        : passengerID(id), name(n), seatRow(row), seatColumn(col), 
-          seatClass(cls), isEmpty(empty) {}
+    // The ID is taken by value and moved in: temporaries cost no copy
+    Passenger(std::string id = "", const std::string& n = "", int row = 0, 
+              char col = 'A', const std::string& cls = "", bool empty = false)
+        : passengerID(std::move(id)), name(n), seatClass(cls), seatRow(row), seatColumn(col), 
+          isEmpty(empty) {}
 
     std::string getSeat() const {
         return std::to_string(seatRow) + seatColumn;
@@ -32,6 +37,9 @@ struct SimpleNode {
     
     SimpleNode(const Passenger& p, SimpleNode* n = nullptr) 
         : data(p), next(n) {}
+
+    SimpleNode(Passenger&& p, SimpleNode* n = nullptr)
+        : data(std::move(p)), next(n) {}
 };
 
 #endif
\ No newline at end of file
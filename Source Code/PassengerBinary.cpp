@@ -0,0 +1,182 @@
+#include "PassengerBinary.hpp"
+#include "Seat_Manifest.hpp"
+#include "Trace.hpp"
+#include <iostream>
+#include <cstring>
+
+// ==================== LITTLE-ENDIAN HELPERS ====================
+
+static void putU32(char* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = (char)((v >> (8 * i)) & 0xFF);
+}
+
+static void putU64(char* p, uint64_t v) {
+    for (int i = 0; i < 8; i++) p[i] = (char)((v >> (8 * i)) & 0xFF);
+}
+
+static uint32_t getU32(const char* p) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++) v |= (uint32_t)(unsigned char)p[i] << (8 * i);
+    return v;
+}
+
+static uint64_t getU64(const char* p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) v |= (uint64_t)(unsigned char)p[i] << (8 * i);
+    return v;
+}
+
+// ==================== WRITER ====================
+
+void PassengerBinaryWriter::writeHeader() {
+    char header[PASSENGER_BINARY_HEADER_SIZE];
+    std::memset(header, 0, sizeof(header));
+    std::memcpy(header, "PSGR", 4);
+    putU32(header + 4, PASSENGER_BINARY_VERSION);
+    putU32(header + 8, rows);
+    putU32(header + 12, cols);
+    putU64(header + 16, recordCount);
+    putU64(header + 24, checkpointLSN);
+    out.write(header, sizeof(header));
+}
+
+bool PassengerBinaryWriter::open(const char* filename, int r, int c) {
+    out.open(filename, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) return false;
+
+    rows = (uint32_t)r;
+    cols = (uint32_t)c;
+    recordCount = 0;
+    checkpointLSN = 0;
+    writeHeader(); // placeholder count, patched on close
+    return true;
+}
+
+void PassengerBinaryWriter::write(const std::string& id, const std::string& name, int seatRow,
+                                  char seatColumn, const std::string& seatClass, bool isEmpty) {
+    size_t idLen = id.size() < 255 ? id.size() : 255;
+    size_t nameLen = name.size() < 255 ? name.size() : 255;
+    size_t classLen = seatClass.size() < 255 ? seatClass.size() : 255;
+
+    char fixed[9];
+    putU32(fixed, (uint32_t)seatRow);
+    fixed[4] = seatColumn;
+    fixed[5] = (char)(isEmpty ? 1 : 0);
+    fixed[6] = (char)idLen;
+    fixed[7] = (char)nameLen;
+    fixed[8] = (char)classLen;
+
+    out.write(fixed, sizeof(fixed));
+    out.write(id.data(), (std::streamsize)idLen);
+    out.write(name.data(), (std::streamsize)nameLen);
+    out.write(seatClass.data(), (std::streamsize)classLen);
+    recordCount++;
+}
+
+void PassengerBinaryWriter::write(const Passenger& p) {
+    write(p.passengerID, p.name, p.seatRow, p.seatColumn, p.seatClass, p.isEmpty);
+}
+
+bool PassengerBinaryWriter::close() {
+    if (!out.is_open()) return true;
+
+    out.seekp(0);
+    writeHeader();
+    out.close();
+    return !out.fail();
+}
+
+bool writePassengersToBinary(const char* filename, const Passenger* passengers, int count,
+                             int rows, int cols, uint64_t checkpointLSN) {
+    PassengerBinaryWriter writer;
+    if (!writer.open(filename, rows, cols)) return false;
+    writer.setCheckpointLSN(checkpointLSN);
+    for (int i = 0; i < count; i++) {
+        writer.write(passengers[i]);
+    }
+    return writer.close();
+}
+
+// ==================== READER ====================
+
+Passenger* readPassengersFromBinary(const char* filename, int* passengerCount,
+                                    uint64_t* checkpointLSN) {
+    TRACE_SPAN("load", "readPassengersFromBinary");
+    *passengerCount = 0;
+    if (checkpointLSN) *checkpointLSN = 0;
+    std::ifstream file(filename, std::ios::binary);
+
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open file " << filename << "\n";
+        return nullptr;
+    }
+
+    char header[PASSENGER_BINARY_HEADER_SIZE];
+    if (!file.read(header, sizeof(header)) || std::memcmp(header, "PSGR", 4) != 0 ||
+        getU32(header + 4) != PASSENGER_BINARY_VERSION) {
+        std::cerr << "Error: " << filename << " is not a passenger binary dataset\n";
+        return nullptr;
+    }
+
+    uint64_t recordCount = getU64(header + 16);
+    if (checkpointLSN) *checkpointLSN = getU64(header + 24);
+    if (recordCount > 0x7FFFFFFFull) {
+        std::cerr << "Error: " << filename << " has too many records\n";
+        return nullptr;
+    }
+
+    // Header carries the exact count, so a single pass is enough
+    Passenger* passengers = new Passenger[recordCount > 0 ? recordCount : 1];
+    int index = 0;
+    int emptySeats = 0;
+    char text[255];
+
+    for (uint64_t r = 0; r < recordCount; r++) {
+        char fixed[9];
+        if (!file.read(fixed, sizeof(fixed))) break;
+
+        Passenger& p = passengers[index];
+        p.seatRow = (int)getU32(fixed);
+        p.seatColumn = fixed[4];
+        p.isEmpty = (fixed[5] & 1) != 0;
+
+        unsigned char idLen = (unsigned char)fixed[6];
+        unsigned char nameLen = (unsigned char)fixed[7];
+        unsigned char classLen = (unsigned char)fixed[8];
+
+        if (!file.read(text, idLen)) break;
+        p.passengerID.assign(text, idLen);
+        if (!file.read(text, nameLen)) break;
+        p.name.assign(text, nameLen);
+        if (!file.read(text, classLen)) break;
+        p.seatClass.assign(text, classLen);
+
+        // Same empty-seat markers as the CSV loader
+        if (p.isEmpty) {
+            p.passengerID = "EMPTY";
+            p.name = "Empty Seat";
+            emptySeats++;
+        }
+        if (p.seatClass.empty()) p.seatClass = getClassFromRow(p.seatRow);
+
+        index++;
+    }
+
+    file.close();
+    *passengerCount = index;
+
+    std::cout << "\n=========================================\n";
+    std::cout << "Loaded Dataset: " << *passengerCount << " records\n";
+    std::cout << "Empty Seats: " << emptySeats << "\n";
+    std::cout << "=========================================\n";
+
+    return passengers;
+}
+
+Passenger* readPassengersFromFile(const char* filename, int* passengerCount) {
+    size_t len = std::strlen(filename);
+    if (len >= 4 && std::strcmp(filename + len - 4, ".bin") == 0) {
+        return readPassengersFromBinary(filename, passengerCount);
+    }
+    return readPassengersFromCSV(filename, passengerCount);
+}
@@ -0,0 +1,70 @@
+#ifndef PASSENGER_BINARY_HPP
+#define PASSENGER_BINARY_HPP
+
+#include "Passenger.hpp"
+#include <fstream>
+#include <string>
+#include <cstdint>
+
+// Binary passenger dataset layout (all integers little-endian):
+//
+//   Header (32 bytes)
+//     char[4]  magic          "PSGR"
+//     uint32   version        1
+//     uint32   rows           aircraft rows the data was generated for
+//     uint32   cols           seats per row
+//     uint64   recordCount
+//     uint64   checkpointLSN  last write-ahead log record included (0 = plain dataset)
+//
+//   Record (repeated recordCount times)
+//     uint32   seatRow
+//     uint8    seatColumn
+//     uint8    flags          bit 0 = empty seat
+//     uint8    idLength
+//     uint8    nameLength
+//     uint8    classLength
+//     bytes    passengerID, name, seatClass
+//
+// Records are variable length and are read sequentially.
+
+const uint32_t PASSENGER_BINARY_VERSION = 1;
+const int PASSENGER_BINARY_HEADER_SIZE = 32;
+
+// Streaming writer; the record count is patched into the header on close()
+class PassengerBinaryWriter {
+private:
+    std::ofstream out;
+    uint64_t recordCount;
+    uint32_t rows;
+    uint32_t cols;
+    uint64_t checkpointLSN;
+
+    void writeHeader();
+
+public:
+    PassengerBinaryWriter() : recordCount(0), rows(0), cols(0), checkpointLSN(0) {}
+    ~PassengerBinaryWriter() { close(); }
+
+    bool open(const char* filename, int rows, int cols);
+    void write(const Passenger& p);
+    void write(const std::string& id, const std::string& name, int seatRow,
+               char seatColumn, const std::string& seatClass, bool isEmpty);
+    void setCheckpointLSN(uint64_t lsn) { checkpointLSN = lsn; }   // written on close()
+    bool close();
+
+    uint64_t getRecordCount() const { return recordCount; }
+};
+
+// Writes a whole in-memory dataset (e.g. a snapshot)
+bool writePassengersToBinary(const char* filename, const Passenger* passengers, int count,
+                             int rows, int cols, uint64_t checkpointLSN = 0);
+
+// Loads a binary dataset; same contract as readPassengersFromCSV.
+// `checkpointLSN` (optional) receives the header's log position.
+Passenger* readPassengersFromBinary(const char* filename, int* passengerCount,
+                                    uint64_t* checkpointLSN = nullptr);
+
+// Picks the binary or CSV loader from the file extension (".bin" = binary)
+Passenger* readPassengersFromFile(const char* filename, int* passengerCount);
+
+#endif
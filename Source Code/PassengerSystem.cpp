@@ -0,0 +1,128 @@
+#include "PassengerSystem.hpp"
+
+// ==================== POLICY MATRIX ====================
+
+static const int MATRIX_ID_POOL = 64;   // rotating lookup keys
+static const int MATRIX_SORT_SAMPLES = 5;   // selection sort is O(n²)
+
+struct MatrixInput {
+    const Passenger* records;   // occupied passengers only
+    int count;
+    std::string ids[MATRIX_ID_POOL];
+    const BenchmarkConfig* config;
+};
+
+template <class System>
+static bool sortedByID(System& sys) {
+    const Passenger* previous = nullptr;
+    bool ordered = true;
+    sys.forEach([&](const Passenger& p) {
+        if (previous && p.passengerID < previous->passengerID) ordered = false;
+        previous = &p;
+    });
+    return ordered;
+}
+
+template <class System>
+static bool allFound(System& sys, const MatrixInput& in) {
+    for (int i = 0; i < MATRIX_ID_POOL; i++) {
+        Passenger* p = sys.findByID(in.ids[i]);
+        if (!p || p->passengerID != in.ids[i]) return false;
+    }
+    return true;
+}
+
+template <class Storage, class Index, class Sort>
+static void runCombination(const MatrixInput& in, PolicyMatrixResult* out, int& n) {
+    typedef PassengerSystem<Storage, Index, Sort> System;
+    PolicyMatrixResult& r = out[n++];
+    r.name = System::name();
+
+    System* sys = new System();
+    r.load = runBenchmarkWithSetup(
+        [&]() { sys->clear(); },
+        [&]() { sys->loadFromArray(in.records, in.count); },
+        in.count, *in.config);
+    r.heapBytes = (long)sys->memoryUsage();
+    bool verified = sys->size() == in.count && allFound(*sys, in);
+
+    int next = 0;
+    r.find = runBenchmark([&]() {
+        doNotOptimize(sys->findByID(in.ids[next]));
+        next = (next + 1) % MATRIX_ID_POOL;
+    }, *in.config);
+
+    // Remove a passenger and book them again, keeping the size constant
+    next = 0;
+    r.churn = runBenchmark([&]() {
+        const std::string& id = in.ids[next];
+        Passenger* p = sys->findByID(id);
+        if (p) {
+            Passenger copy = *p;
+            sys->remove(id);
+            sys->add(std::move(copy));
+        }
+        next = (next + 1) % MATRIX_ID_POOL;
+    }, *in.config);
+    verified = verified && sys->size() == in.count && allFound(*sys, in);
+
+    BenchmarkConfig sortConfig = *in.config;
+    if (sortConfig.samples > MATRIX_SORT_SAMPLES) sortConfig.samples = MATRIX_SORT_SAMPLES;
+    if (sortConfig.warmupRuns > 1) sortConfig.warmupRuns = 1;
+    r.sort = runBenchmarkWithSetup(
+        [&]() {
+            sys->clear();
+            sys->loadFromArray(in.records, in.count);
+        },
+        [&]() { sys->sortByID(); },
+        1, sortConfig);
+    r.verified = verified && sortedByID(*sys) && allFound(*sys, in);
+
+    delete sys;
+}
+
+template <class Storage, class Index>
+static void runSorts(const MatrixInput& in, PolicyMatrixResult* out, int& n) {
+    runCombination<Storage, Index, SelectionSort>(in, out, n);
+    runCombination<Storage, Index, MergeSort>(in, out, n);
+}
+
+template <class Storage>
+static void runIndexes(const MatrixInput& in, PolicyMatrixResult* out, int& n) {
+    runSorts<Storage, NoIndex>(in, out, n);
+    runSorts<Storage, DenseIndex>(in, out, n);
+    runSorts<Storage, HashIndex>(in, out, n);
+    runSorts<Storage, BTreeIndex>(in, out, n);
+}
+
+int runPolicyMatrix(const Passenger* passengers, int count, const BenchmarkConfig& config,
+                    PolicyMatrixResult* out) {
+    Passenger* records = new Passenger[count > 0 ? count : 1];
+    int occupied = 0;
+    for (int i = 0; i < count; i++) {
+        if (!passengers[i].isEmpty) records[occupied++] = passengers[i];
+    }
+    if (occupied == 0) {
+        delete[] records;
+        return 0;
+    }
+
+    MatrixInput* in = new MatrixInput();
+    in->records = records;
+    in->count = occupied;
+    in->config = &config;
+    for (int i = 0; i < MATRIX_ID_POOL; i++) {
+        in->ids[i] = records[(long)i * occupied / MATRIX_ID_POOL].passengerID;
+    }
+
+    int n = 0;
+    runIndexes<ArrayStorage>(*in, out, n);
+    runIndexes<ListStorage>(*in, out, n);
+    runIndexes<UnrolledListStorage>(*in, out, n);
+    runIndexes<ArenaListStorage>(*in, out, n);
+    runIndexes<SkipListStorage>(*in, out, n);
+
+    delete in;
+    delete[] records;
+    return n;
+}
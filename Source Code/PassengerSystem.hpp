@@ -0,0 +1,282 @@
+#ifndef PASSENGER_SYSTEM_HPP
+#define PASSENGER_SYSTEM_HPP
+
+#include "Passenger.hpp"
+#include "StoragePolicies.hpp"
+#include "IndexPolicies.hpp"
+#include "HeapTracker.hpp"
+#include "Benchmark.hpp"
+#include "Trace.hpp"
+#include <string>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+// ==================== SORT POLICIES ====================
+
+// Both sort by passengerID through the storage's forward iterators, so any
+// storage policy works. Records move between positions; the system then
+// rebuilds its index.
+
+// O(n²) selection sort swapping records, as in the original search menu
+struct SelectionSort {
+    static const char* name() { return "selection"; }
+
+    template <class Storage>
+    static void sort(Storage& storage) {
+        for (auto i = storage.begin(); i != storage.end(); ++i) {
+            auto minimum = i;
+            auto j = i;
+            for (++j; j != storage.end(); ++j) {
+                if (j->passengerID < minimum->passengerID) minimum = j;
+            }
+            if (&*minimum != &*i) std::swap(*i, *minimum);
+        }
+    }
+};
+
+// O(n log n) stable bottom-up merge sort of record pointers, then one pass
+// moving the records back in order
+struct MergeSort {
+    static const char* name() { return "merge"; }
+
+    template <class Storage>
+    static void sort(Storage& storage) {
+        int n = storage.size();
+        if (n < 2) return;
+
+        Passenger** order = new Passenger*[n];
+        Passenger** scratch = new Passenger*[n];
+        int k = 0;
+        for (auto it = storage.begin(); it != storage.end(); ++it) order[k++] = &*it;
+
+        for (int width = 1; width < n; width *= 2) {
+            for (int lo = 0; lo < n; lo += 2 * width) {
+                int mid = lo + width < n ? lo + width : n;
+                int hi = lo + 2 * width < n ? lo + 2 * width : n;
+                int a = lo, b = mid, out = lo;
+                while (a < mid && b < hi) {
+                    scratch[out++] = order[b]->passengerID < order[a]->passengerID ? order[b++] : order[a++];
+                }
+                while (a < mid) scratch[out++] = order[a++];
+                while (b < hi) scratch[out++] = order[b++];
+            }
+            Passenger** swap = order;
+            order = scratch;
+            scratch = swap;
+        }
+
+        Passenger* sorted = new Passenger[n];
+        for (int i = 0; i < n; i++) sorted[i] = std::move(*order[i]);
+        k = 0;
+        for (auto it = storage.begin(); it != storage.end(); ++it) *it = std::move(sorted[k++]);
+
+        delete[] sorted;
+        delete[] scratch;
+        delete[] order;
+    }
+};
+
+// ==================== PASSENGER SYSTEM ====================
+
+// One passenger collection assembled from a storage, an ID index and a sort
+// policy at compile time (no virtual calls). Lookups go through the index
+// and fall back to a scan (a search on ordered storage) when it cannot
+// answer; with duplicate IDs every path returns the first record in storage
+// order.
+template <class Storage, class Index, class Sort>
+class PassengerSystem {
+protected:
+    HeapAccount heap;   // records, nodes/chunks/blocks, index and string buffers
+    Storage storage;
+    Index index;
+    bool sorted;
+
+    struct IndexMover {
+        Index& index;
+        void operator()(Passenger* from, Passenger* to) const { index.update(to->passengerID, from, to); }
+    };
+
+    Passenger* scan(const std::string& id) const {
+        for (auto it = storage.begin(); it != storage.end(); ++it) {
+            if (it->passengerID == id) return &*it;
+        }
+        return nullptr;
+    }
+
+    // Without an index: ordered storages search, the rest scan
+    Passenger* unindexedFind(const std::string& id, std::false_type) const { return scan(id); }
+    Passenger* unindexedFind(const std::string& id, std::true_type) const { return storage.find(id); }
+
+    void rebuildIndex() {
+        index.clear();
+        for (auto it = storage.begin(); it != storage.end(); ++it) index.insert(it->passengerID, &*it);
+    }
+
+public:
+    typedef Storage StoragePolicy;
+    typedef Index IndexPolicy;
+    typedef Sort SortPolicy;
+
+    PassengerSystem() : sorted(false) {}
+
+    PassengerSystem(const PassengerSystem&) = delete;
+    PassengerSystem& operator=(const PassengerSystem&) = delete;
+
+    // "array/hash/merge"
+    static std::string name() {
+        return std::string(Storage::name()) + "/" + Index::name() + "/" + Sort::name();
+    }
+
+    void reserve(int n) {
+        HeapScope scope(heap);
+        storage.reserve(n);
+    }
+
+    // The stored record (valid until the storage next moves records)
+    Passenger* add(Passenger p) {
+        HeapScope scope(heap);
+        Passenger* stored = storage.append(std::move(p), IndexMover{index});
+        index.insert(stored->passengerID, stored);
+        sorted = false;
+        return stored;
+    }
+
+    // Every record, empty seats included
+    void loadFromArray(const Passenger* passengers, int count) {
+        TRACE_SPAN("load", "PassengerSystem::loadFromArray");
+        reserve(storage.size() + count);
+        for (int i = 0; i < count; i++) add(passengers[i]);
+    }
+
+    Passenger* findByID(const std::string& id) const {
+        Passenger* found;
+        if (index.find(id, found)) return found;
+        return unindexedFind(id, std::integral_constant<bool, Storage::ORDERED>());
+    }
+
+    bool remove(const std::string& id) {
+        TRACE_SPAN("cancel", "PassengerSystem::remove");
+        Passenger* p = findByID(id);
+        if (!p) return false;
+
+        HeapScope scope(heap);
+        index.erase(id, p);
+        if (!storage.remove(p, IndexMover{index})) sorted = false;
+        return true;
+    }
+
+    void sortByID() {
+        TRACE_SPAN("sort", "PassengerSystem::sortByID");
+        HeapScope scope(heap);
+        Sort::sort(storage);
+        rebuildIndex();
+        sorted = true;
+    }
+
+    void clear() {
+        HeapScope scope(heap);
+        index.clear();
+        storage.clear();
+        sorted = false;
+    }
+
+    bool isSorted() const { return sorted; }
+    int size() const { return storage.size(); }
+
+    // Live heap from the instrumented allocator (includes string buffers)
+    size_t memoryUsage() const { return heap.stats().footprintBytes; }
+
+    template <class Fn>
+    void forEach(Fn fn) const {
+        for (auto it = storage.begin(); it != storage.end(); ++it) fn(*it);
+    }
+
+    // --- SEARCH VARIANTS (ignore the index; the sorted ones need sortByID()) ---
+
+    // O(n) scan
+    bool containsUnsorted(const std::string& id) const {
+        return scan(id) != nullptr;
+    }
+
+    // O(n) scan that stops once IDs pass the target
+    bool containsSorted(const std::string& id) const {
+        for (auto it = storage.begin(); it != storage.end(); ++it) {
+            if (it->passengerID == id) return true;
+            if (it->passengerID > id) break;
+        }
+        return false;
+    }
+
+    // O(log n); random-access storage only
+    bool containsBinary(const std::string& id) const {
+        static_assert(Storage::RANDOM_ACCESS, "binary search needs random-access storage");
+        int left = 0, right = storage.size() - 1;
+        while (left <= right) {
+            int mid = left + (right - left) / 2;
+            const std::string& midID = storage.at(mid).passengerID;
+            if (midID == id) return true;
+            if (midID < id) left = mid + 1;
+            else right = mid - 1;
+        }
+        return false;
+    }
+
+    // O(log n) expected; ordered storage only, no sort needed
+    bool containsOrdered(const std::string& id) const {
+        static_assert(Storage::ORDERED, "ordered search needs ordered storage");
+        return storage.find(id) != nullptr;
+    }
+
+    // O(√n) jump search over forward iterators: skip blocks of √n records,
+    // then scan the block that may hold the target
+    bool containsJump(const std::string& id) const {
+        int n = storage.size();
+        if (n <= 0) return false;
+
+        int step = (int)std::sqrt((double)n);
+        if (step < 1) step = 1;
+        auto blockStart = storage.begin();
+        while (true) {
+            // `last` = final record of this block, `next` = first of the following one
+            auto last = blockStart;
+            auto next = blockStart;
+            ++next;
+            for (int k = 1; k < step && next != storage.end(); k++) {
+                last = next;
+                ++next;
+            }
+            if (!(last->passengerID < id) || !(next != storage.end())) {
+                for (auto it = blockStart; ; ++it) {
+                    if (it->passengerID == id) return true;
+                    if (&*it == &*last) break;
+                }
+                return false;
+            }
+            blockStart = next;
+        }
+    }
+};
+
+// ==================== POLICY MATRIX BENCHMARK ====================
+
+// Timings for one storage x index x sort combination
+struct PolicyMatrixResult {
+    std::string name;             // "storage/index/sort"
+    BenchmarkResult load;         // ns per record
+    BenchmarkResult find;         // ns per lookup by ID
+    BenchmarkResult churn;        // ns per remove + re-add
+    BenchmarkResult sort;         // ns per whole sort (at most 5 samples)
+    long heapBytes;               // after loading
+    bool verified;                // lookups, sort order and sizes all checked
+};
+
+// 5 storages x 4 indexes x 2 sorts, each compiled as its own instantiation
+const int POLICY_COMBINATIONS = 40;
+
+// Runs every combination over the occupied records of `passengers`; fills
+// `out` (POLICY_COMBINATIONS entries) and returns how many were run
+int runPolicyMatrix(const Passenger* passengers, int count, const BenchmarkConfig& config,
+                    PolicyMatrixResult* out);
+
+#endif
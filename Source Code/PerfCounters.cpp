@@ -0,0 +1,190 @@
+#include "PerfCounters.hpp"
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+const char* perfCounterName(PerfCounterKind kind) {
+    switch (kind) {
+        case PERF_CYCLES:        return "Cycles";
+        case PERF_INSTRUCTIONS:  return "Instructions";
+        case PERF_L1D_MISSES:    return "L1D misses";
+        case PERF_LLC_MISSES:    return "LLC misses";
+        case PERF_BRANCH_MISSES: return "Branch misses";
+        case PERF_DTLB_MISSES:   return "dTLB misses";
+        default:                 return "?";
+    }
+}
+
+static std::string lastOpenError;
+
+#ifdef __linux__
+
+// ==================== LINUX IMPLEMENTATION ====================
+
+static uint64_t cacheConfig(uint64_t cache, uint64_t op, uint64_t result) {
+    return cache | (op << 8) | (result << 16);
+}
+
+static int openEvent(PerfCounterKind kind) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    switch (kind) {
+        case PERF_CYCLES:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case PERF_INSTRUCTIONS:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case PERF_L1D_MISSES:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cacheConfig(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ,
+                                      PERF_COUNT_HW_CACHE_RESULT_MISS);
+            break;
+        case PERF_LLC_MISSES:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case PERF_BRANCH_MISSES:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case PERF_DTLB_MISSES:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cacheConfig(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ,
+                                      PERF_COUNT_HW_CACHE_RESULT_MISS);
+            break;
+        default:
+            return -1;
+    }
+
+    int fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (fd < 0 && lastOpenError.empty()) {
+        lastOpenError = std::string("perf_event_open: ") + std::strerror(errno);
+        if (errno == EACCES || errno == EPERM) {
+            lastOpenError += " (check /proc/sys/kernel/perf_event_paranoid)";
+        }
+    }
+    return fd;
+}
+
+PerfCounterSet::PerfCounterSet() {
+    for (int k = 0; k < PERF_COUNTER_COUNT; k++) fds[k] = -1;
+}
+
+PerfCounterSet::~PerfCounterSet() {
+    close();
+}
+
+bool PerfCounterSet::open() {
+    close();
+    bool any = false;
+    for (int k = 0; k < PERF_COUNTER_COUNT; k++) {
+        fds[k] = openEvent((PerfCounterKind)k);
+        if (fds[k] >= 0) {
+            ioctl(fds[k], PERF_EVENT_IOC_RESET, 0);
+            any = true;
+        }
+    }
+    return any;
+}
+
+void PerfCounterSet::close() {
+    for (int k = 0; k < PERF_COUNTER_COUNT; k++) {
+        if (fds[k] >= 0) ::close(fds[k]);
+        fds[k] = -1;
+    }
+}
+
+bool PerfCounterSet::isOpen() const {
+    for (int k = 0; k < PERF_COUNTER_COUNT; k++) {
+        if (fds[k] >= 0) return true;
+    }
+    return false;
+}
+
+void PerfCounterSet::start() {
+    for (int k = 0; k < PERF_COUNTER_COUNT; k++) {
+        if (fds[k] >= 0) ioctl(fds[k], PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+void PerfCounterSet::stop() {
+    for (int k = 0; k < PERF_COUNTER_COUNT; k++) {
+        if (fds[k] >= 0) ioctl(fds[k], PERF_EVENT_IOC_DISABLE, 0);
+    }
+}
+
+PerfCounterValues PerfCounterSet::read(double operations) const {
+    PerfCounterValues values;
+    if (operations <= 0.0) return values;
+
+    for (int k = 0; k < PERF_COUNTER_COUNT; k++) {
+        if (fds[k] < 0) continue;
+
+        // { value, time_enabled, time_running }
+        uint64_t data[3];
+        if (::read(fds[k], data, sizeof(data)) != (ssize_t)sizeof(data)) continue;
+        if (data[2] == 0) continue;  // never scheduled on the PMU
+
+        double scaled = (double)data[0] * ((double)data[1] / (double)data[2]);
+        values.value[k] = scaled / operations;
+        values.valid[k] = true;
+    }
+    return values;
+}
+
+#else
+
+// ==================== FALLBACK (NO PERF EVENTS) ====================
+
+PerfCounterSet::PerfCounterSet() {
+    for (int k = 0; k < PERF_COUNTER_COUNT; k++) fds[k] = -1;
+}
+
+PerfCounterSet::~PerfCounterSet() {}
+
+bool PerfCounterSet::open() {
+    lastOpenError = "hardware counters require Linux perf_event_open";
+    return false;
+}
+
+void PerfCounterSet::close() {}
+bool PerfCounterSet::isOpen() const { return false; }
+void PerfCounterSet::start() {}
+void PerfCounterSet::stop() {}
+
+PerfCounterValues PerfCounterSet::read(double) const {
+    return PerfCounterValues();
+}
+
+#endif
+
+// ==================== AVAILABILITY ====================
+
+bool perfCountersAvailable() {
+    static int available = -1;
+    if (available < 0) {
+        PerfCounterSet probe;
+        available = probe.open() ? 1 : 0;
+    }
+    return available == 1;
+}
+
+std::string perfCountersStatus() {
+    if (perfCountersAvailable()) return "";
+    return lastOpenError.empty() ? "hardware counters unavailable" : lastOpenError;
+}
@@ -0,0 +1,84 @@
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <cstdint>
+#include <string>
+
+// Hardware performance counters via Linux perf_event_open.
+// Counts user-space events of the calling thread only. On other platforms,
+// or when the kernel refuses access (perf_event_paranoid, containers, VMs),
+// every counter is reported as unavailable and callers print "n/a".
+
+enum PerfCounterKind {
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_MISSES,
+    PERF_LLC_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_DTLB_MISSES,
+    PERF_COUNTER_COUNT
+};
+
+// Short table label, e.g. "LLC misses"
+const char* perfCounterName(PerfCounterKind kind);
+
+// Per-operation counter values; `valid[k]` is false when counter k could not be read
+struct PerfCounterValues {
+    double value[PERF_COUNTER_COUNT];
+    bool valid[PERF_COUNTER_COUNT];
+
+    PerfCounterValues() {
+        for (int k = 0; k < PERF_COUNTER_COUNT; k++) {
+            value[k] = 0.0;
+            valid[k] = false;
+        }
+    }
+
+    bool any() const {
+        for (int k = 0; k < PERF_COUNTER_COUNT; k++) {
+            if (valid[k]) return true;
+        }
+        return false;
+    }
+
+    // Instructions per cycle, or a negative value when either counter is missing
+    double ipc() const {
+        if (!valid[PERF_CYCLES] || !valid[PERF_INSTRUCTIONS] || value[PERF_CYCLES] <= 0.0) return -1.0;
+        return value[PERF_INSTRUCTIONS] / value[PERF_CYCLES];
+    }
+};
+
+// One file descriptor per event, opened disabled. start()/stop() may be
+// called many times; counts accumulate so untimed setup can be excluded.
+// Events are independent (not a group) so the kernel can multiplex them
+// when the PMU has too few slots; totals are scaled by enabled/running time.
+class PerfCounterSet {
+private:
+    int fds[PERF_COUNTER_COUNT];
+
+public:
+    PerfCounterSet();
+    ~PerfCounterSet();
+
+    // Opens the counters and zeroes them; returns false if none could be opened
+    bool open();
+    void close();
+    bool isOpen() const;
+
+    void start();
+    void stop();
+
+    // Accumulated totals divided by `operations`
+    PerfCounterValues read(double operations) const;
+
+    PerfCounterSet(const PerfCounterSet&) = delete;
+    PerfCounterSet& operator=(const PerfCounterSet&) = delete;
+};
+
+// True if at least one counter can be opened (probed once)
+bool perfCountersAvailable();
+
+// Human-readable reason when counters are unavailable, empty otherwise
+std::string perfCountersStatus();
+
+#endif
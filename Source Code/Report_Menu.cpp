@@ -23,6 +23,14 @@ void pressEnterToContinue() {
     std::cin.get();
 }
 
+// Names and seat classes live in the shared intern pool, not in either structure
+static void printInternPoolUsage() {
+    HeapStats pool = internPool().heapStats();
+    std::cout << "   Interned Strings: " << internPool().getStringCount() << " ("
+              << std::fixed << std::setprecision(2) << (pool.footprintBytes / 1024.0)
+              << " KB, shared by all structures)\n";
+}
+
 // ==================== MENUS ====================
 
 // The central hub for the reporting application
@@ -97,7 +105,8 @@ void showArrayMenu() {
         std::cout << "SYSTEM INFO:\n";
         std::cout << "Passengers: " << (arraySystem ? arraySystem->getPassengerCount() : 0)
                   << " / " << (arraySystem ? arraySystem->getTotalSeats() : 0) << "\n";
-        std::cout << "Data Structure: 2D Array (400 × 26)\n\n";
+        std::cout << "Data Structure: 2D Array (" << activeLayout().getRows() << " × "
+                  << activeLayout().getCols() << ")\n\n";
         
         std::cout << "DISPLAY OPERATIONS:\n";
         std::cout << "1. Display Seating Chart\n";
@@ -267,7 +276,7 @@ void demonstrateArrayTechniques() {
     }
     
     std::cout << "Testing with " << arraySystem->getPassengerCount() << " passengers\n";
-    std::cout << "Searching 10 random IDs\n\n";
+    std::cout << "Searching 10 random IDs (median ns per lookup, warmed up)\n\n";
     
     // Retrieve sample IDs for testing
     int testCount = 0;
@@ -287,7 +296,7 @@ void demonstrateArrayTechniques() {
     std::string linearMinID, linearMaxID;
     
     for (int i = 0; i < testCount; i++) {
-        double time = arraySystem->measureLinearSearchTime(testIDs[i]);
+        double time = arraySystem->measureLinearSearchTime(testIDs[i]).medianNs;
         linearTotal += time;
         if (time < linearMin) { 
             linearMin = time; 
@@ -300,9 +309,9 @@ void demonstrateArrayTechniques() {
     }
     
     std::cout << "   Average Time: " << std::fixed << std::setprecision(2) 
-              << (testCount > 0 ? linearTotal / testCount : 0) << " us\n";
-    std::cout << "   Min Time: " << linearMin << " us (ID: " << linearMinID << ")\n";
-    std::cout << "   Max Time: " << linearMax << " us (ID: " << linearMaxID << ")\n\n";
+              << (testCount > 0 ? linearTotal / testCount : 0) << " ns\n";
+    std::cout << "   Min Time: " << linearMin << " ns (ID: " << linearMinID << ")\n";
+    std::cout << "   Max Time: " << linearMax << " ns (ID: " << linearMaxID << ")\n\n";
     
     // --- Test 2: Binary Search (Requires Sorting) ---
     std::cout << "2. BINARY SEARCH (O(log n)):\n";
@@ -314,7 +323,7 @@ void demonstrateArrayTechniques() {
     std::string binaryMinID, binaryMaxID;
     
     for (int i = 0; i < testCount; i++) {
-        double time = arraySystem->measureBinarySearchTime(testIDs[i]);
+        double time = arraySystem->measureBinarySearchTime(testIDs[i]).medianNs;
         binaryTotal += time;
         if (time < binaryMin) { 
             binaryMin = time; 
@@ -326,9 +335,9 @@ void demonstrateArrayTechniques() {
         }
     }
     
-    std::cout << "   Average Time: " << (testCount > 0 ? binaryTotal / testCount : 0) << " us\n";
-    std::cout << "   Min Time: " << binaryMin << " us (ID: " << binaryMinID << ")\n";
-    std::cout << "   Max Time: " << binaryMax << " us (ID: " << binaryMaxID << ")\n\n";
+    std::cout << "   Average Time: " << (testCount > 0 ? binaryTotal / testCount : 0) << " ns\n";
+    std::cout << "   Min Time: " << binaryMin << " ns (ID: " << binaryMinID << ")\n";
+    std::cout << "   Max Time: " << binaryMax << " ns (ID: " << binaryMaxID << ")\n\n";
     
     // --- Test 3: Memory ---
     size_t arrayMem = arraySystem->calculateMemoryUsage();
@@ -338,6 +347,7 @@ void demonstrateArrayTechniques() {
     std::cout << "   Per Passenger: " 
               << (arraySystem->getPassengerCount() > 0 ? arrayMem / arraySystem->getPassengerCount() : 0) 
               << " bytes\n";
+    printInternPoolUsage();
     
     // Clean up dynamically allocated test IDs
     for (int i = 0; i < testCount; i++) {
@@ -361,7 +371,7 @@ void demonstrateLinkedListTechniques() {
     }
     
     std::cout << "Testing with " << linkedListSystem->getPassengerCount() << " passengers\n";
-    std::cout << "Searching 10 random IDs\n\n";
+    std::cout << "Searching 10 random IDs (median ns per lookup, warmed up)\n\n";
     
     // Retrieve sample IDs
     int testCount = 0;
@@ -381,7 +391,7 @@ void demonstrateLinkedListTechniques() {
     std::string linearMinID, linearMaxID;
     
     for (int i = 0; i < testCount; i++) {
-        double time = linkedListSystem->measureLinearSearchTime(testIDs[i]);
+        double time = linkedListSystem->measureLinearSearchTime(testIDs[i]).medianNs;
         linearTotal += time;
         if (time < linearMin) { 
             linearMin = time; 
@@ -394,9 +404,9 @@ void demonstrateLinkedListTechniques() {
     }
     
     std::cout << "   Average Time: " << std::fixed << std::setprecision(2) 
-              << (testCount > 0 ? linearTotal / testCount : 0) << " us\n";
-    std::cout << "   Min Time: " << linearMin << " us (ID: " << linearMinID << ")\n";
-    std::cout << "   Max Time: " << linearMax << " us (ID: " << linearMaxID << ")\n\n";
+              << (testCount > 0 ? linearTotal / testCount : 0) << " ns\n";
+    std::cout << "   Min Time: " << linearMin << " ns (ID: " << linearMinID << ")\n";
+    std::cout << "   Max Time: " << linearMax << " ns (ID: " << linearMaxID << ")\n\n";
     
     // --- Test 2: Hash Search (O(1)) ---
     std::cout << "2. HASH MAP LOOKUP (O(1)):\n";
@@ -406,7 +416,7 @@ void demonstrateLinkedListTechniques() {
     std::string hashMinID, hashMaxID;
     
     for (int i = 0; i < testCount; i++) {
-        double time = linkedListSystem->measureHashSearchTime(testIDs[i]);
+        double time = linkedListSystem->measureHashSearchTime(testIDs[i]).medianNs;
         hashTotal += time;
         if (time < hashMin) { 
             hashMin = time; 
@@ -418,9 +428,9 @@ void demonstrateLinkedListTechniques() {
         }
     }
     
-    std::cout << "   Average Time: " << (testCount > 0 ? hashTotal / testCount : 0) << " us\n";
-    std::cout << "   Min Time: " << hashMin << " us (ID: " << hashMinID << ")\n";
-    std::cout << "   Max Time: " << hashMax << " us (ID: " << hashMaxID << ")\n\n";
+    std::cout << "   Average Time: " << (testCount > 0 ? hashTotal / testCount : 0) << " ns\n";
+    std::cout << "   Min Time: " << hashMin << " ns (ID: " << hashMinID << ")\n";
+    std::cout << "   Max Time: " << hashMax << " ns (ID: " << hashMaxID << ")\n\n";
     
     // --- Test 3: Memory ---
     size_t llMem = linkedListSystem->calculateMemoryUsage();
@@ -430,7 +440,8 @@ void demonstrateLinkedListTechniques() {
     std::cout << "   Per Passenger: " 
               << (linkedListSystem->getPassengerCount() > 0 ? llMem / linkedListSystem->getPassengerCount() : 0) 
               << " bytes\n";
-    std::cout << "   Node Overhead: " << sizeof(ListNode) << " bytes per node\n";
+    std::cout << "   Node Overhead: " << sizeof(SimpleNode) << " bytes per node\n";
+    printInternPoolUsage();
     
     // Clean up test IDs
     for (int i = 0; i < testCount; i++) {
@@ -516,10 +527,12 @@ void showComparisonMenu() {
         std::cout << "COMPARISON OPTIONS:\n";
         std::cout << "1. Compare Seating Chart Display (Time + Space)\n";
         std::cout << "2. Compare Manifest Generation\n";
-        std::cout << "3. Compare All Operations (Complete Analysis)\n";
-        std::cout << "4. Return to Main Menu\n\n";
+        std::cout << "3. Compare Seat Lookup (Row + Column)\n";
+        std::cout << "4. Compare Seat Queries (Row Scan vs Columnar)\n";
+        std::cout << "5. Compare All Operations (Complete Analysis)\n";
+        std::cout << "6. Return to Main Menu\n\n";
         
-        std::cout << "Enter your choice (1-4): ";
+        std::cout << "Enter your choice (1-6): ";
         
         if (!(std::cin >> choice)) {
             std::cin.clear();
@@ -545,17 +558,33 @@ void showComparisonMenu() {
             case 3:
                 clearScreen();
                 if (arraySystem && linkedListSystem) {
-                    PerformanceComparator::compareAllOperations(*arraySystem, *linkedListSystem);
+                    PerformanceComparator::compareSeatLookup(*arraySystem, *linkedListSystem);
                 }
                 pressEnterToContinue();
                 break;
                 
             case 4:
+                clearScreen();
+                if (arraySystem && linkedListSystem) {
+                    PerformanceComparator::compareSeatQueries(*arraySystem, *linkedListSystem);
+                }
+                pressEnterToContinue();
+                break;
+                
+            case 5:
+                clearScreen();
+                if (arraySystem && linkedListSystem) {
+                    PerformanceComparator::compareAllOperations(*arraySystem, *linkedListSystem);
+                }
+                pressEnterToContinue();
+                break;
+                
+            case 6:
                 backToMain = true;
                 break;
                 
             default:
-                std::cout << "\nInvalid choice! Please enter 1-4.\n";
+                std::cout << "\nInvalid choice! Please enter 1-6.\n";
                 std::cin.clear();
                 std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                 pressEnterToContinue();
@@ -0,0 +1,227 @@
+#include "ReservationJournal.hpp"
+#include "PassengerBinary.hpp"
+#include "AircraftLayout.hpp"
+#include "Trace.hpp"
+#include <fstream>
+#include <cstdio>
+
+// "data/flight.csv" -> "data/flight"
+static std::string stripExtension(const std::string& path) {
+    size_t dot = path.find_last_of('.');
+    size_t slash = path.find_last_of("/\\");
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) return path;
+    return path.substr(0, dot);
+}
+
+static bool fileExists(const std::string& path) {
+    std::ifstream file(path.c_str(), std::ios::binary);
+    return file.is_open();
+}
+
+// ==================== CONSTRUCTION ====================
+
+ReservationJournal::ReservationJournal(const std::string& dataset)
+    : datasetPath(dataset), passengers(nullptr), count(0), capacity(0), checkpointLSN(0),
+      checkpointInterval(DEFAULT_CHECKPOINT_INTERVAL), sinceCheckpoint(0), staged(0), lastStagedLSN(0), replayed(0),
+      fromSnapshot(false), version(0) {
+    std::string base = stripExtension(dataset);
+    snapshotPath = base + ".snapshot.bin";
+    logPath = base + ".wal";
+}
+
+ReservationJournal::~ReservationJournal() {
+    log.close();
+    delete[] passengers;
+}
+
+// ==================== RECOVERY ====================
+
+bool ReservationJournal::recover(std::string& error) {
+    TRACE_SPAN("load", "ReservationJournal::recover");
+    delete[] passengers;
+    passengers = nullptr;
+    count = 0;
+    checkpointLSN = 0;
+    replayed = 0;
+
+    fromSnapshot = fileExists(snapshotPath);
+    if (fromSnapshot) {
+        passengers = readPassengersFromBinary(snapshotPath.c_str(), &count, &checkpointLSN);
+    } else {
+        passengers = readPassengersFromFile(datasetPath.c_str(), &count);
+    }
+    if (!passengers) {
+        error = "could not load " + (fromSnapshot ? snapshotPath : datasetPath);
+        return false;
+    }
+    capacity = count;
+
+    // Replay what the snapshot does not cover, then cut off any torn tail
+    int recordCount = 0;
+    long validBytes = 0;
+    LogRecord* records = readLogRecords(logPath, &recordCount, &validBytes);
+    uint64_t lastLSN = checkpointLSN;
+    for (int i = 0; i < recordCount; i++) {
+        const LogRecord& rec = records[i];
+        if (rec.lsn > lastLSN) lastLSN = rec.lsn;
+        if (rec.lsn <= checkpointLSN) continue;
+
+        bool applied = rec.type == WAL_RESERVE ? applyReservation(rec.passenger)
+                                               : applyCancellation(rec.passenger.passengerID);
+        if (applied) replayed++;
+    }
+    delete[] records;
+
+    if (fileExists(logPath)) truncateFile(logPath, validBytes);
+    if (!log.open(logPath, lastLSN + 1)) {
+        error = "could not open " + logPath;
+        return false;
+    }
+    sinceCheckpoint = recordCount;
+    return true;
+}
+
+// ==================== LOGGED OPERATIONS ====================
+
+int ReservationJournal::findSeat(int row, char column) const {
+    for (int i = 0; i < count; i++) {
+        if (passengers[i].seatRow == row && passengers[i].seatColumn == column) return i;
+    }
+    return -1;
+}
+
+int ReservationJournal::findPassenger(const std::string& passengerID) const {
+    for (int i = 0; i < count; i++) {
+        if (!passengers[i].isEmpty && passengers[i].passengerID == passengerID) return i;
+    }
+    return -1;
+}
+
+// Fills the seat's empty record, or adds one for a seat the dataset did not list
+bool ReservationJournal::applyReservation(const Passenger& p) {
+    int index = findSeat(p.seatRow, p.seatColumn);
+    if (index >= 0 && !passengers[index].isEmpty) return false;
+
+    if (index < 0) {
+        if (count == capacity) {
+            int newCapacity = capacity < 16 ? 16 : capacity * 2;
+            Passenger* grown = new Passenger[newCapacity];
+            for (int i = 0; i < count; i++) grown[i] = std::move(passengers[i]);
+            delete[] passengers;
+            passengers = grown;
+            capacity = newCapacity;
+        }
+        index = count++;
+    }
+    passengers[index] = p;
+    passengers[index].isEmpty = false;
+    version++;
+    return true;
+}
+
+// The seat stays in the dataset as an empty record (same markers as the loaders)
+bool ReservationJournal::applyCancellation(const std::string& passengerID) {
+    int index = findPassenger(passengerID);
+    if (index < 0) return false;
+
+    Passenger& p = passengers[index];
+    p.passengerID = "EMPTY";
+    p.name = "Empty Seat";
+    p.isEmpty = true;
+    version++;
+    return true;
+}
+
+bool ReservationJournal::recordReservation(const Passenger& p) {
+    TRACE_SPAN("wal", "ReservationJournal::recordReservation");
+    int index = findSeat(p.seatRow, p.seatColumn);
+    if (index >= 0 && !passengers[index].isEmpty) return false;
+    if (!log.commit(log.appendReserve(p))) return false;
+
+    applyReservation(p);
+    afterCommit(1);
+    return true;
+}
+
+bool ReservationJournal::recordCancellation(const std::string& passengerID) {
+    TRACE_SPAN("wal", "ReservationJournal::recordCancellation");
+    if (findPassenger(passengerID) < 0) return false;
+    if (!log.commit(log.appendCancel(passengerID))) return false;
+
+    applyCancellation(passengerID);
+    afterCommit(1);
+    return true;
+}
+
+bool ReservationJournal::stageReservation(const Passenger& p) {
+    int index = findSeat(p.seatRow, p.seatColumn);
+    if (index >= 0 && !passengers[index].isEmpty) return false;
+
+    lastStagedLSN = log.appendReserve(p);
+    applyReservation(p);
+    staged++;
+    return true;
+}
+
+bool ReservationJournal::stageCancellation(const std::string& passengerID) {
+    if (findPassenger(passengerID) < 0) return false;
+
+    lastStagedLSN = log.appendCancel(passengerID);
+    applyCancellation(passengerID);
+    staged++;
+    return true;
+}
+
+bool ReservationJournal::commitStaged() {
+    TRACE_SPAN("wal", "ReservationJournal::commitStaged");
+    if (staged == 0) return true;
+    if (!log.commit(lastStagedLSN)) return false;
+
+    int operations = staged;
+    staged = 0;
+    afterCommit(operations);
+    return true;
+}
+
+void ReservationJournal::afterCommit(int operations) {
+    sinceCheckpoint += operations;
+    if (checkpointInterval > 0 && sinceCheckpoint >= checkpointInterval) checkpoint();
+}
+
+// ==================== CHECKPOINT ====================
+
+bool ReservationJournal::checkpoint() {
+    TRACE_SPAN("wal", "ReservationJournal::checkpoint");
+    if (!passengers) return false;
+    if (staged > 0) {
+        if (!log.commit(lastStagedLSN)) return false;
+        staged = 0;
+    }
+
+    // Every operation is committed before it is applied, so the durable LSN
+    // covers exactly what is in memory
+    uint64_t lsn = log.getDurableLSN();
+    const AircraftLayout& layout = activeLayout();
+    std::string temp = snapshotPath + ".tmp";
+
+    if (!writePassengersToBinary(temp.c_str(), passengers, count, layout.getRows(),
+                                 layout.getCols(), lsn) ||
+        !syncFile(temp)) {
+        std::remove(temp.c_str());
+        return false;
+    }
+#if defined(_WIN32)
+    std::remove(snapshotPath.c_str());   // rename() does not replace on Windows
+#endif
+    if (std::rename(temp.c_str(), snapshotPath.c_str()) != 0) {
+        std::remove(temp.c_str());
+        return false;
+    }
+    // The log may only be emptied once the new snapshot's directory entry is
+    // on disk; otherwise a crash could leave the old snapshot and no log
+    if (!syncDirectory(snapshotPath)) return false;
+
+    checkpointLSN = lsn;
+    sinceCheckpoint = 0;
+    return log.truncate();
+}
@@ -0,0 +1,85 @@
+#ifndef RESERVATION_JOURNAL_HPP
+#define RESERVATION_JOURNAL_HPP
+
+#include "Passenger.hpp"
+#include "WriteAheadLog.hpp"
+#include <string>
+#include <cstdint>
+
+// Durable copy of the passenger dataset.
+//
+// Every reservation and cancellation is logged and committed to
+// `<dataset>.wal` before it is applied. A checkpoint writes the whole dataset
+// to `<dataset>.snapshot.bin` (via a temporary file and rename) with the last
+// logged LSN in its header, then truncates the log. recover() loads the
+// snapshot, or the original dataset if there is none, and replays only the
+// log records past the snapshot's LSN. A crash between the rename and the
+// truncation therefore never applies a record twice.
+class ReservationJournal {
+public:
+    static const int DEFAULT_CHECKPOINT_INTERVAL = 1000;   // logged operations
+
+    explicit ReservationJournal(const std::string& datasetPath);
+    ~ReservationJournal();
+
+    ReservationJournal(const ReservationJournal&) = delete;
+    ReservationJournal& operator=(const ReservationJournal&) = delete;
+
+    bool recover(std::string& error);
+
+    // Both return false (and change nothing) if the operation does not apply
+    // to the current data or cannot be made durable
+    bool recordReservation(const Passenger& p);
+    bool recordCancellation(const std::string& passengerID);
+
+    // Batched variants for callers that group many operations per commit
+    // (one fsync for the whole group). stage*() validate, log and apply
+    // without waiting for the disk; commitStaged() makes everything staged so
+    // far durable. Staged changes are in memory before they are durable, so
+    // they must not be acknowledged until commitStaged() returns true.
+    bool stageReservation(const Passenger& p);
+    bool stageCancellation(const std::string& passengerID);
+    bool commitStaged();
+    int getStagedCount() const { return staged; }
+    void setCommitWindowMicros(int micros) { log.setCommitWindowMicros(micros); }
+
+    bool checkpoint();
+    void setCheckpointInterval(int operations) { checkpointInterval = operations; }
+
+    const Passenger* getPassengers() const { return passengers; }
+    int getPassengerCount() const { return count; }
+    long getVersion() const { return version; }          // bumps on every applied change
+    int getReplayedCount() const { return replayed; }
+    int getUncheckpointedCount() const { return sinceCheckpoint; }   // operations only in the log
+    bool restoredFromSnapshot() const { return fromSnapshot; }
+    uint64_t getCheckpointLSN() const { return checkpointLSN; }
+    const std::string& getSnapshotPath() const { return snapshotPath; }
+    const std::string& getLogPath() const { return logPath; }
+
+private:
+    int findSeat(int row, char column) const;
+    int findPassenger(const std::string& passengerID) const;
+    bool applyReservation(const Passenger& p);
+    bool applyCancellation(const std::string& passengerID);
+    void afterCommit(int operations);
+
+    std::string datasetPath;
+    std::string snapshotPath;
+    std::string logPath;
+    WriteAheadLog log;
+
+    Passenger* passengers;
+    int count;
+    int capacity;
+
+    uint64_t checkpointLSN;
+    int checkpointInterval;
+    int sinceCheckpoint;
+    int staged;              // applied and logged, not yet committed
+    uint64_t lastStagedLSN;
+    int replayed;
+    bool fromSnapshot;
+    long version;
+};
+
+#endif
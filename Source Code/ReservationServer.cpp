@@ -0,0 +1,628 @@
+#include "ReservationServer.hpp"
+#include "ServerProtocol.hpp"
+#include "PassengerBinary.hpp"
+#include "AircraftLayout.hpp"
+#include "Trace.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <csignal>
+#include <cerrno>
+#endif
+
+// ==================== SERVICE ====================
+
+// Highest numeric passenger ID, so new bookings never reuse one
+static long maxNumericID(const Passenger* passengers, int count) {
+    long maxID = 0;
+    for (int i = 0; i < count; i++) {
+        if (passengers[i].isEmpty) continue;
+        char* end = nullptr;
+        long id = std::strtol(passengers[i].passengerID.c_str(), &end, 10);
+        if (*end == '\0' && id > maxID) maxID = id;
+    }
+    return maxID;
+}
+
+ReservationService::ReservationService(const AircraftLayout& layout, const Passenger* passengers, int count,
+                                       ReservationJournal* j)
+    : fleet(maxNumericID(passengers, count) + 1), flight(nullptr), journal(j) {
+    flight = fleet.addFlight("FRS", 0, layout);
+    for (int i = 0; i < count; i++) {
+        if (!passengers[i].isEmpty) fleet.place(flight, passengers[i]);
+    }
+}
+
+int ReservationService::reserve(const std::string& name, const std::string& cls, Passenger& out) {
+    if (!fleet.book(flight, name, cls, out)) return STATUS_FULL;
+    if (journal && !journal->stageReservation(out)) {
+        fleet.cancel(out.passengerID);
+        return STATUS_NOT_SAVED;
+    }
+    return STATUS_OK;
+}
+
+int ReservationService::cancel(const std::string& passengerID) {
+    if (!fleet.findPassenger(passengerID)) return STATUS_NOT_FOUND;
+    if (journal && !journal->stageCancellation(passengerID)) return STATUS_NOT_SAVED;
+    fleet.cancel(passengerID);
+    return STATUS_OK;
+}
+
+const Passenger* ReservationService::findByID(const std::string& passengerID) const {
+    return fleet.findPassenger(passengerID);
+}
+
+const Passenger* ReservationService::findBySeat(int row, char column) const {
+    return flight->findBySeat(row, column);
+}
+
+bool ReservationService::commit() {
+    return journal ? journal->commitStaged() : true;
+}
+
+// ==================== OPTIONS ====================
+
+struct ServeOptions {
+    std::string socketPath;
+    int port;
+    std::string dataset;
+    int maxBatch;
+    int commitWindowMicros;
+    bool journal;
+
+    ServeOptions()
+        : port(7400), dataset("Updated_Passenger_List.csv"), maxBatch(256), commitWindowMicros(0),
+          journal(true) {}
+};
+
+static bool parseServeOptions(int argc, char** argv, ServeOptions& opts) {
+    for (int i = 0; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") return false;
+        if (arg == "--no-journal") {
+            opts.journal = false;
+            continue;
+        }
+
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << "\n";
+            return false;
+        }
+        const char* value = argv[++i];
+
+        if (arg == "--socket") {
+            opts.socketPath = value;
+        } else if (arg == "--port") {
+            opts.port = std::atoi(value);
+        } else if (arg == "--dataset") {
+            opts.dataset = value;
+        } else if (arg == "--layout") {
+            AircraftLayout layout;
+            std::string error;
+            if (!loadAircraftLayout(value, layout, error)) {
+                std::cerr << "Invalid layout: " << error << "\n";
+                return false;
+            }
+            setActiveLayout(layout);
+        } else if (arg == "--max-batch") {
+            opts.maxBatch = std::atoi(value);
+        } else if (arg == "--commit-window") {
+            opts.commitWindowMicros = std::atoi(value);
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            return false;
+        }
+    }
+    if (opts.maxBatch < 1) opts.maxBatch = 1;
+    return true;
+}
+
+void printServeUsage() {
+    std::cout << "Usage: <program> --serve [options]\n"
+              << "  --socket PATH         listen on a Unix domain socket\n"
+              << "  --port N              listen on 127.0.0.1:N (default 7400)\n"
+              << "  --dataset PATH        passengers to serve (default Updated_Passenger_List.csv)\n"
+              << "  --layout SPEC         default, narrow, wide or a seat-map file\n"
+              << "  --max-batch N         writes per log commit (default 256)\n"
+              << "  --commit-window N     group commit window in microseconds (default 0)\n"
+              << "  --no-journal          keep changes in memory only\n";
+}
+
+#if defined(__linux__)
+
+// ==================== EVENT LOOP ====================
+
+static const int MAX_EVENTS = 64;
+static const size_t READ_CHUNK = 16 * 1024;
+static const size_t OUTPUT_HIGH_WATER = 1024 * 1024;   // stop reading a client this far behind
+
+static volatile sig_atomic_t stopRequested = 0;
+
+static void onStopSignal(int) {
+    stopRequested = 1;
+}
+
+struct Connection {
+    int fd;
+    ByteBuffer in;
+    ByteBuffer out;
+    uint32_t events;     // current epoll interest
+    bool peerClosed;     // EOF seen: answer what arrived, then close
+    bool broken;         // socket error or protocol violation: close now
+    bool inBatch;        // already on this iteration's ready list
+    bool framesPending;  // whole requests still buffered after the last batch
+};
+
+// A write whose response waits for the batch commit
+struct StagedReply {
+    Connection* conn;
+    size_t statusOffset;
+};
+
+class ReservationServer {
+private:
+    ReservationService& service;
+    int maxBatch;
+    int epollFd;
+    int listenFd;
+
+    Connection** connections;
+    int connectionCount;
+    int connectionCapacity;
+
+    Connection** ready;          // connections with input or drained output this iteration
+    int readyCount;
+    StagedReply* staged;         // writes awaiting the current commit
+    int stagedCount;
+
+    long requests;
+    long batches;
+    long commits;
+    long failedCommits;
+
+    bool setInterest(Connection* conn, uint32_t events);
+    void acceptAll();
+    void readAll(Connection* conn);
+    void flush(Connection* conn);
+    void closeConnection(int index);
+    void markReady(Connection* conn);
+    void handleFrames(Connection* conn);
+    void handleRequest(Connection* conn, uint32_t requestID, int opcode, FrameReader& in);
+    void commitBatch();
+
+public:
+    ReservationServer(ReservationService& svc, int batchLimit);
+    ~ReservationServer();
+
+    bool listenUnix(const std::string& path);
+    bool listenTCP(int port);
+    void run();
+    void printStats() const;
+};
+
+static bool setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+ReservationServer::ReservationServer(ReservationService& svc, int batchLimit)
+    : service(svc), maxBatch(batchLimit), epollFd(-1), listenFd(-1),
+      connections(nullptr), connectionCount(0), connectionCapacity(0),
+      ready(nullptr), readyCount(0), staged(nullptr), stagedCount(0),
+      requests(0), batches(0), commits(0), failedCommits(0) {
+    epollFd = epoll_create1(0);
+    staged = new StagedReply[maxBatch];
+}
+
+ReservationServer::~ReservationServer() {
+    while (connectionCount > 0) closeConnection(connectionCount - 1);
+    delete[] connections;
+    delete[] ready;
+    delete[] staged;
+    if (listenFd >= 0) close(listenFd);
+    if (epollFd >= 0) close(epollFd);
+}
+
+bool ReservationServer::listenUnix(const std::string& path) {
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) return false;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) return false;
+    struct stat st;
+    if (lstat(path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode)) unlink(path.c_str());   // stale socket from an earlier run
+    if (bind(listenFd, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(listenFd, 128) != 0) return false;
+
+    epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = nullptr;   // the listener
+    return setNonBlocking(listenFd) && epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &ev) == 0;
+}
+
+bool ReservationServer::listenTCP(int port) {
+    sockaddr_in addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0) return false;
+    int on = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    if (bind(listenFd, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(listenFd, 128) != 0) return false;
+
+    epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = nullptr;
+    return setNonBlocking(listenFd) && epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &ev) == 0;
+}
+
+bool ReservationServer::setInterest(Connection* conn, uint32_t events) {
+    if (conn->events == events) return true;
+    epoll_event ev;
+    ev.events = events;
+    ev.data.ptr = conn;
+    conn->events = events;
+    return epoll_ctl(epollFd, EPOLL_CTL_MOD, conn->fd, &ev) == 0;
+}
+
+void ReservationServer::acceptAll() {
+    while (true) {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) return;   // EAGAIN: no more pending connections
+        setNonBlocking(fd);
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));   // fails harmlessly on Unix sockets
+
+        if (connectionCount == connectionCapacity) {
+            int newCapacity = connectionCapacity == 0 ? 16 : connectionCapacity * 2;
+            Connection** grown = new Connection*[newCapacity];
+            for (int i = 0; i < connectionCount; i++) grown[i] = connections[i];
+            delete[] connections;
+            connections = grown;
+            Connection** grownReady = new Connection*[newCapacity];
+            for (int i = 0; i < readyCount; i++) grownReady[i] = ready[i];
+            delete[] ready;
+            ready = grownReady;
+            connectionCapacity = newCapacity;
+        }
+
+        Connection* conn = new Connection();
+        conn->fd = fd;
+        conn->events = EPOLLIN;
+        conn->peerClosed = conn->broken = conn->inBatch = conn->framesPending = false;
+
+        epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.ptr = conn;
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+            close(fd);
+            delete conn;
+            continue;
+        }
+        connections[connectionCount++] = conn;
+    }
+}
+
+void ReservationServer::readAll(Connection* conn) {
+    while (true) {
+        unsigned char* dst = conn->in.prepare(READ_CHUNK);
+        ssize_t n = recv(conn->fd, dst, READ_CHUNK, 0);
+        if (n > 0) {
+            conn->in.commit((size_t)n);
+            continue;
+        }
+        if (n == 0) conn->peerClosed = true;
+        else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) conn->broken = true;
+        return;
+    }
+}
+
+void ReservationServer::flush(Connection* conn) {
+    while (!conn->out.empty()) {
+        ssize_t n = send(conn->fd, conn->out.begin(), conn->out.size(), MSG_NOSIGNAL);
+        if (n > 0) {
+            conn->out.consume((size_t)n);
+            continue;
+        }
+        if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) conn->broken = true;
+        break;
+    }
+    // Output backlog: wait for EPOLLOUT, and stop reading while far behind
+    uint32_t events = (conn->out.size() > OUTPUT_HIGH_WATER || conn->peerClosed) ? 0u : (uint32_t)EPOLLIN;
+    if (!conn->out.empty()) events |= EPOLLOUT;
+    if (!setInterest(conn, events)) conn->broken = true;
+}
+
+void ReservationServer::closeConnection(int index) {
+    Connection* conn = connections[index];
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, conn->fd, nullptr);
+    close(conn->fd);
+    delete conn;
+    connections[index] = connections[--connectionCount];
+}
+
+void ReservationServer::markReady(Connection* conn) {
+    if (conn->inBatch) return;
+    conn->inBatch = true;
+    ready[readyCount++] = conn;
+}
+
+// ==================== REQUESTS ====================
+
+void ReservationServer::handleFrames(Connection* conn) {
+    while (!conn->broken && conn->out.size() <= OUTPUT_HIGH_WATER) {
+        long length = completeFrameLength(conn->in);
+        if (length < 0) {
+            conn->broken = true;   // oversized frame: the stream cannot be resynchronized
+            return;
+        }
+        if (length == 0) return;
+
+        const unsigned char* frame = conn->in.begin();
+        uint32_t requestID = (uint32_t)frame[4] | ((uint32_t)frame[5] << 8) |
+                             ((uint32_t)frame[6] << 16) | ((uint32_t)frame[7] << 24);
+        FrameReader in(frame + 9, (size_t)length - 9);
+        handleRequest(conn, requestID, frame[8], in);
+        conn->in.consume((size_t)length);
+        requests++;
+    }
+}
+
+void ReservationServer::handleRequest(Connection* conn, uint32_t requestID, int opcode, FrameReader& in) {
+    switch (opcode) {
+        case OP_RESERVE: {
+            std::string name = in.getString();
+            std::string cls = in.getString();
+            if (!in.ok()) break;
+            Passenger p;
+            int status = service.reserve(name, cls, p);
+            FrameWriter out(conn->out, requestID, status);
+            if (status == STATUS_OK) out.putPassenger(p);
+            out.finish();
+            if (status == STATUS_OK && service.isDurable()) {
+                staged[stagedCount].conn = conn;
+                staged[stagedCount].statusOffset = out.codeOffset();
+                if (++stagedCount == maxBatch) commitBatch();
+            }
+            return;
+        }
+        case OP_CANCEL: {
+            std::string id = in.getString();
+            if (!in.ok()) break;
+            int status = service.cancel(id);
+            FrameWriter out(conn->out, requestID, status);
+            out.finish();
+            if (status == STATUS_OK && service.isDurable()) {
+                staged[stagedCount].conn = conn;
+                staged[stagedCount].statusOffset = out.codeOffset();
+                if (++stagedCount == maxBatch) commitBatch();
+            }
+            return;
+        }
+        case OP_LOOKUP_ID:
+        case OP_LOOKUP_SEAT: {
+            const Passenger* p = nullptr;
+            if (opcode == OP_LOOKUP_ID) {
+                std::string id = in.getString();
+                if (!in.ok()) break;
+                p = service.findByID(id);
+            } else {
+                int row = (int)in.getU16();
+                char column = (char)in.getU8();
+                if (!in.ok()) break;
+                p = service.findBySeat(row, column);
+            }
+            FrameWriter out(conn->out, requestID, p ? STATUS_OK : STATUS_NOT_FOUND);
+            if (p) out.putPassenger(*p);
+            out.finish();
+            return;
+        }
+        case OP_MANIFEST: {
+            uint32_t offset = in.getU32();
+            int limit = (int)in.getU16();
+            if (!in.ok()) break;
+            int total = service.getPassengerCount();
+            if (limit > MANIFEST_PAGE_MAX) limit = MANIFEST_PAGE_MAX;
+            int first = offset < (uint32_t)total ? (int)offset : total;
+            int count = total - first < limit ? total - first : limit;
+
+            FrameWriter out(conn->out, requestID, STATUS_OK);
+            out.putU32((uint32_t)total);
+            out.putU16((uint32_t)count);
+            for (int i = 0; i < count; i++) out.putPassenger(service.at(first + i));
+            out.finish();
+            return;
+        }
+        default:
+            break;
+    }
+    FrameWriter out(conn->out, requestID, STATUS_BAD_REQUEST);
+    out.finish();
+}
+
+// One log commit for every staged write. On failure the writes stay applied
+// in memory but are answered NOT_SAVED instead of OK.
+void ReservationServer::commitBatch() {
+    if (stagedCount == 0) return;
+    commits++;
+    if (!service.commit()) {
+        failedCommits++;
+        for (int i = 0; i < stagedCount; i++) {
+            staged[i].conn->out.begin()[staged[i].statusOffset] = (unsigned char)STATUS_NOT_SAVED;
+        }
+    }
+    stagedCount = 0;
+}
+
+void ReservationServer::run() {
+    epoll_event events[MAX_EVENTS];
+    int pendingCount = 0;
+    while (!stopRequested) {
+        // Buffered requests can be handled now, so only poll the sockets
+        int n = epoll_wait(epollFd, events, MAX_EVENTS, pendingCount > 0 ? 0 : -1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            std::cerr << "epoll_wait: " << std::strerror(errno) << "\n";
+            return;
+        }
+
+        // 1. Accept, read everything available and drain pending output
+        readyCount = 0;
+        if (pendingCount > 0) {
+            for (int i = 0; i < connectionCount; i++) {
+                if (connections[i]->framesPending) markReady(connections[i]);
+            }
+            pendingCount = 0;
+        }
+        for (int i = 0; i < n; i++) {
+            Connection* conn = (Connection*)events[i].data.ptr;
+            if (!conn) {
+                acceptAll();
+                continue;
+            }
+            if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) readAll(conn);
+            if (events[i].events & EPOLLOUT) flush(conn);
+            markReady(conn);
+        }
+
+        // 2. Every complete request from every ready connection is one batch
+        {
+            TRACE_SPAN("server", "ReservationServer::batch");
+            for (int i = 0; i < readyCount; i++) handleFrames(ready[i]);
+            commitBatch();
+        }
+        batches++;
+
+        // 3. Responses go out only after the commit
+        for (int i = 0; i < readyCount; i++) {
+            ready[i]->inBatch = false;
+            if (!ready[i]->broken) flush(ready[i]);
+        }
+        for (int i = connectionCount - 1; i >= 0; i--) {
+            Connection* conn = connections[i];
+            bool finished = conn->peerClosed && conn->out.empty() && completeFrameLength(conn->in) == 0;
+            if (conn->broken || finished) {
+                closeConnection(i);
+                continue;
+            }
+            // handleFrames stopped at the high-water mark; once the output is
+            // below it again, no event will arrive for what is still buffered
+            conn->framesPending = conn->out.size() <= OUTPUT_HIGH_WATER && completeFrameLength(conn->in) != 0;
+            if (conn->framesPending) pendingCount++;
+        }
+    }
+}
+
+void ReservationServer::printStats() const {
+    std::cout << "Requests: " << requests << " in " << batches << " batches";
+    if (batches > 0) {
+        std::cout << " (" << std::fixed << std::setprecision(1) << (double)requests / batches << " per batch)";
+    }
+    std::cout << "\nLog commits: " << commits;
+    if (failedCommits > 0) std::cout << " (" << failedCommits << " FAILED)";
+    std::cout << "\n";
+}
+
+// ==================== ENTRY POINT ====================
+
+int runServeCli(int argc, char** argv) {
+    ServeOptions opts;
+    if (!parseServeOptions(argc, argv, opts)) {
+        printServeUsage();
+        return 2;
+    }
+
+    // Same durable files as the interactive menus; do not run both at once
+    ReservationJournal* journal = nullptr;
+    Passenger* loaded = nullptr;
+    int loadedCount = 0;
+    if (opts.journal) {
+        journal = new ReservationJournal(opts.dataset);
+        std::string error;
+        if (!journal->recover(error)) {
+            std::cerr << "Could not load passengers: " << error << "\n";
+            delete journal;
+            return 1;
+        }
+        journal->setCommitWindowMicros(opts.commitWindowMicros);
+    } else {
+        loaded = readPassengersFromFile(opts.dataset.c_str(), &loadedCount);
+        if (!loaded) {
+            std::cerr << "No data loaded from " << opts.dataset << "\n";
+            return 1;
+        }
+    }
+
+    int status = 0;
+    {
+        ReservationService service(activeLayout(), journal ? journal->getPassengers() : loaded,
+                                   journal ? journal->getPassengerCount() : loadedCount, journal);
+        ReservationServer server(service, opts.maxBatch);
+
+        bool listening = opts.socketPath.empty() ? server.listenTCP(opts.port) : server.listenUnix(opts.socketPath);
+        if (!listening) {
+            std::cerr << "Could not listen on "
+                      << (opts.socketPath.empty() ? "127.0.0.1:" + std::to_string(opts.port) : opts.socketPath)
+                      << ": " << std::strerror(errno) << "\n";
+            status = 1;
+        } else {
+            // No SA_RESTART, so a signal interrupts epoll_wait
+            struct sigaction sa;
+            std::memset(&sa, 0, sizeof(sa));
+            sa.sa_handler = onStopSignal;
+            sigaction(SIGINT, &sa, nullptr);
+            sigaction(SIGTERM, &sa, nullptr);
+            signal(SIGPIPE, SIG_IGN);
+
+            std::cout << "Serving " << service.getPassengerCount() << " passengers on "
+                      << (opts.socketPath.empty() ? "127.0.0.1:" + std::to_string(opts.port) : opts.socketPath)
+                      << (journal ? " (journal " + journal->getLogPath() + ")" : std::string(" (in memory only)"))
+                      << "\n" << std::flush;
+            server.run();
+            server.printStats();
+            if (!opts.socketPath.empty()) unlink(opts.socketPath.c_str());
+        }
+    }
+
+    if (journal) {
+        if (journal->getUncheckpointedCount() > 0 && !journal->checkpoint()) {
+            std::cerr << "WARNING: checkpoint failed; changes remain in " << journal->getLogPath() << "\n";
+        }
+        delete journal;
+    }
+    delete[] loaded;
+    return status;
+}
+
+#else
+
+int runServeCli(int argc, char** argv) {
+    ServeOptions opts;
+    if (!parseServeOptions(argc, argv, opts)) {
+        printServeUsage();
+        return 2;
+    }
+    std::cerr << "Server mode needs Linux (epoll)\n";
+    return 1;
+}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef RESERVATION_SERVER_HPP
+#define RESERVATION_SERVER_HPP
+
+#include "Passenger.hpp"
+#include "FleetStore.hpp"
+#include "ReservationJournal.hpp"
+#include <string>
+
+// Server mode: `<program> --serve [options]`.
+// Serves one flight over the binary protocol in ServerProtocol.hpp from a
+// single epoll event loop (Linux only). Requests from every connection that
+// became ready are handled as one batch: the batch's reservations and
+// cancellations share one log commit, and no response in the batch is sent
+// before that commit is durable.
+//
+// Options:
+//   --socket PATH         listen on a Unix domain socket
+//   --port N              listen on 127.0.0.1:N (default 7400 unless --socket)
+//   --dataset PATH        passengers to serve (default Updated_Passenger_List.csv)
+//   --layout SPEC         aircraft: default, narrow, wide or a seat-map file
+//   --max-batch N         writes per log commit (default 256)
+//   --commit-window N     group commit window in microseconds (default 0)
+//   --no-journal          keep changes in memory only
+// Runs until SIGINT/SIGTERM, then checkpoints the journal.
+// Returns a process exit code (0 on success).
+int runServeCli(int argc, char** argv);
+
+void printServeUsage();
+
+// The server's engine: one FleetStore flight (hash index by ID, seat index,
+// manifest in booking order) with optional write-ahead logging. Writes are
+// staged in the journal; commit() makes them durable.
+class ReservationService {
+private:
+    FleetStore fleet;
+    FlightShard* flight;
+    ReservationJournal* journal;   // nullptr = in memory only
+
+public:
+    // Books every occupied record of `passengers` that fits the layout
+    ReservationService(const AircraftLayout& layout, const Passenger* passengers, int count,
+                       ReservationJournal* journal = nullptr);
+
+    ReservationService(const ReservationService&) = delete;
+    ReservationService& operator=(const ReservationService&) = delete;
+
+    // Both return a STATUS_* code from ServerProtocol.hpp
+    int reserve(const std::string& name, const std::string& cls, Passenger& out);
+    int cancel(const std::string& passengerID);
+
+    const Passenger* findByID(const std::string& passengerID) const;
+    const Passenger* findBySeat(int row, char column) const;
+
+    // Manifest access in booking order
+    int getPassengerCount() const { return flight->getPassengerCount(); }
+    const Passenger& at(int index) const { return flight->at(index); }
+
+    bool isDurable() const { return journal != nullptr; }
+    int getStagedCount() const { return journal ? journal->getStagedCount() : 0; }
+    // Makes every staged write durable; false if that failed
+    bool commit();
+};
+
+#endif
@@ -0,0 +1,106 @@
+#include "ReservationSystem.hpp"
+#include "Trace.hpp"
+#include <string>
+
+template <class Storage, class Index, class Occupancy>
+ReservationSystem<Storage, Index, Occupancy>::ReservationSystem(const AircraftLayout& seatMap)
+    : layout(seatMap), seatTaken(0, 0), capacity(0), nextID(0) {
+    // Fixed instantiations keep their compile-time geometry
+    HeapScope scope(this->heap);
+    seatTaken.resize(layout.getRows(), layout.getCols());
+    capacity = seatTaken.getRows() * seatTaken.getCols();
+}
+
+template <class Storage, class Index, class Occupancy>
+void ReservationSystem<Storage, Index, Occupancy>::init(const Passenger* passengers, int passengerCount, int maxID) {
+    TRACE_SPAN("index", "ReservationSystem::init");
+    this->clear();
+    this->reserve(capacity);
+    {
+        HeapScope scope(indexHeap);
+        idIndex.clear();
+    }
+    nextID = maxID + 1;
+
+    // Clear seat bitmap; blocked seats are never assignable
+    HeapScope scope(this->heap);
+    seatTaken.clear();
+    layout.markBlocked(seatTaken);
+
+    // Seats outside this layout are skipped
+    for (int i = 0; i < passengerCount && this->size() < capacity; i++) {
+        const Passenger& p = passengers[i];
+        int r = p.seatRow - 1;
+        int c = p.seatColumn - 'A';
+        if (p.isEmpty || r < 0 || r >= seatTaken.getRows() || c < 0 || c >= seatTaken.getCols()) continue;
+
+        Passenger* stored = this->add(p);
+        seatTaken.reserve(r, c);
+        HeapScope indexScope(indexHeap);
+        idIndex.insert(stored->passengerID, stored);
+    }
+}
+
+template <class Storage, class Index, class Occupancy>
+bool ReservationSystem<Storage, Index, Occupancy>::reserveNoIndex(const std::string& name, const std::string& cls, Passenger& out) {
+    return reserveInternal(name, cls, out, false);
+}
+
+template <class Storage, class Index, class Occupancy>
+bool ReservationSystem<Storage, Index, Occupancy>::reserveWithIndex(const std::string& name, const std::string& cls, Passenger& out) {
+    return reserveInternal(name, cls, out, true);
+}
+
+template <class Storage, class Index, class Occupancy>
+bool ReservationSystem<Storage, Index, Occupancy>::reserveInternal(const std::string& name, const std::string& cls,
+                                                                   Passenger& out, bool maintainIndex) {
+    TRACE_SPAN("reserve", "ReservationSystem::reserveInternal");
+    // First free seat via the occupancy bitmap (lowest clear bit of the first open row)
+    int r, c;
+    if (this->size() >= capacity || !seatTaken.findFirstAvailable(r, c)) return false;
+
+    seatTaken.reserve(r, c);
+    Passenger* p = this->add(Passenger(std::to_string(nextID++), name, r + 1, (char)('A' + c), cls, false));
+
+    if (maintainIndex) {
+        HeapScope scope(indexHeap);
+        idIndex.insert(p->passengerID, p);
+    }
+
+    out = *p;
+    return true;
+}
+
+template <class Storage, class Index, class Occupancy>
+const Passenger* ReservationSystem<Storage, Index, Occupancy>::searchLinear(const std::string& id) const {
+    return this->scan(id);
+}
+
+// Only what the index holds: records booked without it are not found
+template <class Storage, class Index, class Occupancy>
+const Passenger* ReservationSystem<Storage, Index, Occupancy>::searchIndexed(const std::string& id) const {
+    Passenger* found;
+    return idIndex.find(id, found) ? found : nullptr;
+}
+
+template <class Storage, class Index, class Occupancy>
+long ReservationSystem<Storage, Index, Occupancy>::memoryLinear() const {
+    // Records, their string buffers and the seat bitmap are all on the heap
+    return (long)this->memoryUsage();
+}
+
+template <class Storage, class Index, class Occupancy>
+long ReservationSystem<Storage, Index, Occupancy>::memoryIndexed() const {
+    return memoryLinear() + (long)indexHeap.stats().footprintBytes;
+}
+
+// Contiguous and arena-list storage, each with runtime-sized geometry and the
+// fixed-geometry built-in layouts
+template class ReservationSystem<ArrayStorage, DenseIndex, SeatOccupancy>;
+template class ReservationSystem<ArrayStorage, DenseIndex, FixedSeatOccupancy<DEFAULT_LAYOUT_ROWS, DEFAULT_LAYOUT_COLS> >;
+template class ReservationSystem<ArrayStorage, DenseIndex, FixedSeatOccupancy<NARROW_LAYOUT_ROWS, NARROW_LAYOUT_COLS> >;
+template class ReservationSystem<ArrayStorage, DenseIndex, FixedSeatOccupancy<WIDE_LAYOUT_ROWS, WIDE_LAYOUT_COLS> >;
+template class ReservationSystem<ArenaListStorage, DenseIndex, SeatOccupancy>;
+template class ReservationSystem<ArenaListStorage, DenseIndex, FixedSeatOccupancy<DEFAULT_LAYOUT_ROWS, DEFAULT_LAYOUT_COLS> >;
+template class ReservationSystem<ArenaListStorage, DenseIndex, FixedSeatOccupancy<NARROW_LAYOUT_ROWS, NARROW_LAYOUT_COLS> >;
+template class ReservationSystem<ArenaListStorage, DenseIndex, FixedSeatOccupancy<WIDE_LAYOUT_ROWS, WIDE_LAYOUT_COLS> >;
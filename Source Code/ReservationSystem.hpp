@@ -0,0 +1,55 @@
+#ifndef RESERVATION_SYSTEM_HPP
+#define RESERVATION_SYSTEM_HPP
+
+#include "PassengerSystem.hpp"
+#include "SeatOccupancy.hpp"
+#include "AircraftLayout.hpp"
+#include <string>
+
+// Seat booking on top of PassengerSystem. The Storage policy holds the
+// passengers; the Occupancy policy finds free seats and is either the
+// runtime-sized SeatOccupancy or a FixedSeatOccupancy<R, C> instantiation
+// (built-in layouts, instantiated in ReservationSystem.cpp).
+//
+// The ID index is a separate Index policy with its own heap account. Only
+// reserveWithIndex() updates it, so the two insertion techniques can be
+// compared. init() reserves storage for every seat, so records never move
+// and reserving never allocates.
+template <class Storage, class Index, class Occupancy>
+class ReservationSystem : public PassengerSystem<Storage, NoIndex, MergeSort> {
+public:
+    explicit ReservationSystem(const AircraftLayout& layout = activeLayout());
+
+    // Occupied passengers seated inside the layout; new IDs start after maxID
+    void init(const Passenger* passengers, int passengerCount, int maxID);
+
+    // Technique 1 (Linear-tech insertion): NO index maintenance
+    bool reserveNoIndex(const std::string& name, const std::string& cls, Passenger& out);
+
+    // Technique 2 (Indexed-tech insertion): maintains the ID index
+    bool reserveWithIndex(const std::string& name, const std::string& cls, Passenger& out);
+
+    const Passenger* searchLinear(const std::string& id) const;
+    const Passenger* searchIndexed(const std::string& id) const;
+
+    // Tracked heap (see HeapTracker.hpp); Indexed adds the ID index
+    long memoryLinear() const;
+    long memoryIndexed() const;
+
+    int getPassengerCount() const { return this->size(); }
+    int getMaxID() const { return nextID - 1; }
+    int getCapacity() const { return capacity; }
+
+private:
+    bool reserveInternal(const std::string& name, const std::string& cls,
+                         Passenger& out, bool maintainIndex);
+
+    HeapAccount indexHeap;  // ID index only
+    Index idIndex;
+    AircraftLayout layout;
+    Occupancy seatTaken;    // one bit per seat
+    int capacity;           // seats in the layout
+    int nextID;
+};
+
+#endif
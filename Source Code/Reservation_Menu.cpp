@@ -1,7 +1,10 @@
 #include "Reservation_Menu.hpp"
 #include "ArrayReservation.hpp"
 #include "LinkedListReservation.hpp"
+#include "ConcurrentReservation.hpp"
+#include "Benchmark.hpp"
 #include <iostream>
+#include <thread>
 #include <iomanip>
 #include <chrono>
 #include <cstring>
@@ -25,27 +28,26 @@ static void sub(const char* t) {
     bar('-'); 
 }
 
-static long long usSince(const std::chrono::steady_clock::time_point& a,
-                         const std::chrono::steady_clock::time_point& b) {
-    return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count();
-}
-
 static double fasterPct(double slower, double faster) {
     if (slower <= 0.0) return 0.0;
     return ((slower - faster) / slower) * 100.0;
 }
 
-static void winnerLine(const char* label, long long arr_us, long long list_us) {
-    std::cout << label << "\n";
-    std::cout << "Array Time      : " << arr_us << " microseconds\n";
-    std::cout << "Linked List Time: " << list_us << " microseconds\n";
-
-    if (arr_us < list_us) {
-        std::cout << "Array is " << std::fixed << std::setprecision(1)
-                  << fasterPct((double)list_us, (double)arr_us) << "% faster\n";
-    } else if (list_us < arr_us) {
-        std::cout << "Linked List is " << std::fixed << std::setprecision(1)
-                  << fasterPct((double)arr_us, (double)list_us) << "% faster\n";
+static void winnerLine(const char* label, const BenchmarkResult& arr, const BenchmarkResult& list) {
+    double arr_ns = arr.medianNs;
+    double list_ns = list.medianNs;
+
+    std::cout << label << " (ns per operation)\n";
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Array Time      : median " << arr_ns << "  p90 " << arr.p90Ns
+              << "  p99 " << arr.p99Ns << "  stddev " << arr.stddevNs << "\n";
+    std::cout << "Linked List Time: median " << list_ns << "  p90 " << list.p90Ns
+              << "  p99 " << list.p99Ns << "  stddev " << list.stddevNs << "\n";
+
+    if (arr_ns < list_ns) {
+        std::cout << "Array is " << fasterPct(list_ns, arr_ns) << "% faster\n";
+    } else if (list_ns < arr_ns) {
+        std::cout << "Linked List is " << fasterPct(arr_ns, list_ns) << "% faster\n";
     } else {
         std::cout << "Tie\n";
     }
@@ -81,8 +83,8 @@ int readChoice() {
 
     int choice = atoi(buffer);
 
-    if (choice < 0 || choice > 3) {
-        std::cout << "ERROR: Invalid choice. Please select 0 to 3.\n\n";
+    if (choice < 0 || choice > 4) {
+        std::cout << "ERROR: Invalid choice. Please select 0 to 4.\n\n";
         return -1;
     }
 
@@ -107,9 +109,12 @@ int findMaxID(const Passenger* passengers, int passengerCount) {
 }
 
 // Main reservation menu function
-void showReservationMenu(const Passenger* loadedPassengers, int loadedPassengerCount) {
+void showReservationMenu(const Passenger* loadedPassengers, int loadedPassengerCount,
+                         ReservationJournal* journal) {
     header("FLIGHT RESERVATION SYSTEM (INSERTION ONLY)");
-    std::cout << "Seats: 400 rows x A-Z columns (10400 seats)\n";
+    const AircraftLayout& layout = activeLayout();
+    std::cout << "Seats: " << layout.getRows() << " rows x A-" << (char)('A' + layout.getCols() - 1)
+              << " columns (" << layout.getSeatCount() << " seats)\n";
     std::cout << "Dataset: Name=\"Empty\" means available seat\n\n";
 
     // Count occupied passengers
@@ -130,6 +135,9 @@ void showReservationMenu(const Passenger* loadedPassengers, int loadedPassengerC
 
     sub("DATASET LOADED");
     std::cout << "Occupied passengers: " << occupiedCount << "\n";
+    if (arr.getPassengerCount() != occupiedCount) {
+        std::cout << "Seated in layout   : " << arr.getPassengerCount() << "\n";
+    }
     std::cout << "Max PassengerID    : " << maxID << "\n\n";
 
     while (true) {
@@ -137,6 +145,7 @@ void showReservationMenu(const Passenger* loadedPassengers, int loadedPassengerC
         std::cout << "1. Reservation (Array)\n";
         std::cout << "2. Reservation (Linked List)\n";
         std::cout << "3. Performance Comparison (Insertion + Search + Memory)\n";
+        std::cout << "4. Concurrent Booking Stress Test (1 to N threads)\n";
         std::cout << "0. Exit\n";
         int choice = readChoice();
         if (choice == -1) continue;
@@ -154,33 +163,39 @@ void showReservationMenu(const Passenger* loadedPassengers, int loadedPassengerC
             if (!ok) {
                 std::cout << "ERROR: No empty seats available.\n\n";
             } else {
+                // Book the same seat in the other structure so neither hands it out again
+                Passenger mirror{};
+                if (choice == 1) list.reserveWithIndex(name, cls, mirror);
+                else arr.reserveWithIndex(name, cls, mirror);
+
                 sub(choice == 1 ? "RESERVATION RESULT (ARRAY)" : "RESERVATION RESULT (LINKED LIST)");
                 std::cout << "Seat: " << p.seatRow << p.seatColumn << "\n";
-                std::cout << "ID  : " << p.passengerID << "\n\n";
+                std::cout << "ID  : " << p.passengerID << "\n";
+                if (journal) {
+                    std::cout << (journal->recordReservation(p)
+                                      ? "Saved: committed to " + journal->getLogPath()
+                                      : std::string("WARNING: not saved; this booking will be lost on exit"))
+                              << "\n";
+                }
+                std::cout << "\n";
             }
         } else if (choice == 3) {
-            header("PERFORMANCE COMPARISON (MICROSECONDS + % FASTER)");
+            header("PERFORMANCE COMPARISON (NANOSECONDS + % FASTER)");
 
-            const int ROWS = 400;
-            const int COLS = 26;
-            int available = (ROWS * COLS) - occupiedCount;
+            // Passengers outside the layout's seats were skipped by init()
+            int available = layout.getSeatCount() - arr.getPassengerCount();
             int N = 300;
             if (N > available) N = available;
             if (N < 50) N = (available > 0 ? available : 50);
 
-            std::cout << "Benchmark iterations: " << N << "\n";
-            std::cout << "Timing uses TOTAL microseconds for N operations.\n\n";
+            std::cout << "Benchmark iterations: " << N << " reservations per sample\n";
+            std::cout << "Timing reports nanoseconds per operation over repeated samples.\n\n";
 
             ArrayReservation* A = new ArrayReservation();
             LinkedListReservation* L = new LinkedListReservation();
             ArrayReservation* A2 = new ArrayReservation();
             LinkedListReservation* L2 = new LinkedListReservation();
 
-            A->init(loadedPassengers, loadedPassengerCount, maxID);
-            L->init(loadedPassengers, loadedPassengerCount, maxID);
-            A2->init(loadedPassengers, loadedPassengerCount, maxID);
-            L2->init(loadedPassengers, loadedPassengerCount, maxID);
-
             // Get first passenger ID for search test
             std::string searchID = "";
             for (int i = 0; i < loadedPassengerCount; i++) {
@@ -193,66 +208,48 @@ void showReservationMenu(const Passenger* loadedPassengers, int loadedPassengerC
             if (searchID.empty()) searchID = std::to_string(maxID);
             
             Passenger tmp{};
+            // Each sample re-initializes (untimed) and then times N reservations
+            BenchmarkConfig insertConfig(1, 15);
 
             // INSERTION: Linear-tech
-            auto a1 = std::chrono::steady_clock::now();
-            for (int i = 0; i < N; i++) A->reserveNoIndex("Bench", "Economy", tmp);
-            auto a2t = std::chrono::steady_clock::now();
-
-            auto l1 = std::chrono::steady_clock::now();
-            for (int i = 0; i < N; i++) L->reserveNoIndex("Bench", "Economy", tmp);
-            auto l2t = std::chrono::steady_clock::now();
-
-            long long arrInsLin_us = usSince(a1, a2t);
-            long long listInsLin_us = usSince(l1, l2t);
+            BenchmarkResult arrInsLin = runBenchmarkWithSetup(
+                [&]() { A->init(loadedPassengers, loadedPassengerCount, maxID); },
+                [&]() { for (int i = 0; i < N; i++) A->reserveNoIndex("Bench", "Economy", tmp); },
+                N, insertConfig);
+            BenchmarkResult listInsLin = runBenchmarkWithSetup(
+                [&]() { L->init(loadedPassengers, loadedPassengerCount, maxID); },
+                [&]() { for (int i = 0; i < N; i++) L->reserveNoIndex("Bench", "Economy", tmp); },
+                N, insertConfig);
 
             sub("INSERTION (LINEAR TECHNIQUE: NO INDEX UPDATE)");
-            winnerLine("Insertion Time", arrInsLin_us, listInsLin_us);
+            winnerLine("Insertion Time", arrInsLin, listInsLin);
 
             // INSERTION: Indexed-tech
-            auto a3 = std::chrono::steady_clock::now();
-            for (int i = 0; i < N; i++) A2->reserveWithIndex("Bench", "Economy", tmp);
-            auto a4t = std::chrono::steady_clock::now();
-
-            auto l3 = std::chrono::steady_clock::now();
-            for (int i = 0; i < N; i++) L2->reserveWithIndex("Bench", "Economy", tmp);
-            auto l4t = std::chrono::steady_clock::now();
-
-            long long arrInsIdx_us = usSince(a3, a4t);
-            long long listInsIdx_us = usSince(l3, l4t);
+            BenchmarkResult arrInsIdx = runBenchmarkWithSetup(
+                [&]() { A2->init(loadedPassengers, loadedPassengerCount, maxID); },
+                [&]() { for (int i = 0; i < N; i++) A2->reserveWithIndex("Bench", "Economy", tmp); },
+                N, insertConfig);
+            BenchmarkResult listInsIdx = runBenchmarkWithSetup(
+                [&]() { L2->init(loadedPassengers, loadedPassengerCount, maxID); },
+                [&]() { for (int i = 0; i < N; i++) L2->reserveWithIndex("Bench", "Economy", tmp); },
+                N, insertConfig);
 
             sub("INSERTION (INDEXED TECHNIQUE: MAINTAIN ID INDEX)");
-            winnerLine("Insertion Time", arrInsIdx_us, listInsIdx_us);
+            winnerLine("Insertion Time", arrInsIdx, listInsIdx);
 
             // SEARCH: Linear
-            auto a5 = std::chrono::steady_clock::now();
-            for (int i = 0; i < N; i++) (void)A2->searchLinear(searchID);
-            auto a6t = std::chrono::steady_clock::now();
-
-            auto l5 = std::chrono::steady_clock::now();
-            for (int i = 0; i < N; i++) (void)L2->searchLinear(searchID);
-            auto l6t = std::chrono::steady_clock::now();
-
-            long long arrSearchLin_us = usSince(a5, a6t);
-            long long listSearchLin_us = usSince(l5, l6t);
+            BenchmarkResult arrSearchLin = runBenchmark([&]() { doNotOptimize(A2->searchLinear(searchID)); });
+            BenchmarkResult listSearchLin = runBenchmark([&]() { doNotOptimize(L2->searchLinear(searchID)); });
 
             sub("SEARCH (LINEAR)");
-            winnerLine("Search Time", arrSearchLin_us, listSearchLin_us);
+            winnerLine("Search Time", arrSearchLin, listSearchLin);
 
             // SEARCH: Indexed
-            auto a7 = std::chrono::steady_clock::now();
-            for (int i = 0; i < N; i++) (void)A2->searchIndexed(searchID);
-            auto a8t = std::chrono::steady_clock::now();
-
-            auto l7 = std::chrono::steady_clock::now();
-            for (int i = 0; i < N; i++) (void)L2->searchIndexed(searchID);
-            auto l8t = std::chrono::steady_clock::now();
-
-            long long arrSearchIdx_us = usSince(a7, a8t);
-            long long listSearchIdx_us = usSince(l7, l8t);
+            BenchmarkResult arrSearchIdx = runBenchmark([&]() { doNotOptimize(A2->searchIndexed(searchID)); });
+            BenchmarkResult listSearchIdx = runBenchmark([&]() { doNotOptimize(L2->searchIndexed(searchID)); });
 
             sub("SEARCH (INDEXED)");
-            winnerLine("Search Time", arrSearchIdx_us, listSearchIdx_us);
+            winnerLine("Search Time", arrSearchIdx, listSearchIdx);
 
             // MEMORY
             sub("MEMORY USAGE COMPARISON");
@@ -286,6 +283,49 @@ void showReservationMenu(const Passenger* loadedPassengers, int loadedPassengerC
             delete L;
             delete A2;
             delete L2;
+        } else if (choice == 4) {
+            header("CONCURRENT BOOKING STRESS TEST");
+
+            int maxThreads = (int)std::thread::hardware_concurrency();
+            if (maxThreads < 4) maxThreads = 4;
+            if (maxThreads > 64) maxThreads = 64;
+            const int REPS = 5;
+
+            std::cout << "Each run fills an empty " << layout.getName() << " aircraft ("
+                      << layout.getSeatCount() << " seats) from all threads at once.\n";
+            std::cout << "Hardware threads: " << std::thread::hardware_concurrency()
+                      << "   Runs per thread count: " << REPS << "\n\n";
+
+            std::cout << std::left << std::setw(10) << "Threads"
+                      << std::setw(12) << "Bookings"
+                      << std::setw(16) << "ns/booking"
+                      << std::setw(16) << "Bookings/s"
+                      << std::setw(10) << "Speedup"
+                      << "Verified\n";
+            bar('-');
+
+            double baseline = 0.0;
+            for (int threads = 1; threads <= maxThreads; threads *= 2) {
+                ConcurrentStressResult r = runConcurrentBookingStress(layout, threads, REPS);
+                if (threads == 1) baseline = r.bookingsPerSecond;
+
+                std::cout << std::left << std::setw(10) << threads
+                          << std::setw(12) << r.bookings
+                          << std::fixed << std::setprecision(1)
+                          << std::setw(16) << r.timing.medianNs
+                          << std::setprecision(0) << std::setw(16) << r.bookingsPerSecond
+                          << std::setprecision(2) << std::setw(10)
+                          << (baseline > 0.0 ? r.bookingsPerSecond / baseline : 0.0);
+                if (r.verified()) {
+                    std::cout << "OK\n";
+                } else {
+                    std::cout << "FAILED (" << r.doubleBooked << " double-booked, "
+                              << r.indexErrors << " index errors, " << r.fillErrors << " fill errors)\n";
+                }
+            }
+            bar('-');
+            std::cout << "Seats are claimed with compare-and-swap on per-row occupancy words;\n";
+            std::cout << "speedup is limited by contention on the open rows and by core count.\n\n";
         }
     }
 }
\ No newline at end of file
@@ -2,7 +2,10 @@
 #define RESERVATION_MENU_HPP
 
 #include "Passenger.hpp"
+#include "ReservationJournal.hpp"
 
-void showReservationMenu(const Passenger* loadedPassengers, int loadedPassengerCount);
+// Bookings made through options 1 and 2 are committed to `journal` when one is given
+void showReservationMenu(const Passenger* loadedPassengers, int loadedPassengerCount,
+                         ReservationJournal* journal = nullptr);
 
 #endif
\ No newline at end of file
@@ -1,6 +1,4 @@
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <chrono>
 #include <string>
 #include <iomanip>
@@ -8,69 +6,14 @@
 
 #include "ArraySearch.hpp"
 #include "LinkedListSearch.hpp"
+#include "SkipListSearch.hpp"
 #include "Passenger.hpp"
+#include "Benchmark.hpp"
+#include "Trace.hpp"
 
 using namespace std;
 using namespace chrono;
 
-// Simple dynamic array for Passenger
-class PassengerArray {
-private:
-    Passenger* data;
-    int capacity;
-    int count;
-    
-    void resize(int newCapacity) {
-        Passenger* newData = new Passenger[newCapacity];
-        for (int i = 0; i < count; i++) {
-            newData[i] = data[i];
-        }
-        delete[] data;
-        data = newData;
-        capacity = newCapacity;
-    }
-    
-public:
-    PassengerArray(int initialCapacity = 100) : capacity(initialCapacity), count(0) {
-        data = new Passenger[capacity];
-    }
-    
-    ~PassengerArray() {
-        delete[] data;
-    }
-    
-    void push_back(const Passenger& passenger) {
-        if (count >= capacity) {
-            resize(capacity * 2);
-        }
-        data[count++] = passenger;
-    }
-    
-    Passenger& operator[](int index) {
-        return data[index];
-    }
-    
-    const Passenger& operator[](int index) const {
-        return data[index];
-    }
-    
-    int size() const {
-        return count;
-    }
-    
-    bool empty() const {
-        return count == 0;
-    }
-    
-    Passenger* getData() {
-        return data;
-    }
-    
-    const Passenger* getData() const {
-        return data;
-    }
-};
-
 // Print to console
 void logOutput(const string& message, bool newline = true) {
     cout << message;
@@ -89,58 +32,7 @@ size_t searchOverhead() {
     return sizeof(string) + sizeof(int) + sizeof(Passenger*);
 }
 
-// SIMPLE CSV LOADER for Search_Menu only
-PassengerArray loadCSVForSearch(const string& filename) {
-    PassengerArray passengers;
-    ifstream file(filename);
-    
-    if (!file.is_open()) {
-        cerr << "Error: Could not open file " << filename << "\n";
-        return passengers;
-    }
-    
-    string line;
-    getline(file, line); // Skip header
-    
-    while (getline(file, line)) {
-        stringstream ss(line);
-        string passengerID, name, seatRowStr, seatColumn, seatClass;
-        
-        if (getline(ss, passengerID, ',') &&
-            getline(ss, name, ',') &&
-            getline(ss, seatRowStr, ',') &&
-            getline(ss, seatColumn, ',') &&
-            getline(ss, seatClass, ',')) {
-            
-            // Skip empty seats
-            if (passengerID == "Empty" && name == "Empty") {
-                continue;
-            }
-            
-            // Convert seatRow from string to int
-            int seatRow;
-            try {
-                seatRow = stoi(seatRowStr);
-            } catch (const exception& e) {
-                seatRow = 1;
-            }
-            
-            // Convert seatColumn string to char
-            char seatColChar = 'A';
-            if (!seatColumn.empty()) {
-                seatColChar = seatColumn[0];
-            }
-            
-            // Create Passenger object
-            passengers.push_back(Passenger(passengerID, name, seatRow, seatColChar, seatClass, false));
-        }
-    }
-    
-    file.close();
-    return passengers;
-}
-
-void showSearchMenu() {
+void showSearchMenu(const Passenger* passengers, int passengerCount) {
     cout << "\n===============================================================\n";
     cout << "          FLIGHT SYSTEM PERFORMANCE TEST REPORT                \n";
     cout << "===============================================================\n";
@@ -148,32 +40,34 @@ void showSearchMenu() {
     // -------------------------
     // Setup systems
     // -------------------------
-    ArrayPassengerSystem arraySys(10005);
+    ArrayPassengerSystem arraySys(passengerCount > 10005 ? passengerCount : 10005);
     LinkedListPassengerSystem listSys;
+    SkipListPassengerSystem skipSys;
 
     // -------------------------
-    // Load CSV Data
+    // Load the current passengers (saved reservations and cancellations included)
     // -------------------------
-    string filename = "Updated_Passenger_List.csv";
-    cout << "[INFO] Loading data from: " << filename << endl;
+    int loaded = 0;
+    {
+        TRACE_SPAN("index", "Search menu: build array + list + skip list");
+        for (int i = 0; i < passengerCount; i++) {
+            const Passenger& p = passengers[i];
+            if (p.isEmpty) continue;
+            arraySys.addPassenger(p.passengerID, p.name, p.seatRow, p.seatColumn, p.seatClass);
+            listSys.addPassenger(p.passengerID, p.name, p.seatRow, p.seatColumn, p.seatClass);
+            skipSys.addPassenger(p.passengerID, p.name, p.seatRow, p.seatColumn, p.seatClass);
+            loaded++;
+        }
+    }
 
-    PassengerArray passengers = loadCSVForSearch(filename);
-    
-    if (passengers.empty()) {
-        cout << "Error: Could not open file or file is empty." << endl;
+    if (loaded == 0) {
+        cout << "Error: No passengers loaded." << endl;
         cout << "\nPress Enter to return to main menu...";
         cin.ignore();
         return;
     }
 
-    // Load data into systems
-    for (int i = 0; i < passengers.size(); i++) {
-        const Passenger& p = passengers[i];
-        arraySys.addPassenger(p.passengerID, p.name, p.seatRow, p.seatColumn, p.seatClass);
-        listSys.addPassenger(p.passengerID, p.name, p.seatRow, p.seatColumn, p.seatClass);
-    }
-
-    cout << "[INFO] " << passengers.size() << " records loaded.\n" << endl;
+    cout << "[INFO] " << loaded << " records loaded.\n" << endl;
 
     // -------------------------
     // User Input for Test IDs
@@ -200,29 +94,30 @@ void showSearchMenu() {
     // -------------------------
     // PHASE 1: UNSORTED SEARCH
     // -------------------------
-    cout << "\nPHASE 1: UNSORTED LINEAR SEARCH" << endl;
+    cout << "\nPHASE 1: UNSORTED LINEAR SEARCH (median ns per lookup)" << endl;
     printLine();
 
-    long long totalArrayUn = 0;
-    long long totalListUn = 0;
+    double totalArrayUn = 0;
+    double totalListUn = 0;
+    cout << fixed << setprecision(1);
 
     for (int i = 0; i < numTests; i++) {
+        TRACE_SPAN("search", "Search menu: unsorted lookups");
         string id = userTestIDs[i];
 
-        auto start = high_resolution_clock::now();
-        arraySys.searchPassengerUnsorted(id);
-        auto stop = high_resolution_clock::now();
-        long long dArr = duration_cast<microseconds>(stop - start).count();
-        totalArrayUn += dArr;
+        BenchmarkResult rArr = runBenchmark([&]() {
+            doNotOptimize(arraySys.searchPassengerUnsorted(id));
+        });
+        totalArrayUn += rArr.medianNs;
 
-        start = high_resolution_clock::now();
-        listSys.searchPassengerUnsorted(id);
-        stop = high_resolution_clock::now();
-        long long dList = duration_cast<microseconds>(stop - start).count();
-        totalListUn += dList;
+        BenchmarkResult rList = runBenchmark([&]() {
+            doNotOptimize(listSys.searchPassengerUnsorted(id));
+        });
+        totalListUn += rList.medianNs;
 
-        cout << "Test " << i + 1 << " (" << id << "): Array=" << dArr
-            << " us | List=" << dList << " us" << endl;
+        cout << "Test " << i + 1 << " (" << id << "): Array=" << rArr.medianNs
+            << " ns (p99 " << rArr.p99Ns << ") | List=" << rList.medianNs
+            << " ns (p99 " << rList.p99Ns << ")" << endl;
     }
 
     // -------------------------
@@ -231,62 +126,109 @@ void showSearchMenu() {
     cout << "\n[ACTION] Sorting data..." << endl;
     arraySys.sortData();
     listSys.sortData();
+    cout << "[SKIP LIST] Already in ID order (kept sorted on insert)." << endl;
     cout << "[ACTION] Sorting complete.\n" << endl;
 
     // -------------------------
     // PHASE 2: SORTED SEARCH
     // -------------------------
-    cout << "PHASE 2: SORTED & OPTIMIZED SEARCH" << endl;
+    cout << "PHASE 2: SORTED & OPTIMIZED SEARCH (median ns per lookup)" << endl;
     printLine();
 
-    long long totalArrayLinear = 0, totalArrayBinary = 0;
-    long long totalListLinear = 0, totalListJump = 0;
+    double totalArrayLinear = 0, totalArrayBinary = 0;
+    double totalListLinear = 0, totalListJump = 0, totalSkip = 0;
+    int listSize = listSys.size();
 
     for (int i = 0; i < numTests; i++) {
+        TRACE_SPAN("search", "Search menu: sorted lookups");
         string id = userTestIDs[i];
 
-        auto start = high_resolution_clock::now();
-        arraySys.searchPassengerSorted(id);
-        auto stop = high_resolution_clock::now();
-        long long dArrLinear = duration_cast<microseconds>(stop - start).count();
-        totalArrayLinear += dArrLinear;
-
-        start = high_resolution_clock::now();
-        arraySys.searchPassengerBinary(id);
-        stop = high_resolution_clock::now();
-        long long dArrBinary = duration_cast<microseconds>(stop - start).count();
-        totalArrayBinary += dArrBinary;
-
-        start = high_resolution_clock::now();
-        listSys.searchPassengerSorted(id);
-        stop = high_resolution_clock::now();
-        long long dListLinear = duration_cast<microseconds>(stop - start).count();
-        totalListLinear += dListLinear;
-
-        start = high_resolution_clock::now();
-        listSys.searchPassengerJump(listSys.size(), id);
-        stop = high_resolution_clock::now();
-        long long dListJump = duration_cast<microseconds>(stop - start).count();
-        totalListJump += dListJump;
+        BenchmarkResult rArrLinear = runBenchmark([&]() {
+            doNotOptimize(arraySys.searchPassengerSorted(id));
+        });
+        totalArrayLinear += rArrLinear.medianNs;
+
+        BenchmarkResult rArrBinary = runBenchmark([&]() {
+            doNotOptimize(arraySys.searchPassengerBinary(id));
+        });
+        totalArrayBinary += rArrBinary.medianNs;
+
+        BenchmarkResult rListLinear = runBenchmark([&]() {
+            doNotOptimize(listSys.searchPassengerSorted(id));
+        });
+        totalListLinear += rListLinear.medianNs;
+
+        BenchmarkResult rListJump = runBenchmark([&]() {
+            doNotOptimize(listSys.searchPassengerJump(listSize, id));
+        });
+        totalListJump += rListJump.medianNs;
+
+        BenchmarkResult rSkip = runBenchmark([&]() {
+            doNotOptimize(skipSys.searchPassenger(id));
+        });
+        totalSkip += rSkip.medianNs;
 
         cout << "Test " << i + 1 << ": "
-            << "ArrLinear=" << dArrLinear << " | ArrBinary=" << dArrBinary
-            << " | ListLinear=" << dListLinear << " | ListJump=" << dListJump << endl;
+            << "ArrLinear=" << rArrLinear.medianNs << " | ArrBinary=" << rArrBinary.medianNs
+            << " | ListLinear=" << rListLinear.medianNs << " | ListJump=" << rListJump.medianNs
+            << " | SkipList=" << rSkip.medianNs << endl;
+    }
+
+    // -------------------------
+    // PHASE 3: CANCEL + REBOOK
+    // -------------------------
+    cout << "\nPHASE 3: CANCEL + REBOOK (median ns per pair)" << endl;
+    printLine();
+
+    double totalListChurn = 0, totalSkipChurn = 0;
+    int churnTests = 0;
+
+    for (int i = 0; i < numTests; i++) {
+        TRACE_SPAN("cancel", "Search menu: cancel + rebook");
+        string id = userTestIDs[i];
+        Passenger* found = skipSys.findByID(id);
+        if (!found || !listSys.findByID(id)) {
+            cout << "Test " << i + 1 << " (" << id << "): not booked, skipped" << endl;
+            continue;
+        }
+        Passenger booking = *found;
+
+        // The list appends the rebooked passenger at its tail; the skip list
+        // puts it back in ID order
+        BenchmarkResult rList = runBenchmark([&]() {
+            listSys.remove(id);
+            listSys.add(booking);
+        });
+        totalListChurn += rList.medianNs;
+
+        BenchmarkResult rSkip = runBenchmark([&]() {
+            skipSys.cancelPassenger(id);
+            skipSys.add(booking);
+        });
+        totalSkipChurn += rSkip.medianNs;
+        churnTests++;
+
+        cout << "Test " << i + 1 << " (" << id << "): List=" << rList.medianNs
+            << " ns | SkipList=" << rSkip.medianNs << " ns" << endl;
     }
 
     // -------------------------
-    // PHASE 3: SPACE COMPLEXITY
+    // PHASE 4: SPACE COMPLEXITY
     // -------------------------
-    cout << "\nPHASE 3: SPACE COMPLEXITY" << endl;
+    cout << "\nPHASE 4: SPACE COMPLEXITY" << endl;
     printLine();
 
     size_t arrayMemory = arraySys.memoryUsage();
     size_t listMemory = listSys.memoryUsage();
+    size_t skipMemory = skipSys.memoryUsage();
     size_t searchMem = searchOverhead();
 
     cout << "Array Memory Used: " << arrayMemory << " bytes" << endl;
     cout << "Linked List Memory Used: " << listMemory << " bytes" << endl;
+    cout << "Skip List Memory Used: " << skipMemory << " bytes (" << skipSys.getLevels() << " levels)" << endl;
     cout << "Search Extra Memory: " << searchMem << " bytes" << endl;
+    cout << "Interned Names/Classes: " << internPool().getStringCount() << " strings, "
+         << internPool().heapStats().footprintBytes << " bytes (shared)" << endl;
 
     // -------------------------
     // FINAL SUMMARY
@@ -295,12 +237,17 @@ void showSearchMenu() {
     printLine();
 
     if (numTests > 0) {
-        cout << "Unsorted Linear Avg (Array): " << (totalArrayUn / numTests) << " us" << endl;
-        cout << "Unsorted Linear Avg (List): " << (totalListUn / numTests) << " us" << endl;
-        cout << "Sorted Linear Avg (Array): " << (totalArrayLinear / numTests) << " us" << endl;
-        cout << "Sorted Linear Avg (List): " << (totalListLinear / numTests) << " us" << endl;
-        cout << "Binary Search Avg (Array): " << (totalArrayBinary / numTests) << " us" << endl;
-        cout << "Jump Search Avg (List): " << (totalListJump / numTests) << " us" << endl;
+        cout << "Unsorted Linear Avg (Array): " << (totalArrayUn / numTests) << " ns" << endl;
+        cout << "Unsorted Linear Avg (List): " << (totalListUn / numTests) << " ns" << endl;
+        cout << "Sorted Linear Avg (Array): " << (totalArrayLinear / numTests) << " ns" << endl;
+        cout << "Sorted Linear Avg (List): " << (totalListLinear / numTests) << " ns" << endl;
+        cout << "Binary Search Avg (Array): " << (totalArrayBinary / numTests) << " ns" << endl;
+        cout << "Jump Search Avg (List): " << (totalListJump / numTests) << " ns" << endl;
+        cout << "Skip List Search Avg: " << (totalSkip / numTests) << " ns" << endl;
+    }
+    if (churnTests > 0) {
+        cout << "Cancel + Rebook Avg (List): " << (totalListChurn / churnTests) << " ns" << endl;
+        cout << "Cancel + Rebook Avg (Skip List): " << (totalSkipChurn / churnTests) << " ns" << endl;
     }
 
     cout << "\nPress Enter to return to main menu...";
@@ -1,6 +1,9 @@
 #ifndef SEARCH_MENU_HPP
 #define SEARCH_MENU_HPP
 
-void showSearchMenu();
+#include "Passenger.hpp"
+
+// Times lookups over the given passengers (empty seats are skipped)
+void showSearchMenu(const Passenger* passengers, int passengerCount);
 
 #endif
\ No newline at end of file
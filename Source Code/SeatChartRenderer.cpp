@@ -0,0 +1,144 @@
+#include "SeatChartRenderer.hpp"
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+// Color is on for interactive terminals unless the user opted out via NO_COLOR
+static bool detectColorSupport() {
+    if (std::getenv("NO_COLOR") != nullptr) return false;
+    #ifdef _WIN32
+        return true;
+    #else
+        return isatty(fileno(stdout)) != 0;
+    #endif
+}
+
+// Worst case: every seat switches color (escape + "X ") plus a reset per row,
+// with headroom for the title, statistics and legend text
+SeatChartRenderer::SeatChartRenderer(int r, int c)
+    : buffer(nullptr), capacity(0), length(0), colorEnabled(detectColorSupport()) {
+
+    size_t escapeLen = std::strlen(COLOR_GREEN);
+    size_t perRow = 8 + (size_t)c * (escapeLen + 2) + std::strlen(COLOR_RESET) + 1;
+    capacity = 1024 + (size_t)c * 2 + (size_t)r * perRow;
+    buffer = new char[capacity];
+}
+
+SeatChartRenderer::~SeatChartRenderer() {
+    delete[] buffer;
+}
+
+// Only grows if a caller appends more text than the precomputed worst case
+void SeatChartRenderer::ensureCapacity(size_t extra) {
+    if (length + extra <= capacity) return;
+
+    size_t newCapacity = capacity * 2;
+    while (newCapacity < length + extra) newCapacity *= 2;
+
+    char* newBuffer = new char[newCapacity];
+    std::memcpy(newBuffer, buffer, length);
+    delete[] buffer;
+    buffer = newBuffer;
+    capacity = newCapacity;
+}
+
+void SeatChartRenderer::appendText(const char* text) {
+    size_t n = std::strlen(text);
+    ensureCapacity(n);
+    std::memcpy(buffer + length, text, n);
+    length += n;
+}
+
+void SeatChartRenderer::appendChar(char c) {
+    ensureCapacity(1);
+    buffer[length++] = c;
+}
+
+// Right-aligned integer formatting (equivalent to std::setw(width))
+void SeatChartRenderer::appendInt(long value, int width) {
+    char digits[24];
+    int n = 0;
+    bool negative = value < 0;
+    unsigned long v = negative ? (unsigned long)(-value) : (unsigned long)value;
+
+    do {
+        digits[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v > 0);
+    if (negative) digits[n++] = '-';
+
+    int pad = width > n ? width - n : 0;
+    ensureCapacity((size_t)(pad + n));
+    for (int i = 0; i < pad; i++) buffer[length++] = ' ';
+    while (n > 0) buffer[length++] = digits[--n];
+}
+
+void SeatChartRenderer::appendColor(const char* color) {
+    if (colorEnabled) appendText(color);
+}
+
+void SeatChartRenderer::appendColored(const char* text, const char* color) {
+    appendColor(color);
+    appendText(text);
+    appendColor(COLOR_RESET);
+}
+
+void SeatChartRenderer::appendTitle() {
+    appendText("SEATING CHART (");
+    appendColored("X", COLOR_RED);
+    appendText(" = Reserved, ");
+    appendColored("O", COLOR_GREEN);
+    appendText(" = Available)\n");
+    appendText("===============================================\n\n");
+}
+
+// Column header plus one line per row; runs of equal seats share one escape
+void SeatChartRenderer::appendGrid(const SeatOccupancy& seats, int displayRows, int displayCols) {
+    if (displayRows > seats.getRows()) displayRows = seats.getRows();
+    if (displayCols > seats.getCols()) displayCols = seats.getCols();
+
+    appendText("     ");
+    for (int col = 0; col < displayCols; col++) {
+        appendChar((char)('A' + col));
+        appendChar(' ');
+    }
+    appendChar('\n');
+
+    for (int row = 0; row < displayRows; row++) {
+        appendInt(row + 1, 3);
+        appendText(": ");
+
+        uint32_t word = seats.rowWord(row);
+        int runState = -1;
+        for (int col = 0; col < displayCols; col++) {
+            int state = (word >> col) & 1u;
+            if (state != runState) {
+                appendColor(state ? COLOR_RED : COLOR_GREEN);
+                runState = state;
+            }
+            ensureCapacity(2);
+            buffer[length++] = state ? 'X' : 'O';
+            buffer[length++] = ' ';
+        }
+        if (runState != -1) appendColor(COLOR_RESET);
+        appendChar('\n');
+    }
+}
+
+void SeatChartRenderer::appendLegend() {
+    appendText("\nLEGEND:\n");
+    appendColored("X", COLOR_RED);
+    appendText(" - Reserved Seat\n");
+    appendColored("O", COLOR_GREEN);
+    appendText(" - Available Seat\n");
+}
+
+// Single write of the whole chart
+void SeatChartRenderer::flush(std::ostream& out) const {
+    out.write(buffer, (std::streamsize)length);
+    out.flush();
+}
@@ -0,0 +1,53 @@
+#ifndef SEAT_CHART_RENDERER_HPP
+#define SEAT_CHART_RENDERER_HPP
+
+#include "SeatOccupancy.hpp"
+#include <iostream>
+#include <cstddef>
+
+// ANSI Color Codes
+#define COLOR_RESET   "\033[0m"
+#define COLOR_RED     "\033[1;31m"
+#define COLOR_GREEN   "\033[1;32m"
+
+// Builds a complete seating chart into one preallocated buffer and emits it
+// with a single write. Consecutive seats of the same state share one ANSI
+// escape sequence, and color can be switched off for piping to files.
+class SeatChartRenderer {
+private:
+    char* buffer;
+    size_t capacity;
+    size_t length;
+
+    bool colorEnabled;
+
+    void ensureCapacity(size_t extra);
+
+public:
+    SeatChartRenderer(int rows, int cols);
+    ~SeatChartRenderer();
+    SeatChartRenderer(const SeatChartRenderer&) = delete;
+    SeatChartRenderer& operator=(const SeatChartRenderer&) = delete;
+
+    // Color control (defaults to off when stdout is not a terminal or NO_COLOR is set)
+    void setColorEnabled(bool enabled) { colorEnabled = enabled; }
+    bool isColorEnabled() const { return colorEnabled; }
+
+    // Buffer building
+    void reset() { length = 0; }
+    void appendText(const char* text);
+    void appendChar(char c);
+    void appendInt(long value, int width = 0);
+    void appendColor(const char* color);   // no-op when color is disabled
+    void appendColored(const char* text, const char* color);
+    void appendTitle();
+    void appendGrid(const SeatOccupancy& seats, int displayRows, int displayCols);
+    void appendLegend();
+
+    // Output
+    void flush(std::ostream& out) const;
+    const char* data() const { return buffer; }
+    size_t size() const { return length; }
+};
+
+#endif
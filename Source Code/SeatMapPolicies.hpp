@@ -0,0 +1,96 @@
+#ifndef SEAT_MAP_POLICIES_HPP
+#define SEAT_MAP_POLICIES_HPP
+
+#include "Passenger.hpp"
+#include <cstdint>
+
+// Seat map policies for DisplaySystem: one row-major slot per seat, naming
+// the stored record seated there. A later assign() to a slot replaces the
+// earlier one, so with a shared seat the last record wins.
+//
+//   void resize(int seats)             allocates the slots, all empty
+//   void clear()
+//   void assign(slot, storage, p)      p is a record of `storage`
+//   Passenger* at(slot, storage) const nullptr for an empty seat
+
+// ==================== POSITION SEAT MAP ====================
+
+// 32-bit record positions: half the size of pointers and still valid after
+// the storage reallocates. Random-access storage only.
+class PositionSeatMap {
+public:
+    static const uint32_t NO_PASSENGER = 0xFFFFFFFFu;  // empty slot
+
+private:
+    uint32_t* slots;
+    int seats;
+
+public:
+    PositionSeatMap() : slots(nullptr), seats(0) {}
+    ~PositionSeatMap() { delete[] slots; }
+
+    PositionSeatMap(const PositionSeatMap&) = delete;
+    PositionSeatMap& operator=(const PositionSeatMap&) = delete;
+
+    void resize(int n) {
+        delete[] slots;
+        seats = n;
+        slots = new uint32_t[seats];
+        clear();
+    }
+
+    void clear() {
+        for (int i = 0; i < seats; i++) slots[i] = NO_PASSENGER;
+    }
+
+    template <class Storage>
+    void assign(int slot, const Storage& storage, Passenger* p) {
+        static_assert(Storage::RANDOM_ACCESS, "positions need random-access storage");
+        slots[slot] = (uint32_t)(p - &storage.at(0));
+    }
+
+    template <class Storage>
+    Passenger* at(int slot, const Storage& storage) const {
+        uint32_t position = slots[slot];
+        return position != NO_PASSENGER ? &storage.at((int)position) : nullptr;
+    }
+};
+
+// ==================== POINTER SEAT MAP ====================
+
+// Record addresses, for storage whose records never move (linked nodes)
+class PointerSeatMap {
+private:
+    Passenger** slots;
+    int seats;
+
+public:
+    PointerSeatMap() : slots(nullptr), seats(0) {}
+    ~PointerSeatMap() { delete[] slots; }
+
+    PointerSeatMap(const PointerSeatMap&) = delete;
+    PointerSeatMap& operator=(const PointerSeatMap&) = delete;
+
+    void resize(int n) {
+        delete[] slots;
+        seats = n;
+        slots = new Passenger*[seats];
+        clear();
+    }
+
+    void clear() {
+        for (int i = 0; i < seats; i++) slots[i] = nullptr;
+    }
+
+    template <class Storage>
+    void assign(int slot, const Storage&, Passenger* p) {
+        slots[slot] = p;
+    }
+
+    template <class Storage>
+    Passenger* at(int slot, const Storage&) const {
+        return slots[slot];
+    }
+};
+
+#endif
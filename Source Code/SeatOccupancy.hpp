@@ -0,0 +1,258 @@
+#ifndef SEAT_OCCUPANCY_HPP
+#define SEAT_OCCUPANCY_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+// Portable bit helpers (compiler intrinsics where available)
+inline int popcount32(uint32_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcount(x);
+#else
+    x = x - ((x >> 1) & 0x55555555u);
+    x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+    return (int)((((x + (x >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+#endif
+}
+
+inline int popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#else
+    return popcount32((uint32_t)x) + popcount32((uint32_t)(x >> 32));
+#endif
+}
+
+// Index of the lowest set bit (x must be non-zero)
+inline int lowestBit32(uint32_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(x);
+#else
+    int n = 0;
+    while (!(x & 1u)) { x >>= 1; n++; }
+    return n;
+#endif
+}
+
+inline int lowestBit64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#else
+    uint32_t low = (uint32_t)x;
+    return low ? lowestBit32(low) : 32 + lowestBit32((uint32_t)(x >> 32));
+#endif
+}
+
+// Number of significant bits, i.e. index of the highest set bit + 1 (0 for x == 0)
+inline int bitWidth32(uint32_t x) {
+    if (x == 0) return 0;
+#if defined(__GNUC__) || defined(__clang__)
+    return 32 - __builtin_clz(x);
+#else
+    int n = 0;
+    while (x) { x >>= 1; n++; }
+    return n;
+#endif
+}
+
+// Bit-packed seat map: one 32-bit word per row, bit c set = seat c reserved.
+// Rows and columns are 0-indexed; a row holds at most 32 seats (A-Z fits).
+class SeatOccupancy {
+private:
+    uint32_t* rowBits;   // padded to an even row count for 64-bit popcounts
+    int rows;
+    int cols;
+    uint32_t fullRowMask;
+    int firstOpenRow;    // every row before this one is full
+
+public:
+    SeatOccupancy(int r, int c) : rowBits(nullptr) {
+        resize(r, c);
+    }
+
+    ~SeatOccupancy() {
+        delete[] rowBits;
+    }
+
+    SeatOccupancy(const SeatOccupancy&) = delete;
+    SeatOccupancy& operator=(const SeatOccupancy&) = delete;
+
+    void clear() {
+        std::memset(rowBits, 0, sizeof(uint32_t) * paddedRows());
+        firstOpenRow = 0;
+    }
+
+    // Reallocates for a new geometry; every seat becomes available
+    void resize(int r, int c) {
+        delete[] rowBits;
+        rows = r > 0 ? r : 0;
+        cols = c > 32 ? 32 : (c > 0 ? c : 0);
+        fullRowMask = (cols == 32) ? 0xFFFFFFFFu : ((1u << cols) - 1u);
+        rowBits = new uint32_t[paddedRows() > 0 ? paddedRows() : 1];
+        clear();
+    }
+
+    void reserve(int rowIndex, int colIndex) {
+        if (!inRange(rowIndex, colIndex)) return;
+        rowBits[rowIndex] |= (1u << colIndex);
+        while (firstOpenRow < rows && rowBits[firstOpenRow] == fullRowMask) firstOpenRow++;
+    }
+
+    void release(int rowIndex, int colIndex) {
+        if (!inRange(rowIndex, colIndex)) return;
+        rowBits[rowIndex] &= ~(1u << colIndex);
+        if (rowIndex < firstOpenRow) firstOpenRow = rowIndex;
+    }
+
+    bool isReserved(int rowIndex, int colIndex) const {
+        if (!inRange(rowIndex, colIndex)) return false;
+        return (rowBits[rowIndex] >> colIndex) & 1u;
+    }
+
+    // First available seat in row-major order (skips full rows via the hint)
+    bool findFirstAvailable(int& rowIndex, int& colIndex) const {
+        for (int r = firstOpenRow; r < rows; r++) {
+            uint32_t open = ~rowBits[r] & fullRowMask;
+            if (open) {
+                rowIndex = r;
+                colIndex = lowestBit32(open);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // --- STATISTICS (popcount, two rows per 64-bit word) ---
+    int countReserved() const {
+        int total = 0;
+        int pairs = paddedRows() / 2;
+        for (int i = 0; i < pairs; i++) {
+            uint64_t pair;
+            std::memcpy(&pair, rowBits + 2 * i, sizeof(pair));
+            total += popcount64(pair);
+        }
+        return total;
+    }
+
+    int countAvailable() const { return rows * cols - countReserved(); }
+
+    int countReservedInRow(int rowIndex) const {
+        if (rowIndex < 0 || rowIndex >= rows) return 0;
+        return popcount32(rowBits[rowIndex]);
+    }
+
+    // Inclusive 0-indexed row range (e.g. one cabin)
+    int countReservedInRows(int firstRow, int lastRow) const {
+        if (firstRow < 0) firstRow = 0;
+        if (lastRow >= rows) lastRow = rows - 1;
+        int total = 0;
+        for (int r = firstRow; r <= lastRow; r++) total += popcount32(rowBits[r]);
+        return total;
+    }
+
+    // --- DISPLAY BOUNDS ---
+    // Highest occupied row, 1-indexed (0 if empty)
+    int maxUsedRow() const {
+        for (int r = rows - 1; r >= 0; r--) {
+            if (rowBits[r]) return r + 1;
+        }
+        return 0;
+    }
+
+    // Highest occupied column across all rows, 1-indexed (0 if empty)
+    int maxUsedCol() const {
+        uint32_t all = 0;
+        for (int r = 0; r < rows; r++) all |= rowBits[r];
+        return bitWidth32(all);
+    }
+
+    uint32_t rowWord(int rowIndex) const { return rowBits[rowIndex]; }
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+    size_t memoryUsage() const { return sizeof(uint32_t) * paddedRows(); }
+
+private:
+    int paddedRows() const { return (rows + 1) & ~1; }
+
+    bool inRange(int rowIndex, int colIndex) const {
+        return rowIndex >= 0 && rowIndex < rows && colIndex >= 0 && colIndex < cols;
+    }
+};
+
+// Fixed-geometry variant for the hot path: storage is inline and the bounds
+// and full-row mask are compile-time constants. Same interface as
+// SeatOccupancy; resize() only clears because the geometry cannot change.
+template <int ROWS, int COLS>
+class FixedSeatOccupancy {
+private:
+    static_assert(ROWS > 0 && COLS > 0 && COLS <= 32, "a row holds 1-32 seats");
+    static const int PADDED_ROWS = (ROWS + 1) & ~1;
+    static const uint32_t FULL_ROW_MASK = (COLS == 32) ? 0xFFFFFFFFu : ((1u << (COLS % 32)) - 1u);
+
+    uint32_t rowBits[PADDED_ROWS];
+    int firstOpenRow;
+
+public:
+    FixedSeatOccupancy(int = ROWS, int = COLS) { clear(); }
+
+    void clear() {
+        std::memset(rowBits, 0, sizeof(rowBits));
+        firstOpenRow = 0;
+    }
+
+    void resize(int, int) { clear(); }
+
+    void reserve(int rowIndex, int colIndex) {
+        if (!inRange(rowIndex, colIndex)) return;
+        rowBits[rowIndex] |= (1u << colIndex);
+        while (firstOpenRow < ROWS && rowBits[firstOpenRow] == FULL_ROW_MASK) firstOpenRow++;
+    }
+
+    void release(int rowIndex, int colIndex) {
+        if (!inRange(rowIndex, colIndex)) return;
+        rowBits[rowIndex] &= ~(1u << colIndex);
+        if (rowIndex < firstOpenRow) firstOpenRow = rowIndex;
+    }
+
+    bool isReserved(int rowIndex, int colIndex) const {
+        if (!inRange(rowIndex, colIndex)) return false;
+        return (rowBits[rowIndex] >> colIndex) & 1u;
+    }
+
+    bool findFirstAvailable(int& rowIndex, int& colIndex) const {
+        for (int r = firstOpenRow; r < ROWS; r++) {
+            uint32_t open = ~rowBits[r] & FULL_ROW_MASK;
+            if (open) {
+                rowIndex = r;
+                colIndex = lowestBit32(open);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int countReserved() const {
+        int total = 0;
+        for (int i = 0; i < PADDED_ROWS / 2; i++) {
+            uint64_t pair;
+            std::memcpy(&pair, rowBits + 2 * i, sizeof(pair));
+            total += popcount64(pair);
+        }
+        return total;
+    }
+
+    int countAvailable() const { return ROWS * COLS - countReserved(); }
+
+    uint32_t rowWord(int rowIndex) const { return rowBits[rowIndex]; }
+    int getRows() const { return ROWS; }
+    int getCols() const { return COLS; }
+    size_t memoryUsage() const { return sizeof(rowBits); }
+
+private:
+    static bool inRange(int rowIndex, int colIndex) {
+        return (unsigned)rowIndex < (unsigned)ROWS && (unsigned)colIndex < (unsigned)COLS;
+    }
+};
+
+#endif
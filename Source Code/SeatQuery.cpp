@@ -0,0 +1,333 @@
+#include "SeatQuery.hpp"
+#include "SeatOccupancy.hpp"
+#include <cstring>
+#include <iomanip>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SEAT_QUERY_SSE2 1
+#endif
+
+static const int BLOCK_SEATS = 64;   // seats per selection word
+
+void standardSeatQueries(SeatQuery* queries) {
+    queries[0] = SeatQuery("Occupancy by cabin");
+    queries[0].state = OCCUPIED_ONLY;
+    queries[0].groupBy = GROUP_CLASS;
+
+    queries[1] = SeatQuery("Empty seats per row, rows 1-100");
+    queries[1].firstRow = 1;
+    queries[1].lastRow = 100;
+    queries[1].state = EMPTY_ONLY;
+    queries[1].groupBy = GROUP_ROW;
+
+    queries[2] = SeatQuery("Passengers in rows 51-150, seats A-C");
+    queries[2].firstRow = 51;
+    queries[2].lastRow = 150;
+    queries[2].firstCol = 'A';
+    queries[2].lastCol = 'C';
+    queries[2].state = OCCUPIED_ONLY;
+
+    queries[3] = SeatQuery("Empty Economy seats by column");
+    queries[3].seatClass = "Economy";
+    queries[3].state = EMPTY_ONLY;
+    queries[3].groupBy = GROUP_COLUMN;
+}
+
+// ==================== QUERY RESULT ====================
+
+QueryResult::QueryResult()
+    : groupBy(GROUP_NONE), total(0), counts(nullptr), keyCount(0), keyCapacity(0), classCount(0) {}
+
+QueryResult::~QueryResult() {
+    delete[] counts;
+}
+
+void QueryResult::reset(QueryGroup group, int rows, int cols) {
+    groupBy = group;
+    total = 0;
+    classCount = 0;
+    switch (group) {
+        case GROUP_ROW: keyCount = rows; break;
+        case GROUP_COLUMN: keyCount = cols; break;
+        case GROUP_CLASS: keyCount = MAX_QUERY_CLASSES; break;
+        default: keyCount = 0; break;
+    }
+    // Reused across queries; only grows
+    if (keyCount > keyCapacity) {
+        delete[] counts;
+        counts = new long[keyCount];
+        keyCapacity = keyCount;
+    }
+    for (int i = 0; i < keyCount; i++) counts[i] = 0;
+}
+
+int QueryResult::classKey(uint32_t handle) {
+    for (int i = 0; i < classCount; i++) {
+        if (classHandles[i] == handle) return i;
+    }
+    if (classCount == MAX_QUERY_CLASSES) throw std::length_error("too many seat classes in one query");
+    classHandles[classCount] = handle;
+    return classCount++;
+}
+
+bool QueryResult::sameAs(const QueryResult& other) const {
+    if (groupBy != other.groupBy || total != other.total || keyCount != other.keyCount) return false;
+    if (groupBy != GROUP_CLASS) {
+        for (int i = 0; i < keyCount; i++) {
+            if (counts[i] != other.counts[i]) return false;
+        }
+        return true;
+    }
+
+    // Class slots are numbered in the order each result first met them
+    int nonEmpty = 0;
+    int otherNonEmpty = 0;
+    for (int i = 0; i < other.classCount; i++) {
+        if (other.counts[i] != 0) otherNonEmpty++;
+    }
+    for (int i = 0; i < classCount; i++) {
+        if (counts[i] == 0) continue;
+        nonEmpty++;
+        int j = 0;
+        while (j < other.classCount && other.classHandles[j] != classHandles[i]) j++;
+        if (j == other.classCount || other.counts[j] != counts[i]) return false;
+    }
+    return nonEmpty == otherNonEmpty;
+}
+
+void QueryResult::print(std::ostream& out, int maxGroups) const {
+    out << "  Matching seats: " << total << "\n";
+    if (groupBy == GROUP_NONE) return;
+
+    int shown = 0;
+    int hidden = 0;
+    for (int i = 0; i < keyCount; i++) {
+        if (counts[i] == 0) continue;
+        if (shown == maxGroups) {
+            hidden++;
+            continue;
+        }
+        std::string label;
+        if (groupBy == GROUP_ROW) label = "Row " + std::to_string(i + 1);
+        else if (groupBy == GROUP_COLUMN) label = std::string("Column ") + (char)('A' + i);
+        else label = internPool().lookup(classHandles[i]);
+        out << "    " << std::left << std::setw(20) << label << std::right << std::setw(10) << counts[i] << "\n";
+        shown++;
+    }
+    if (hidden > 0) out << "    ... and " << hidden << " more groups\n";
+}
+
+// ==================== SELECTION KERNELS ====================
+
+// One bit per value for 64 consecutive values: set where lo <= v[i] <= hi.
+// SSE2 compares 4 rows or 16 byte-sized attributes per instruction.
+static inline uint64_t rangeMask32(const int32_t* v, int32_t lo, int32_t hi) {
+    uint64_t bits = 0;
+#ifdef SEAT_QUERY_SSE2
+    __m128i below = _mm_set1_epi32(lo - 1);
+    __m128i above = _mm_set1_epi32(hi + 1);
+    for (int i = 0; i < BLOCK_SEATS; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(v + i));
+        __m128i in = _mm_and_si128(_mm_cmpgt_epi32(x, below), _mm_cmplt_epi32(x, above));
+        bits |= (uint64_t)_mm_movemask_ps(_mm_castsi128_ps(in)) << i;
+    }
+#else
+    uint32_t span = (uint32_t)(hi - lo);
+    for (int i = 0; i < BLOCK_SEATS; i++) bits |= (uint64_t)((uint32_t)(v[i] - lo) <= span) << i;
+#endif
+    return bits;
+}
+
+static inline uint64_t rangeMask8(const uint8_t* v, uint8_t lo, uint8_t hi) {
+    uint64_t bits = 0;
+#ifdef SEAT_QUERY_SSE2
+    __m128i low = _mm_set1_epi8((char)lo);
+    __m128i high = _mm_set1_epi8((char)hi);
+    for (int i = 0; i < BLOCK_SEATS; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(v + i));
+        // Unsigned clamp into [lo, hi] leaves in-range values unchanged
+        __m128i in = _mm_cmpeq_epi8(_mm_min_epu8(_mm_max_epu8(x, low), high), x);
+        bits |= (uint64_t)(uint16_t)_mm_movemask_epi8(in) << i;
+    }
+#else
+    uint8_t span = (uint8_t)(hi - lo);
+    for (int i = 0; i < BLOCK_SEATS; i++) bits |= (uint64_t)((uint8_t)(v[i] - lo) <= span) << i;
+#endif
+    return bits;
+}
+
+static inline uint64_t equalMask8(const uint8_t* v, uint8_t value) {
+    return rangeMask8(v, value, value);
+}
+
+// ==================== SEAT COLUMNS ====================
+
+SeatColumns::SeatColumns()
+    : rowColumn(nullptr), colColumn(nullptr), classColumn(nullptr), stateColumn(nullptr),
+      selection(nullptr), rows(0), cols(0), seatCount(0), blockCount(0), classCount(0) {}
+
+SeatColumns::~SeatColumns() {
+    release();
+}
+
+void SeatColumns::release() {
+    delete[] rowColumn;
+    delete[] colColumn;
+    delete[] classColumn;
+    delete[] stateColumn;
+    delete[] selection;
+}
+
+uint8_t SeatColumns::classCode(uint32_t handle) {
+    for (int i = 0; i < classCount; i++) {
+        if (classHandles[i] == handle) return (uint8_t)i;
+    }
+    if (classCount == MAX_QUERY_CLASSES) throw std::length_error("too many seat classes");
+    classHandles[classCount] = handle;
+    return (uint8_t)classCount++;
+}
+
+int SeatColumns::findClassCode(const std::string& seatClass) const {
+    for (int i = 0; i < classCount; i++) {
+        if (internPool().lookup(classHandles[i]) == seatClass) return i;
+    }
+    return -1;
+}
+
+void SeatColumns::reset(const AircraftLayout& layout, int r, int c) {
+    int seats = r * c;
+    int blocks = (seats + BLOCK_SEATS - 1) / BLOCK_SEATS;
+    if (r != rows || c != cols) {
+        HeapScope scope(heap);
+        release();
+        size_t padded = (size_t)blocks * BLOCK_SEATS;
+        rowColumn = new int32_t[padded];
+        colColumn = new uint8_t[padded];
+        classColumn = new uint8_t[padded];
+        stateColumn = new uint8_t[padded];
+        selection = new uint64_t[blocks > 0 ? blocks : 1];
+        rows = r;
+        cols = c;
+        seatCount = seats;
+        blockCount = blocks;
+
+        // Padding never matches: row 0, and the last block is masked anyway
+        size_t tail = padded - (size_t)seats;
+        std::memset(rowColumn + seats, 0, tail * sizeof(int32_t));
+        std::memset(colColumn + seats, 0, tail);
+        std::memset(classColumn + seats, 0, tail);
+        std::memset(stateColumn + seats, SEAT_BLOCKED, tail);
+    }
+
+    classCount = 0;
+    int slot = 0;
+    for (int row = 1; row <= rows; row++) {
+        uint8_t cabin = classCode(InternedString(layout.cabinForRow(row)).getHandle());
+        for (int col = 0; col < cols; col++, slot++) {
+            rowColumn[slot] = row;
+            colColumn[slot] = (uint8_t)col;
+            classColumn[slot] = cabin;
+            stateColumn[slot] = layout.isBlocked(row, col) ? SEAT_BLOCKED : SEAT_EMPTY;
+        }
+    }
+}
+
+void SeatColumns::setPassenger(int slot, const Passenger& p) {
+    if (slot < 0 || slot >= seatCount) return;
+    classColumn[slot] = classCode(p.seatClass.getHandle());
+    stateColumn[slot] = SEAT_OCCUPIED;
+}
+
+void SeatColumns::run(const SeatQuery& q, QueryResult& out) const {
+    out.reset(q.groupBy, rows, cols);
+    int firstRow = q.firstRow > 1 ? q.firstRow : 1;
+    int lastRow = q.lastRow > 0 && q.lastRow < rows ? q.lastRow : rows;
+    int firstCol = q.firstCol ? q.firstCol - 'A' : 0;
+    int lastCol = q.lastCol && q.lastCol - 'A' < cols ? q.lastCol - 'A' : cols - 1;
+    if (firstCol < 0) firstCol = 0;
+    if (firstRow > lastRow || firstCol > lastCol) return;
+
+    int classFilter = -1;
+    if (!q.seatClass.empty()) {
+        classFilter = findClassCode(q.seatClass);
+        if (classFilter < 0) return;
+    }
+
+    // Seats are stored in row order, so only the blocks holding the row range
+    // are filtered; the row predicate still trims their edges
+    int firstBlock = (firstRow - 1) * cols / BLOCK_SEATS;
+    int lastBlock = (lastRow * cols - 1) / BLOCK_SEATS;
+    bool rowFilter = firstRow > 1 || lastRow < rows;
+    bool colFilter = firstCol > 0 || lastCol < cols - 1;
+    uint64_t lastBlockMask = (seatCount % BLOCK_SEATS) ? (1ull << (seatCount % BLOCK_SEATS)) - 1 : ~0ull;
+
+    // Filter pass: one selection word per block
+    for (int b = firstBlock; b <= lastBlock; b++) {
+        size_t base = (size_t)b * BLOCK_SEATS;
+        uint64_t sel = (b == blockCount - 1) ? lastBlockMask : ~0ull;
+        if (rowFilter) sel &= rangeMask32(rowColumn + base, firstRow, lastRow);
+        if (colFilter) sel &= rangeMask8(colColumn + base, (uint8_t)firstCol, (uint8_t)lastCol);
+        if (classFilter >= 0) sel &= equalMask8(classColumn + base, (uint8_t)classFilter);
+        if (q.state == EMPTY_ONLY) sel &= equalMask8(stateColumn + base, SEAT_EMPTY);
+        else if (q.state == OCCUPIED_ONLY) sel &= equalMask8(stateColumn + base, SEAT_OCCUPIED);
+        selection[b] = sel;
+    }
+
+    // Aggregate pass. Classes and columns are counted with one equality mask
+    // per group, unless a block has fewer selected seats than groups; then,
+    // as for rows, the selected bits are walked one by one.
+    if (q.groupBy == GROUP_NONE) {
+        long total = 0;
+        for (int b = firstBlock; b <= lastBlock; b++) total += popcount64(selection[b]);
+        out.add(total);
+    } else if (q.groupBy == GROUP_CLASS) {
+        int keys[MAX_QUERY_CLASSES];
+        for (int code = 0; code < classCount; code++) keys[code] = out.classKey(classHandles[code]);
+        for (int b = firstBlock; b <= lastBlock; b++) {
+            uint64_t sel = selection[b];
+            if (!sel) continue;
+            const uint8_t* codes = classColumn + (size_t)b * BLOCK_SEATS;
+            if (popcount64(sel) < classCount) {
+                for (; sel; sel &= sel - 1) out.addToKey(keys[codes[lowestBit64(sel)]], 1);
+                continue;
+            }
+            for (int code = 0; code < classCount; code++) {
+                int n = popcount64(sel & equalMask8(codes, (uint8_t)code));
+                if (n) out.addToKey(keys[code], n);
+            }
+        }
+    } else if (q.groupBy == GROUP_COLUMN) {
+        for (int b = firstBlock; b <= lastBlock; b++) {
+            uint64_t sel = selection[b];
+            if (!sel) continue;
+            const uint8_t* seatCols = colColumn + (size_t)b * BLOCK_SEATS;
+            if (popcount64(sel) <= lastCol - firstCol) {
+                for (; sel; sel &= sel - 1) out.addToKey(seatCols[lowestBit64(sel)], 1);
+                continue;
+            }
+            for (int col = firstCol; col <= lastCol; col++) {
+                int n = popcount64(sel & equalMask8(seatCols, (uint8_t)col));
+                if (n) out.addToKey(col, n);
+            }
+        }
+    } else {
+        for (int b = firstBlock; b <= lastBlock; b++) {
+            uint64_t sel = selection[b];
+            const int32_t* seatRows = rowColumn + (size_t)b * BLOCK_SEATS;
+            for (; sel; sel &= sel - 1) out.addToKey(seatRows[lowestBit64(sel)] - 1, 1);
+        }
+    }
+}
+
+BenchmarkResult measureColumnarQueryTime(const SeatColumns& columns, const SeatQuery* queries, int count,
+                                         const BenchmarkConfig& config) {
+    QueryResult result;
+    return runBenchmarkWithSetup([]() {}, [&]() {
+        for (int i = 0; i < count; i++) {
+            columns.run(queries[i], result);
+            doNotOptimize(result.getTotal());
+        }
+    }, count, config);
+}
@@ -0,0 +1,166 @@
+#ifndef SEAT_QUERY_HPP
+#define SEAT_QUERY_HPP
+
+#include "Passenger.hpp"
+#include "AircraftLayout.hpp"
+#include "Benchmark.hpp"
+#include "HeapTracker.hpp"
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+// Seat analytics: count and group-by queries over every seat of the aircraft,
+// e.g. "occupancy by cabin" or "passengers in rows 51-150, seats A-C".
+//
+// A query is answered in one of two ways:
+// - Row scan: each display system walks the seats of the requested rows and
+//   reads each passenger record through its own seat index (see scanSeats).
+// - Columnar: SeatColumns keeps one array per attribute in seat order. Each
+//   filter is a vectorized pass that turns 64 seats into one 64-bit word of a
+//   selection vector. Counts are popcounts of those words.
+// Both give the same answer.
+
+enum SeatState { SEAT_EMPTY = 0, SEAT_OCCUPIED = 1, SEAT_BLOCKED = 2 };
+enum StateFilter { ANY_STATE, EMPTY_ONLY, OCCUPIED_ONLY };   // empty = not blocked, no passenger
+enum QueryGroup { GROUP_NONE, GROUP_CLASS, GROUP_ROW, GROUP_COLUMN };
+
+const int MAX_QUERY_CLASSES = 64;   // distinct seat classes one query can group by
+
+struct SeatQuery {
+    std::string label;
+    int firstRow;           // 1-indexed, inclusive; 0 = open end
+    int lastRow;
+    char firstCol;          // seat letters, inclusive; 0 = open end
+    char lastCol;
+    std::string seatClass;  // "" = any. A seat's class is its passenger's, else its cabin's.
+    StateFilter state;
+    QueryGroup groupBy;
+
+    SeatQuery(const std::string& l = "")
+        : label(l), firstRow(0), lastRow(0), firstCol(0), lastCol(0),
+          state(ANY_STATE), groupBy(GROUP_NONE) {}
+};
+
+// The queries shown by the comparison menu and timed by `--bench --ops query`
+const int STANDARD_QUERY_COUNT = 4;
+void standardSeatQueries(SeatQuery* queries);
+
+// Matching seats in total and per group (row, column or class)
+class QueryResult {
+private:
+    QueryGroup groupBy;
+    long total;
+    long* counts;           // by row index, column index or class slot
+    int keyCount;
+    int keyCapacity;
+    uint32_t classHandles[MAX_QUERY_CLASSES];   // interned class name per class slot
+    int classCount;
+
+public:
+    QueryResult();
+    ~QueryResult();
+
+    QueryResult(const QueryResult&) = delete;
+    QueryResult& operator=(const QueryResult&) = delete;
+
+    // Zeroes the counts for a query over a rows x cols aircraft
+    void reset(QueryGroup group, int rows, int cols);
+
+    // Slot of a class in this result, added on first sight
+    int classKey(uint32_t handle);
+
+    void add(long n) { total += n; }
+    void addToKey(int key, long n) {
+        counts[key] += n;
+        total += n;
+    }
+
+    long getTotal() const { return total; }
+    QueryGroup getGroupBy() const { return groupBy; }
+
+    // Same total and same count in every group
+    bool sameAs(const QueryResult& other) const;
+    // Total, then up to maxGroups non-empty groups
+    void print(std::ostream& out, int maxGroups) const;
+};
+
+// Seat attributes in seat order, one array per attribute, padded to whole
+// 64-seat blocks. A snapshot: rebuild it after reservations change.
+class SeatColumns {
+private:
+    HeapAccount heap;
+    int32_t* rowColumn;     // 1-indexed row
+    uint8_t* colColumn;     // 0-indexed column
+    uint8_t* classColumn;   // code into classHandles
+    uint8_t* stateColumn;   // SeatState
+    mutable uint64_t* selection;   // one bit per seat, reused by every query
+    int rows;
+    int cols;
+    int seatCount;
+    int blockCount;
+    uint32_t classHandles[MAX_QUERY_CLASSES];
+    int classCount;
+
+    uint8_t classCode(uint32_t handle);
+    int findClassCode(const std::string& seatClass) const;   // -1 if absent
+    void release();
+
+public:
+    SeatColumns();
+    ~SeatColumns();
+
+    SeatColumns(const SeatColumns&) = delete;
+    SeatColumns& operator=(const SeatColumns&) = delete;
+
+    // Every seat empty (or blocked) with its cabin's class
+    void reset(const AircraftLayout& layout, int rows, int cols);
+    // `slot` is the row-major seat index, (row - 1) * cols + column
+    void setPassenger(int slot, const Passenger& p);
+
+    // Not thread-safe: the selection vector is shared between calls
+    void run(const SeatQuery& query, QueryResult& out) const;
+
+    int getSeatCount() const { return seatCount; }
+    HeapStats heapStats() const { return heap.stats(); }
+};
+
+// Runs every query once per call; times are per query
+BenchmarkResult measureColumnarQueryTime(const SeatColumns& columns, const SeatQuery* queries, int count,
+                                         const BenchmarkConfig& config = BenchmarkConfig());
+
+// Row scan over a rows x cols seat index. `lookup(slot)` returns the passenger
+// in a seat slot (or nullptr); empty seats take their cabin's class.
+template <class Lookup>
+void scanSeats(const SeatQuery& q, const AircraftLayout& layout, int rows, int cols,
+               Lookup lookup, QueryResult& out) {
+    out.reset(q.groupBy, rows, cols);
+    int firstRow = q.firstRow > 1 ? q.firstRow : 1;
+    int lastRow = q.lastRow > 0 && q.lastRow < rows ? q.lastRow : rows;
+    int firstCol = q.firstCol ? q.firstCol - 'A' : 0;
+    int lastCol = q.lastCol && q.lastCol - 'A' < cols ? q.lastCol - 'A' : cols - 1;
+    if (firstCol < 0) firstCol = 0;
+
+    InternedString wanted;
+    if (!q.seatClass.empty()) wanted = q.seatClass;
+
+    for (int row = firstRow; row <= lastRow; row++) {
+        InternedString cabin = layout.cabinForRow(row);
+        for (int col = firstCol; col <= lastCol; col++) {
+            const Passenger* p = lookup((row - 1) * cols + col);
+            if (q.state == OCCUPIED_ONLY && !p) continue;
+            if (q.state == EMPTY_ONLY && (p || layout.isBlocked(row, col))) continue;
+
+            const InternedString& seatClass = p ? p->seatClass : cabin;
+            if (!q.seatClass.empty() && seatClass != wanted) continue;
+
+            switch (q.groupBy) {
+                case GROUP_NONE: out.add(1); break;
+                case GROUP_ROW: out.addToKey(row - 1, 1); break;
+                case GROUP_COLUMN: out.addToKey(col, 1); break;
+                case GROUP_CLASS: out.addToKey(out.classKey(seatClass.getHandle()), 1); break;
+            }
+        }
+    }
+}
+
+#endif
@@ -1,4 +1,6 @@
 #include "Seat_Manifest.hpp"
+#include "Trace.hpp"
+#include "Prefetch.hpp"
 #include <cstring>
 #include <cstdlib>
 #include <ctime>
@@ -15,56 +17,49 @@ int comparePassengers(const Passenger& a, const Passenger& b, bool sortByID = fa
     }
 }
 
-// Standard Merge function for Merge Sort
-void merge(Passenger* arr, int left, int mid, int right, bool sortByID) {
+// Merges arr[left..mid] and arr[mid+1..right]. Only the left run is moved
+// out to `scratch`: the write position never passes the unread right run.
+void merge(Passenger* arr, Passenger* scratch, int left, int mid, int right, bool sortByID) {
     int n1 = mid - left + 1;
-    int n2 = right - mid;
+    for (int i = 0; i < n1; i++) scratch[i] = std::move(arr[left + i]);
     
-    // Create temporary arrays
-    Passenger* leftArr = new Passenger[n1];
-    Passenger* rightArr = new Passenger[n2];
-    
-    // Copy data to temp arrays
-    for (int i = 0; i < n1; i++) leftArr[i] = arr[left + i];
-    for (int j = 0; j < n2; j++) rightArr[j] = arr[mid + 1 + j];
-    
-    // Merge temp arrays back into main array
-    int i = 0, j = 0, k = left;
-    while (i < n1 && j < n2) {
-        if (comparePassengers(leftArr[i], rightArr[j], sortByID) <= 0) {
-            arr[k] = leftArr[i++];
+    int i = 0, j = mid + 1, k = left;
+    while (i < n1 && j <= right) {
+        if (comparePassengers(scratch[i], arr[j], sortByID) <= 0) {
+            arr[k++] = std::move(scratch[i++]);
         } else {
-            arr[k] = rightArr[j++];
+            arr[k++] = std::move(arr[j++]);
         }
-        k++;
     }
     
-    // Copy remaining elements
-    while (i < n1) arr[k++] = leftArr[i++];
-    while (j < n2) arr[k++] = rightArr[j++];
+    // Whatever is left of the right run is already in place
+    while (i < n1) arr[k++] = std::move(scratch[i++]);
+}
+
+static void mergeSortRange(Passenger* arr, Passenger* scratch, int left, int right, bool sortByID) {
+    if (left >= right) return;
     
-    // Clean up memory
-    delete[] leftArr;
-    delete[] rightArr;
+    int mid = left + (right - left) / 2;
+    mergeSortRange(arr, scratch, left, mid, sortByID);
+    mergeSortRange(arr, scratch, mid + 1, right, sortByID);
+    merge(arr, scratch, left, mid, right, sortByID);
 }
 
-// Recursive Merge Sort implementation
+// Merge sort with one scratch buffer (half the range) for the whole sort;
+// records are moved, never copied
 void mergeSort(Passenger* arr, int left, int right, bool sortByID) {
     if (left >= right) return;
     
-    int mid = left + (right - left) / 2;
-    mergeSort(arr, left, mid, sortByID);
-    mergeSort(arr, mid + 1, right, sortByID);
-    merge(arr, left, mid, right, sortByID);
+    Passenger* scratch = new Passenger[(right - left) / 2 + 1];
+    mergeSortRange(arr, scratch, left, right, sortByID);
+    delete[] scratch;
 }
 
 // ==================== HELPER FUNCTIONS ====================
 
-// Determine flight class based on row ranges
+// Determine flight class from the active aircraft layout's cabins
 std::string getClassFromRow(int row) {
-    if (row >= 1 && row <= 50) return "Business";
-    if (row >= 51 && row <= 150) return "First";
-    return "Economy";  
+    return activeLayout().cabinForRow(row);
 }
 
 // Convert zero-indexed integer to seat character (0 -> 'A')
@@ -76,6 +71,7 @@ char intToSeatLetter(int num) {
 
 // Reads CSV data. Performs two passes: 1. Count lines 2. Parse data
 Passenger* readPassengersFromCSV(const char* filename, int* passengerCount) {
+    TRACE_SPAN("load", "readPassengersFromCSV");
     std::ifstream file(filename);
     *passengerCount = 0;
     
@@ -151,7 +147,8 @@ Passenger* readPassengersFromCSV(const char* filename, int* passengerCount) {
                     seatClass = getClassFromRow(seatRow);
                 }
                 
-                passengers[index++] = Passenger(passengerID, name, seatRow, seatColChar, seatClass, isEmptySeat);
+                passengers[index++] = Passenger(std::move(passengerID), std::move(name), seatRow, seatColChar,
+                                                std::move(seatClass), isEmptySeat);
             }
         }
     }
@@ -168,239 +165,243 @@ Passenger* readPassengersFromCSV(const char* filename, int* passengerCount) {
     return passengers;
 }
 
-// ==================== SIMPLE HASH MAP ====================
-
-// Initialize hash table with null pointers
-SimpleHashMap::SimpleHashMap() {
-    table = new HashEntry*[TABLE_SIZE]();
-}
+// ==================== CHART AND MANIFEST OUTPUT ====================
+// Shared by both display systems, so equal data gives equal bytes
 
-SimpleHashMap::~SimpleHashMap() {
-    clear();
-    delete[] table;
+// Title, grid, statistics and legend. The grid stops a few rows and columns
+// past the last reserved seat.
+void renderSeatingChart(SeatChartRenderer& out, const SeatOccupancy& seats) {
+    int totalSeats = seats.getRows() * seats.getCols();
+    int reserved = seats.countReserved();
+    int available = totalSeats - reserved;
+    
+    int displayRows = std::min(seats.maxUsedRow() + 5, seats.getRows());
+    int displayCols = std::min(seats.maxUsedCol() + 3, seats.getCols());
+    
+    out.reset();
+    out.appendTitle();
+    out.appendGrid(seats, displayRows, displayCols);
+    
+    out.appendText("\nSEAT STATISTICS:\n");
+    out.appendColor(COLOR_RED);
+    out.appendText("Reserved: ");
+    out.appendInt(reserved);
+    out.appendText(" seats");
+    out.appendColor(COLOR_RESET);
+    out.appendChar('\n');
+    out.appendColor(COLOR_GREEN);
+    out.appendText("Available: ");
+    out.appendInt(available);
+    out.appendText(" seats");
+    out.appendColor(COLOR_RESET);
+    out.appendChar('\n');
+    out.appendText("Total: ");
+    out.appendInt(totalSeats);
+    out.appendText(" seats\n");
+    
+    // Per-cabin breakdown
+    const AircraftLayout& layout = activeLayout();
+    for (int i = 0; i < layout.getCabinCount(); i++) {
+        const CabinSection& cabin = layout.getCabin(i);
+        if (i > 0) out.appendText(" | ");
+        out.appendText(cabin.seatClass.c_str());
+        out.appendText(": ");
+        out.appendInt(seats.countReservedInRows(cabin.firstRow - 1, cabin.lastRow - 1));
+    }
+    out.appendText(" reserved\n");
+    
+    out.appendLegend();
 }
 
-// Insert using polynomial rolling hash and chaining for collisions
-void SimpleHashMap::insert(const std::string& key, Passenger* value) {
-    size_t hash = 0;
-    for (char c : key) {
-        hash = hash * 31 + c;
-    }
-    int index = hash % TABLE_SIZE;
-    
-    // Add new entry to the front of the linked list at this bucket
-    table[index] = new HashEntry(key, value, table[index]);
+ManifestWriter::ManifestWriter(std::ostream& out, int total, bool sortedBySeat, int limit)
+    : out(out), total(total), limit(limit), written(0) {
+    out << (sortedBySeat ? "PASSENGER MANIFEST (Sorted by Seat)\n" : "PASSENGER MANIFEST (Unsorted)\n");
+    out << "====================================\n";
+    out << "Total Passengers: " << total << "\n\n";
+    
+    out << std::left << std::setw(10) << "Seat" 
+        << std::setw(15) << "Passenger ID" 
+        << std::setw(25) << "Name" 
+        << std::setw(12) << "Class" 
+        << "\n";
+    out << std::string(62, '-') << "\n";
 }
 
-// Find value by key using the same hash logic
-Passenger* SimpleHashMap::find(const std::string& key) const {
-    size_t hash = 0;
-    for (char c : key) {
-        hash = hash * 31 + c;
-    }
-    int index = hash % TABLE_SIZE;
-    
-    HashEntry* entry = table[index];
-    while (entry) {
-        if (entry->key == key) {
-            return entry->value;
-        }
-        entry = entry->next;
-    }
-    return nullptr;
+bool ManifestWriter::add(const Passenger& p) {
+    if (limit > 0 && written >= limit) return false;
+    
+    std::string seat = std::to_string(p.seatRow) + p.seatColumn;
+    out << std::left << std::setw(10) << seat
+        << std::setw(15) << p.passengerID
+        << std::setw(25) << p.name
+        << std::setw(12) << p.seatClass
+        << "\n";
+    written++;
+    
+    // Pagination
+    if (limit > 0 && written >= limit && total > limit) {
+        out << "... and " << (total - limit) << " more passengers\n";
+        return false;
+    }
+    return true;
 }
 
-// Clean up all dynamically allocated entries
-void SimpleHashMap::clear() {
-    for (int i = 0; i < TABLE_SIZE; i++) {
-        HashEntry* entry = table[i];
-        while (entry) {
-            HashEntry* next = entry->next;
-            delete entry;
-            entry = next;
-        }
-        table[i] = nullptr;
+void writeManifestRows(std::ostream& out, const Passenger* rows, int count, bool sortedBySeat, int limit) {
+    ManifestWriter writer(out, count, sortedBySeat, limit);
+    for (int i = 0; i < count; i++) {
+        if (!writer.add(rows[i])) break;
     }
 }
 
-// ==================== ARRAY DISPLAY SYSTEM ====================
+// ==================== DISPLAY SYSTEM ====================
 
-ArrayDisplaySystem::ArrayDisplaySystem(int rows, int seats) 
-    : totalRows(rows), seatsPerRow(seats), passengerCount(0), capacity(1000), isSorted(false) {
-    
-    // Allocate 2D grid (array of pointers) for spatial lookups
-    seatGrid = new Passenger**[totalRows];
-    for (int i = 0; i < totalRows; i++) {
-        seatGrid[i] = new Passenger*[seatsPerRow];
-        for (int j = 0; j < seatsPerRow; j++) {
-            seatGrid[i][j] = nullptr;
-        }
-    }
-    
-    // Allocate 1D array for linear storage
-    passengerList = new Passenger[capacity];
-    sortedByID = nullptr;
+template <class Storage, class Index, class SeatMap>
+DisplaySystem<Storage, Index, SeatMap>::DisplaySystem(int rows, int seats)
+    : totalRows(rows), seatsPerRow(seats), occupancy(0, 0), chartRenderer(rows, seats) {
+    HeapScope scope(this->heap);
+    occupancy.resize(rows, seats);
+    seatMap.resize(totalRows * seatsPerRow);
 }
 
-ArrayDisplaySystem::~ArrayDisplaySystem() {
-    for (int i = 0; i < totalRows; i++) {
-        delete[] seatGrid[i];
-    }
-    delete[] seatGrid;
-    delete[] passengerList;
-    delete[] sortedByID;
-}
-
-// Dynamic resizing for the main passenger list
-void ArrayDisplaySystem::resizePassengerList(int newCapacity) {
-    Passenger* newList = new Passenger[newCapacity];
-    for (int i = 0; i < passengerCount; i++) {
-        newList[i] = passengerList[i];
-    }
-    delete[] passengerList;
-    passengerList = newList;
-    capacity = newCapacity;
-}
-
-// Dynamic resizing for the sorted optimization array
-void ArrayDisplaySystem::resizeSortedArray() {
-    delete[] sortedByID;
-    sortedByID = new Passenger[passengerCount];
-}
-
-// Populates both the linear list and the 2D grid from input array
-void ArrayDisplaySystem::loadPassengersFromArray(const Passenger* passengers, int count) {
-    // Reset grid
-    for (int i = 0; i < totalRows; i++) {
-        for (int j = 0; j < seatsPerRow; j++) {
-            seatGrid[i][j] = nullptr;
-        }
+// Occupied records into storage in input order, then into the seat map and
+// bitmap. Seats outside the layout are stored but not mapped.
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::loadPassengersFromArray(const Passenger* passengers, int count) {
+    TRACE_SPAN("index", "DisplaySystem::loadPassengersFromArray");
+    int occupied = 0;
+    for (int i = 0; i < count; i++) {
+        if (!passengers[i].isEmpty) occupied++;
     }
     
-    if (count > capacity) {
-        resizePassengerList(count * 2);
-    }
+    this->clear();
+    this->reserve(occupied);  // records stay put while the seat map points at them
+    seatMap.clear();
+    occupancy.clear();
     
-    passengerCount = 0;
     for (int i = 0; i < count; i++) {
         if (passengers[i].isEmpty) continue;
+        Passenger* stored = this->add(passengers[i]);
         
-        // Store in 1D list
-        passengerList[passengerCount] = passengers[i];
-        
-        // Map to 2D grid coordinates (0-indexed)
-        int rowIndex = passengers[i].seatRow - 1;
-        int colIndex = passengers[i].seatColumn - 'A';
-        
+        int rowIndex = stored->seatRow - 1;
+        int colIndex = stored->seatColumn - 'A';
         if (rowIndex >= 0 && rowIndex < totalRows && 
             colIndex >= 0 && colIndex < seatsPerRow) {
-            seatGrid[rowIndex][colIndex] = &passengerList[passengerCount];
+            seatMap.assign(rowIndex * seatsPerRow + colIndex, this->storage, stored);
+            occupancy.reserve(rowIndex, colIndex);
         }
-        
-        passengerCount++;
     }
-    
-    isSorted = false; // Invalidate sorted cache
 }
 
-// O(N) search through unsorted list
-Passenger* ArrayDisplaySystem::linearSearchByID(const std::string& passengerID) const {
-    for (int i = 0; i < passengerCount; i++) {
-        if (passengerList[i].passengerID == passengerID && !passengerList[i].isEmpty) {
-            return const_cast<Passenger*>(&passengerList[i]);
-        }
-    }
-    return nullptr;
+// O(N) walk of the records
+template <class Storage, class Index, class SeatMap>
+Passenger* DisplaySystem<Storage, Index, SeatMap>::linearSearchByID(const std::string& passengerID) const {
+    return this->scan(passengerID);
 }
 
-// Prepares the secondary array for binary search
-void ArrayDisplaySystem::sortByPassengerID() {
-    if (isSorted) return;
-    
-    if (!sortedByID || passengerCount > capacity) {
-        resizeSortedArray();
-    }
-    
-    // Extract non-empty passengers
-    int sortedCount = 0;
-    for (int i = 0; i < passengerCount; i++) {
-        if (!passengerList[i].isEmpty) {
-            sortedByID[sortedCount++] = passengerList[i];
-        }
-    }
-    
-    mergeSort(sortedByID, 0, sortedCount - 1, true); // Sort by ID
-    isSorted = true;
+// Polynomial hash for the group table: cheap enough to run on every record
+static uint32_t groupHash(const std::string& id) {
+    uint32_t hash = 0;
+    for (char c : id) hash = hash * 31 + (unsigned char)c;
+    return hash;
 }
 
-// O(log N) search (requires sorting first)
-Passenger* ArrayDisplaySystem::binarySearchByID(const std::string& passengerID) {
-    if (!isSorted) {
-        sortByPassengerID();
-    }
-    
-    int sortedCount = 0;
-    while (sortedCount < passengerCount && !sortedByID[sortedCount].isEmpty) {
-        sortedCount++;
-    }
-    
-    // Standard Binary Search implementation
-    int low = 0;
-    int high = sortedCount - 1;
-    
-    while (low <= high) {
-        int mid = low + (high - low) / 2;
-        int cmp = passengerID.compare(sortedByID[mid].passengerID);
+// One walk answers up to LIST_GROUP_MAX IDs: the IDs go into a small
+// open-addressing table up front, and each record's ID is hashed once and
+// probed against it while the next record is being prefetched.
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::linearSearchGroup(const std::string* ids, int count,
+                                                               Passenger** results) const {
+    const int TABLE_BITS = 7;                       // 128 slots >= 2 * LIST_GROUP_MAX
+    const int TABLE_MASK = (1 << TABLE_BITS) - 1;
+    
+    for (int base = 0; base < count; base += LIST_GROUP_MAX) {
+        int n = count - base < LIST_GROUP_MAX ? count - base : LIST_GROUP_MAX;
+        const std::string* group = ids + base;
+        Passenger** out = results + base;
         
-        if (cmp == 0) {
-            return &sortedByID[mid];
-        } else if (cmp < 0) {
-            high = mid - 1;
-        } else {
-            low = mid + 1;
+        int slots[TABLE_MASK + 1];
+        uint32_t hashes[LIST_GROUP_MAX];
+        int firstCopy[LIST_GROUP_MAX];              // duplicate IDs share the first one's result
+        for (int t = 0; t <= TABLE_MASK; t++) slots[t] = -1;
+        
+        int unresolved = 0;
+        for (int k = 0; k < n; k++) {
+            out[k] = nullptr;
+            hashes[k] = groupHash(group[k]);
+            firstCopy[k] = k;
+            int t = (int)(hashes[k] & TABLE_MASK);
+            while (slots[t] >= 0 && !(hashes[slots[t]] == hashes[k] && group[slots[t]] == group[k])) {
+                t = (t + 1) & TABLE_MASK;
+            }
+            if (slots[t] >= 0) {
+                firstCopy[k] = slots[t];
+            } else {
+                slots[t] = k;
+                unresolved++;
+            }
+        }
+        
+        for (auto it = this->storage.begin(); it != this->storage.end() && unresolved > 0; ++it) {
+            auto next = it;
+            ++next;
+            if (next != this->storage.end()) prefetchRead(&*next);
+            
+            uint32_t h = groupHash(it->passengerID);
+            for (int t = (int)(h & TABLE_MASK); slots[t] >= 0; t = (t + 1) & TABLE_MASK) {
+                int k = slots[t];
+                if (hashes[k] == h && !out[k] && group[k] == it->passengerID) {
+                    out[k] = &*it;                  // first match in storage order, as in linearSearchByID
+                    unresolved--;
+                    break;
+                }
+            }
         }
+        
+        for (int k = 0; k < n; k++) out[k] = out[firstCopy[k]];
     }
-    return nullptr;
 }
 
-// Sorts the main list by Seat Row/Col for manifest display
-void ArrayDisplaySystem::sortBySeatCommon() {
-    if (passengerCount <= 0) return;
-    
-    int nonEmptyCount = 0;
-    for (int i = 0; i < passengerCount; i++) {
-        if (!passengerList[i].isEmpty) nonEmptyCount++;
-    }
-    
-    if (nonEmptyCount <= 0) return;
-    
-    // Sort in temporary array to avoid modifying core list structure
-    Passenger* tempArray = new Passenger[nonEmptyCount];
-    int index = 0;
-    for (int i = 0; i < passengerCount; i++) {
-        if (!passengerList[i].isEmpty) {
-            tempArray[index++] = passengerList[i];
-        }
-    }
-    
-    mergeSort(tempArray, 0, nonEmptyCount - 1, false); // Sort by Seat
-    
-    delete[] tempArray;
+// Contiguous records: one scan per ID
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::batchLinearSearch(const std::string* ids, long begin, long end,
+                                                               Passenger** results, std::true_type) const {
+    for (long i = begin; i < end; i++) results[i] = linearSearchByID(ids[i]);
+}
+
+// Linked records: one walk per group of IDs
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::batchLinearSearch(const std::string* ids, long begin, long end,
+                                                               Passenger** results, std::false_type) const {
+    linearSearchGroup(ids + begin, (int)(end - begin), results + begin);
 }
 
-// O(1) access via 2D array
-Passenger* ArrayDisplaySystem::getSeatDirect(int row, char col) const {
+// Input order is kept because each ID owns its result slot
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::batchLinearSearchByID(const std::string* ids, int count,
+                                                                   Passenger** results,
+                                                                   WorkStealingPool* pool) const {
+    TRACE_SPAN("search", "DisplaySystem::batchLinearSearchByID");
+    auto body = [&](long begin, long end) {
+        batchLinearSearch(ids, begin, end, results, std::integral_constant<bool, Storage::RANDOM_ACCESS>());
+    };
+    parallelForOrSerial(pool, count, BATCH_SEARCH_GRAIN, body);
+}
+
+// O(1) access via the flat seat map
+template <class Storage, class Index, class SeatMap>
+Passenger* DisplaySystem<Storage, Index, SeatMap>::getSeatDirect(int row, char col) const {
     int rowIndex = row - 1;
     int colIndex = col - 'A';
     
     if (rowIndex >= 0 && rowIndex < totalRows && 
         colIndex >= 0 && colIndex < seatsPerRow) {
-        return seatGrid[rowIndex][colIndex];
+        return seatMap.at(rowIndex * seatsPerRow + colIndex, this->storage);
     }
     return nullptr;
 }
 
-std::string ArrayDisplaySystem::getSeatStatus(int row, char col) const {
+template <class Storage, class Index, class SeatMap>
+std::string DisplaySystem<Storage, Index, SeatMap>::getSeatStatus(int row, char col) const {
     Passenger* passenger = getSeatDirect(row, col);
     if (passenger == nullptr) {
         return "Available";
@@ -411,693 +412,527 @@ std::string ArrayDisplaySystem::getSeatStatus(int row, char col) const {
     }
 }
 
-// Visualizes the 2D grid
-void ArrayDisplaySystem::displaySeatingChart() const {
-    // Calculate display bounds based on actual data
-    int maxUsedRow = 0;
-    int maxUsedCol = 0;
-    
+// Sorts a copy by seat, leaving the stored order alone (counted in this
+// instance's peak, released before returning)
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::sortBySeatCommon() {
+    TRACE_SPAN("sort", "DisplaySystem::sortBySeatCommon");
+    if (this->size() == 0) return;
+    
+    HeapScope scope(this->heap);
+    int sortedCount = 0;
+    Passenger* tempArray = copyPassengers(&sortedCount);
+    mergeSort(tempArray, 0, sortedCount - 1, false);
+    delete[] tempArray;
+}
+
+// Seat states straight from the seat grid (one pass over every cell)
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::buildSeatingChart(SeatOccupancy& seats, std::true_type) const {
     for (int row = 0; row < totalRows; row++) {
         for (int col = 0; col < seatsPerRow; col++) {
-            if (seatGrid[row][col] != nullptr) {
-                if (row + 1 > maxUsedRow) maxUsedRow = row + 1;
-                if (col + 1 > maxUsedCol) maxUsedCol = col + 1;
-            }
+            if (seatMap.at(row * seatsPerRow + col, this->storage)) seats.reserve(row, col);
         }
     }
-    
-    // Set display limits
-    int displayRows = std::min(maxUsedRow + 5, totalRows);
-    int displayCols = std::min(maxUsedCol + 3, seatsPerRow);
-    
-    std::cout << "SEATING CHART (" << COLOR_RED << "X" << COLOR_RESET << " = Reserved, " 
-              << COLOR_GREEN << "O" << COLOR_RESET << " = Available)\n";
-    std::cout << "===============================================\n\n";
-    
-    // Print Header
-    std::cout << "     ";
-    for (int col = 0; col < displayCols; col++) {
-        std::cout << char('A' + col) << " ";
-    }
-    std::cout << "\n";
-    
-    // Print Rows
-    for (int row = 0; row < displayRows; row++) {
-        std::cout << std::setw(3) << (row + 1) << ": ";
-        
-        for (int col = 0; col < displayCols; col++) {
-            Passenger* passenger = seatGrid[row][col];
-            
-            if (passenger == nullptr || passenger->isEmpty) {
-                std::cout << COLOR_GREEN << "O " << COLOR_RESET;
-            } else {
-                std::cout << COLOR_RED << "X " << COLOR_RESET;
-            }
-        }
-        std::cout << "\n";
-    }
-    
-    // Calculate and print statistics
-    int reserved = 0;
-    int available = 0;
-    
-    for (int row = 0; row < totalRows; row++) {
-        for (int col = 0; col < seatsPerRow; col++) {
-            if (seatGrid[row][col] == nullptr || seatGrid[row][col]->isEmpty) {
-                available++;
-            } else {
-                reserved++;
-            }
+}
+
+// Seat states from a walk of every node
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::buildSeatingChart(SeatOccupancy& seats, std::false_type) const {
+    this->forEach([&](const Passenger& p) {
+        int rowIndex = p.seatRow - 1;
+        int colIndex = p.seatColumn - 'A';
+        if (rowIndex >= 0 && rowIndex < totalRows && colIndex >= 0 && colIndex < seatsPerRow) {
+            seats.reserve(rowIndex, colIndex);
         }
-    }
-    
-    std::cout << "\nSEAT STATISTICS:\n";
-    std::cout << "" << COLOR_RED << "Reserved: " << reserved << " seats" << COLOR_RESET << "\n";
-    std::cout << "" << COLOR_GREEN << "Available: " << available << " seats" << COLOR_RESET << "\n";
-    std::cout << "Total: " << totalRows * seatsPerRow << " seats\n";
-    
-    std::cout << "\nLEGEND:\n";
-    std::cout << COLOR_RED << "X" << COLOR_RESET << " - Reserved Seat\n";
-    std::cout << COLOR_GREEN << "O" << COLOR_RESET << " - Available Seat\n";
+    });
 }
 
-// Displays list of passengers sorted by seat number
-void ArrayDisplaySystem::displayPassengerManifest() const {
-    if (passengerCount == 0) {
-        std::cout << "No passengers in the manifest.\n";
+// The chart's input, rebuilt from the structure itself rather than the bitmap
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::buildSeatingChart(SeatOccupancy& seats) const {
+    seats.clear();
+    buildSeatingChart(seats, std::integral_constant<bool, Storage::RANDOM_ACCESS>());
+}
+
+// Chart from the occupancy bitmap, written with one call
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::writeSeatingChart(std::ostream& out) const {
+    renderSeatingChart(chartRenderer, occupancy);
+    chartRenderer.flush(out);
+}
+
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::displaySeatingChart() const {
+    TRACE_SPAN("render", "DisplaySystem::displaySeatingChart");
+    if (this->size() == 0) {
+        std::cout << "No passengers in the system.\n";
         return;
     }
-    
-    // Copy to temp array for sorting to preserve original order
-    Passenger* sortedList = new Passenger[passengerCount];
-    int sortedCount = 0;
-    
-    for (int i = 0; i < passengerCount; i++) {
-        if (!passengerList[i].isEmpty) {
-            sortedList[sortedCount++] = passengerList[i];
+    writeSeatingChart(std::cout);
+}
+
+// Every record in storage order; the caller frees the copy
+template <class Storage, class Index, class SeatMap>
+Passenger* DisplaySystem<Storage, Index, SeatMap>::copyPassengers(int* count) const {
+    int n = this->size();
+    Passenger* copy = new Passenger[n > 0 ? n : 1];
+    int index = 0;
+    this->forEach([&](const Passenger& p) { copy[index++] = p; });
+    *count = n;
+    return copy;
+}
+
+// Unsorted: straight from storage. Sorted: merge sort of a copy, so the
+// stored order is preserved.
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::writePassengerManifest(std::ostream& out, bool sortBySeat,
+                                                                    int limit) const {
+    if (!sortBySeat) {
+        ManifestWriter writer(out, this->size(), false, limit);
+        for (auto it = this->storage.begin(); it != this->storage.end(); ++it) {
+            if (!writer.add(*it)) break;
         }
+        return;
     }
     
-    if (sortedCount > 0) {
+    int sortedCount = 0;
+    Passenger* sortedList = copyPassengers(&sortedCount);
+    if (sortedCount > 1) {
         mergeSort(sortedList, 0, sortedCount - 1, false);
     }
-    
-    std::cout << "PASSENGER MANIFEST (Sorted by Seat)\n";
-    std::cout << "====================================\n";
-    std::cout << "Total Passengers: " << sortedCount << "\n\n";
-    
-    std::cout << std::left << std::setw(10) << "Seat" 
-              << std::setw(15) << "Passenger ID" 
-              << std::setw(25) << "Name" 
-              << std::setw(12) << "Class" 
-              << "\n";
-    std::cout << std::string(62, '-') << "\n";
-    
-    int count = 0;
-    for (int i = 0; i < sortedCount; i++) {
-        std::string seat = std::to_string(sortedList[i].seatRow) + sortedList[i].seatColumn;
-        std::cout << std::left << std::setw(10) << seat
-                  << std::setw(15) << sortedList[i].passengerID
-                  << std::setw(25) << sortedList[i].name
-                  << std::setw(12) << sortedList[i].seatClass
-                  << "\n";
-        count++;
-        
-        // Pagination (limit to 50)
-        if (count >= 50 && sortedCount > 50) {
-            std::cout << "... and " << (sortedCount - 50) << " more passengers\n";
-            break;
-        }
-    }
-    
+    writeManifestRows(out, sortedList, sortedCount, true, limit);
     delete[] sortedList;
 }
 
-// --- Measurement Functions (using high_resolution_clock) ---
-double ArrayDisplaySystem::measureLinearSearchTime(const std::string& id) const {
-    auto start = std::chrono::high_resolution_clock::now();
-    linearSearchByID(id);
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    return duration.count() * 1000000; // Microseconds
+// Seat order is seat map order, so the bitmap walk needs no sort
+template <class Storage, class Index, class SeatMap>
+int DisplaySystem<Storage, Index, SeatMap>::exportManifest(ManifestStream& out, int cursor, int maxRows) const {
+    TRACE_SPAN("render", "DisplaySystem::exportManifest");
+    return streamSeatOrder(occupancy, cursor, maxRows, out, [&](int slot) -> const Passenger* {
+        return seatMap.at(slot, this->storage);
+    });
 }
 
-double ArrayDisplaySystem::measureBinarySearchTime(const std::string& id) {
-    auto start = std::chrono::high_resolution_clock::now();
-    binarySearchByID(id);
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    return duration.count() * 1000000;
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::runSeatQuery(const SeatQuery& query, QueryResult& out) const {
+    TRACE_SPAN("search", "DisplaySystem::runSeatQuery");
+    scanSeats(query, activeLayout(), totalRows, seatsPerRow, [&](int slot) -> const Passenger* {
+        return seatMap.at(slot, this->storage);
+    }, out);
 }
 
-double ArrayDisplaySystem::measureSeatingChartTime() const {
-    auto start = std::chrono::high_resolution_clock::now();
-    
-    // Simulate traversal of grid
-    int occupiedCount = 0;
-    for (int row = 0; row < std::min(50, totalRows); row++) {
-        for (int col = 0; col < std::min(10, seatsPerRow); col++) {
-            Passenger* passenger = seatGrid[row][col];
-            if (passenger != nullptr && !passenger->isEmpty) {
-                occupiedCount++;
-            }
-        }
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::buildSeatColumns(SeatColumns& columns) const {
+    TRACE_SPAN("index", "DisplaySystem::buildSeatColumns");
+    columns.reset(activeLayout(), totalRows, seatsPerRow);
+    for (int slot = 0; slot < totalRows * seatsPerRow; slot++) {
+        const Passenger* p = seatMap.at(slot, this->storage);
+        if (p) columns.setPassenger(slot, *p);
     }
-    
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    return duration.count() * 1000000;
 }
 
-double ArrayDisplaySystem::measureUnsortedManifestTime() const {
-    auto start = std::chrono::high_resolution_clock::now();
-    
-    // Simulate linear scan
-    int nonEmptyCount = 0;
-    for (int i = 0; i < passengerCount; i++) {
-        if (!passengerList[i].isEmpty) nonEmptyCount++;
+// First page of the seat-order manifest, streamed from the seat map
+template <class Storage, class Index, class SeatMap>
+void DisplaySystem<Storage, Index, SeatMap>::displayPassengerManifest() const {
+    TRACE_SPAN("render", "DisplaySystem::displayPassengerManifest");
+    if (this->size() == 0) {
+        std::cout << "No passengers in the manifest.\n";
+        return;
     }
-    
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    return duration.count() * 1000000;
+    ManifestStream stream(std::cout, MANIFEST_DISPLAY_BUFFER);
+    int total = occupancy.countReserved();
+    stream.writeHeader(total);
+    exportManifest(stream, 0, MANIFEST_DISPLAY_LIMIT);
+    if (total > MANIFEST_DISPLAY_LIMIT) stream.writeRemainder(total - MANIFEST_DISPLAY_LIMIT);
 }
 
-double ArrayDisplaySystem::measureSortedManifestTime() const {
-    auto start = std::chrono::high_resolution_clock::now();
-    
-    if (passengerCount == 0) return 0.0;
-    
-    // Include allocation, copy, and sort time
-    int nonEmptyCount = 0;
-    for (int i = 0; i < passengerCount; i++) {
-        if (!passengerList[i].isEmpty) nonEmptyCount++;
-    }
-    
-    if (nonEmptyCount == 0) return 0.0;
-    
-    Passenger* tempArray = new Passenger[nonEmptyCount];
-    int index = 0;
-    for (int i = 0; i < passengerCount; i++) {
-        if (!passengerList[i].isEmpty) {
-            tempArray[index++] = passengerList[i];
+// --- Measurement Functions (benchmark harness, ns per operation) ---
+template <class Storage, class Index, class SeatMap>
+BenchmarkResult DisplaySystem<Storage, Index, SeatMap>::measureLinearSearchTime(const std::string& id,
+                                                                                const BenchmarkConfig& config) const {
+    TRACE_SPAN("search", "DisplaySystem::measureLinearSearchTime");
+    return runBenchmark([&]() {
+        doNotOptimize(linearSearchByID(id));
+    }, config);
+}
+
+// One call looks up every seat of the aircraft; reported per lookup
+template <class Storage, class Index, class SeatMap>
+BenchmarkResult DisplaySystem<Storage, Index, SeatMap>::measureSeatLookupTime(const BenchmarkConfig& config) const {
+    TRACE_SPAN("search", "DisplaySystem::measureSeatLookupTime");
+    return runBenchmarkWithSetup([]() {}, [&]() {
+        for (int row = 1; row <= totalRows; row++) {
+            for (int col = 0; col < seatsPerRow; col++) doNotOptimize(getSeatDirect(row, (char)('A' + col)));
         }
-    }
-    
-    mergeSort(tempArray, 0, nonEmptyCount - 1, false);
-    
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    
-    delete[] tempArray;
-    return duration.count() * 1000000;
+    }, (long)totalRows * seatsPerRow, config);
 }
 
-double ArrayDisplaySystem::measureSortingTime() const {
-    return measureSortedManifestTime(); 
+// Seat states rebuilt from the seat grid or a walk of the nodes
+template <class Storage, class Index, class SeatMap>
+BenchmarkResult DisplaySystem<Storage, Index, SeatMap>::measureChartBuildTime(const BenchmarkConfig& config) const {
+    SeatOccupancy seats(totalRows, seatsPerRow);
+    return runBenchmark([&]() {
+        buildSeatingChart(seats);
+        doNotOptimize(seats);
+    }, config);
 }
 
-double ArrayDisplaySystem::measureDisplayOnlyTime() const {
-    auto start = std::chrono::high_resolution_clock::now();
-    
-    if (passengerCount == 0) return 0.0;
-    
-    // Simulate string formatting cost
-    for (int i = 0; i < passengerCount; i++) {
-        if (!passengerList[i].isEmpty) {
-            std::string seat = std::to_string(passengerList[i].seatRow) + passengerList[i].seatColumn;
-            std::string dummy = seat + passengerList[i].passengerID + passengerList[i].name + passengerList[i].seatClass;
-        }
-    }
-    
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    return duration.count() * 1000000;
+// The displayed chart, rendered and written to a null sink
+template <class Storage, class Index, class SeatMap>
+BenchmarkResult DisplaySystem<Storage, Index, SeatMap>::measureSeatingChartTime(const BenchmarkConfig& config) const {
+    NullStream sink;
+    return runBenchmark([&]() {
+        writeSeatingChart(sink);
+    }, config);
 }
 
-// Generate test data for benchmarks
-char** ArrayDisplaySystem::getTestIDs(int count, int* actualCount) const {
-    char** testIDs = nullptr;
-    *actualCount = 0;
-    
-    if (passengerCount == 0 || count <= 0) return testIDs;
-    
-    int nonEmptyCount = 0;
-    for (int i = 0; i < passengerCount; i++) {
-        if (!passengerList[i].isEmpty) nonEmptyCount++;
-    }
-    
-    // Allocate array of strings
-    if (nonEmptyCount <= count) {
-        testIDs = new char*[nonEmptyCount];
-        *actualCount = nonEmptyCount;
-        int index = 0;
-        for (int i = 0; i < passengerCount && index < nonEmptyCount; i++) {
-            if (!passengerList[i].isEmpty) {
-                testIDs[index] = new char[passengerList[i].passengerID.length() + 1];
-                strcpy(testIDs[index], passengerList[i].passengerID.c_str());
-                index++;
-            }
-        }
-        return testIDs;
-    }
-    
-    // Return a subset
-    testIDs = new char*[count];
-    *actualCount = count;
-    int selected = 0;
-    
-    for (int i = 0; i < passengerCount && selected < count; i++) {
-        if (!passengerList[i].isEmpty) {
-            testIDs[selected] = new char[passengerList[i].passengerID.length() + 1];
-            strcpy(testIDs[selected], passengerList[i].passengerID.c_str());
-            selected++;
-        }
-    }
-    
-    return testIDs;
+// Every passenger in storage order, formatted to a null sink
+template <class Storage, class Index, class SeatMap>
+BenchmarkResult DisplaySystem<Storage, Index, SeatMap>::measureUnsortedManifestTime(const BenchmarkConfig& config) const {
+    if (this->size() == 0) return BenchmarkResult();
+    
+    NullStream sink;
+    return runBenchmark([&]() {
+        writePassengerManifest(sink, false);
+    }, config);
 }
 
-size_t ArrayDisplaySystem::calculateMemoryUsage() const {
-    size_t memory = 0;
-    // 1. 1D Array storage
-    memory += sizeof(Passenger) * capacity;
-    
-    // 2. 2D Grid pointers
-    memory += sizeof(Passenger***) + sizeof(Passenger**) * totalRows;
-    for (int i = 0; i < totalRows; i++) {
-        memory += sizeof(Passenger*) * seatsPerRow;
-    }
-    
-    // 3. Sorted array storage
-    if (sortedByID) {
-        memory += sizeof(Passenger) * capacity;
-    }
-    
-    return memory;
+// Copy, sort by seat and format every passenger to a null sink
+template <class Storage, class Index, class SeatMap>
+BenchmarkResult DisplaySystem<Storage, Index, SeatMap>::measureSortedManifestTime(const BenchmarkConfig& config) const {
+    if (this->size() == 0) return BenchmarkResult();
+    
+    NullStream sink;
+    return runBenchmark([&]() {
+        writePassengerManifest(sink, true);
+    }, config);
 }
 
-// ==================== LINKED LIST DISPLAY SYSTEM ====================
-// Uses Linked List for storage + Hash Maps for O(1) lookups
-LinkedListDisplaySystem::LinkedListDisplaySystem(int rows, int seats) 
-    : head(nullptr), passengerCount(0), totalRows(rows), seatsPerRow(seats) {}
-
-LinkedListDisplaySystem::~LinkedListDisplaySystem() {
-    ListNode* current = head;
-    while (current) {
-        ListNode* next = current->next;
-        delete current;
-        current = next;
-    }
+// The whole seat-order manifest streamed to a null sink (no copy, no sort)
+template <class Storage, class Index, class SeatMap>
+BenchmarkResult DisplaySystem<Storage, Index, SeatMap>::measureManifestExportTime(const BenchmarkConfig& config) const {
+    if (this->size() == 0) return BenchmarkResult();
+    
+    NullStream sink;
+    ManifestStream stream(sink);
+    return runBenchmark([&]() {
+        stream.writeHeader(occupancy.countReserved());
+        exportManifest(stream);
+        stream.flush();
+    }, config);
 }
 
-void LinkedListDisplaySystem::loadPassengersFromArray(const Passenger* passengers, int count) {
-    // Clear list
-    ListNode* current = head;
-    while (current) {
-        ListNode* next = current->next;
-        delete current;
-        current = next;
-    }
-    head = nullptr;
-    passengerCount = 0;
-    
-    // Clear lookup maps
-    seatMap.clear();
-    idMap.clear();
-    
-    // Build list in reverse (so inserting at head maintains order)
-    for (int i = count - 1; i >= 0; i--) {
-        if (passengers[i].isEmpty) continue;
-        
-        ListNode* newNode = new ListNode(passengers[i], head);
-        head = newNode;
-        passengerCount++;
-        
-        // Populate hash maps
-        std::string seatKey = std::to_string(passengers[i].seatRow) + passengers[i].seatColumn;
-        seatMap.insert(seatKey, &newNode->data);
-        idMap.insert(passengers[i].passengerID, &newNode->data);
-    }
+// Pages of `pageSize` rows from cursors spread over the aircraft; per page
+template <class Storage, class Index, class SeatMap>
+BenchmarkResult DisplaySystem<Storage, Index, SeatMap>::measureManifestPageTime(int pageSize,
+                                                                                const BenchmarkConfig& config) const {
+    if (this->size() == 0) return BenchmarkResult();
+    
+    const int CURSORS = 64;
+    int cursors[CURSORS];
+    int seats = getTotalSeats();
+    for (int i = 0; i < CURSORS; i++) cursors[i] = (int)((long)i * seats / CURSORS);
+    
+    NullStream sink;
+    ManifestStream stream(sink);
+    int next = 0;
+    return runBenchmark([&]() {
+        doNotOptimize(exportManifest(stream, cursors[next], pageSize));
+        stream.flush();
+        next = (next + 1) % CURSORS;
+    }, config);
 }
 
-// O(N) traversal search
-Passenger* LinkedListDisplaySystem::linearSearchByID(const std::string& passengerID) const {
-    ListNode* current = head;
-    while (current) {
-        if (current->data.passengerID == passengerID && !current->data.isEmpty) {
-            return &current->data;
+// Every query once per call; per query
+template <class Storage, class Index, class SeatMap>
+BenchmarkResult DisplaySystem<Storage, Index, SeatMap>::measureSeatQueryTime(const SeatQuery* queries, int count,
+                                                                             const BenchmarkConfig& config) const {
+    QueryResult result;
+    return runBenchmarkWithSetup([]() {}, [&]() {
+        for (int i = 0; i < count; i++) {
+            runSeatQuery(queries[i], result);
+            doNotOptimize(result.getTotal());
         }
-        current = current->next;
-    }
-    return nullptr;
+    }, count, config);
 }
 
-// O(1) average case search via Hash Map
-Passenger* LinkedListDisplaySystem::hashSearchByID(const std::string& passengerID) const {
-    return idMap.find(passengerID);
+template <class Storage, class Index, class SeatMap>
+BenchmarkResult DisplaySystem<Storage, Index, SeatMap>::measureColumnBuildTime(const BenchmarkConfig& config) const {
+    SeatColumns columns;
+    return runBenchmark([&]() {
+        buildSeatColumns(columns);
+        doNotOptimize(columns.getSeatCount());
+    }, config);
 }
 
-void LinkedListDisplaySystem::sortBySeatCommon() {
-    if (!head || passengerCount <= 0) return;
-    
-    // Must copy to array to sort efficiently
-    Passenger* tempArray = new Passenger[passengerCount];
-    ListNode* current = head;
-    int index = 0;
-    
-    while (current) {
-        if (!current->data.isEmpty) {
-            tempArray[index++] = current->data;
-        }
-        current = current->next;
-    }
-    
-    mergeSort(tempArray, 0, index - 1, false);
-    
-    delete[] tempArray;
+// Copy and sort by seat, no output
+template <class Storage, class Index, class SeatMap>
+BenchmarkResult DisplaySystem<Storage, Index, SeatMap>::measureSortingTime(const BenchmarkConfig& config) const {
+    if (this->size() == 0) return BenchmarkResult();
+    
+    return runBenchmark([&]() {
+        int sortedCount = 0;
+        Passenger* sortedList = copyPassengers(&sortedCount);
+        if (sortedCount > 1) mergeSort(sortedList, 0, sortedCount - 1, false);
+        doNotOptimize(sortedList[0]);
+        delete[] sortedList;
+    }, config);
 }
 
-void LinkedListDisplaySystem::displaySeatingChart() const {
-    if (!head) {
-        std::cout << "No passengers in the system.\n";
-        return;
-    }
-    
-    // 1. Determine grid dimensions by traversing list
-    int maxRow = 0;
-    int maxCol = 0;
-    
-    ListNode* current = head;
-    while (current) {
-        if (current->data.seatRow > maxRow) maxRow = current->data.seatRow;
-        int colIndex = current->data.seatColumn - 'A';
-        if (colIndex > maxCol) maxCol = colIndex;
-        current = current->next;
-    }
-    
-    int displayRows = std::min(maxRow + 5, totalRows);
-    int displayCols = std::min(maxCol + 3, seatsPerRow);
-    
-    // 2. Allocate temp 2D grid (overhead for linked list approach)
-    Passenger*** tempGrid = new Passenger**[displayRows];
-    for (int i = 0; i < displayRows; i++) {
-        tempGrid[i] = new Passenger*[displayCols];
-        for (int j = 0; j < displayCols; j++) {
-            tempGrid[i][j] = nullptr;
-        }
-    }
-    
-    // 3. Map list nodes to temp grid
-    current = head;
-    while (current) {
-        int rowIndex = current->data.seatRow - 1;
-        int colIndex = current->data.seatColumn - 'A';
-        
-        if (rowIndex >= 0 && rowIndex < displayRows && 
-            colIndex >= 0 && colIndex < displayCols) {
-            tempGrid[rowIndex][colIndex] = &current->data;
-        }
-        current = current->next;
-    }
-    
-    // 4. Render Grid
-    std::cout << "SEATING CHART (" << COLOR_RED << "X" << COLOR_RESET << " = Reserved, " 
-              << COLOR_GREEN << "O" << COLOR_RESET << " = Available)\n";
-    std::cout << "===============================================\n\n";
-    
-    std::cout << "     ";
-    for (int col = 0; col < displayCols; col++) {
-        std::cout << char('A' + col) << " ";
-    }
-    std::cout << "\n";
-    
-    for (int row = 0; row < displayRows; row++) {
-        std::cout << std::setw(3) << (row + 1) << ": ";
-        
-        for (int col = 0; col < displayCols; col++) {
-            Passenger* passenger = tempGrid[row][col];
-            
-            if (passenger == nullptr || passenger->isEmpty) {
-                std::cout << COLOR_GREEN << "O " << COLOR_RESET;
-            } else {
-                std::cout << COLOR_RED << "X " << COLOR_RESET;
-            }
-        }
-        std::cout << "\n";
-    }
+// Formatting of the sorted manifest only (the sort happens once, untimed)
+template <class Storage, class Index, class SeatMap>
+BenchmarkResult DisplaySystem<Storage, Index, SeatMap>::measureDisplayOnlyTime(const BenchmarkConfig& config) const {
+    if (this->size() == 0) return BenchmarkResult();
     
-    // 5. Cleanup temp grid
-    for (int i = 0; i < displayRows; i++) {
-        delete[] tempGrid[i];
-    }
-    delete[] tempGrid;
-    
-    std::cout << "\nSEAT STATISTICS:\n";
-    std::cout << "Total Passengers: " << passengerCount << "\n";
-    std::cout << "Total Seats: " << totalRows * seatsPerRow << "\n";
+    int sortedCount = 0;
+    Passenger* sortedList = copyPassengers(&sortedCount);
+    if (sortedCount > 1) mergeSort(sortedList, 0, sortedCount - 1, false);
     
-    std::cout << "\nLEGEND:\n";
-    std::cout << COLOR_RED << "X" << COLOR_RESET << " - Reserved Seat\n";
-    std::cout << COLOR_GREEN << "O" << COLOR_RESET << " - Available Seat\n";
+    NullStream sink;
+    BenchmarkResult result = runBenchmark([&]() {
+        writeManifestRows(sink, sortedList, sortedCount, true, 0);
+    }, config);
+    delete[] sortedList;
+    return result;
 }
 
-void LinkedListDisplaySystem::displayPassengerManifest() const {
-    if (!head) {
-        std::cout << "No passengers in the manifest.\n";
-        return;
-    }
-    
-    int nonEmptyCount = 0;
-    ListNode* current = head;
-    while (current) {
-        if (!current->data.isEmpty) nonEmptyCount++;
-        current = current->next;
-    }
+// The first `count` IDs in storage order (all of them if there are fewer)
+template <class Storage, class Index, class SeatMap>
+char** DisplaySystem<Storage, Index, SeatMap>::getTestIDs(int count, int* actualCount) const {
+    *actualCount = 0;
+    if (this->size() == 0 || count <= 0) return nullptr;
     
-    if (nonEmptyCount == 0) {
-        std::cout << "No passengers in the manifest.\n";
-        return;
+    int n = count < this->size() ? count : this->size();
+    char** testIDs = new char*[n];
+    for (auto it = this->storage.begin(); it != this->storage.end() && *actualCount < n; ++it) {
+        testIDs[*actualCount] = new char[it->passengerID.length() + 1];
+        strcpy(testIDs[*actualCount], it->passengerID.c_str());
+        (*actualCount)++;
     }
+    return testIDs;
+}
+
+template <class Storage, class Index, class SeatMap>
+std::string DisplaySystem<Storage, Index, SeatMap>::getMiddleID() const {
+    if (this->size() == 0) return std::string();
+    auto it = this->storage.begin();
+    for (int i = 0; i < this->size() / 2; i++) ++it;
+    return it->passengerID;
+}
+
+// Records, string buffers, seat map, ID index and seat bitmap
+template <class Storage, class Index, class SeatMap>
+size_t DisplaySystem<Storage, Index, SeatMap>::calculateMemoryUsage() const {
+    return this->memoryUsage();
+}
+
+// The two systems compared by the display menus
+template class DisplaySystem<ArrayStorage, NoIndex, PositionSeatMap>;
+template class DisplaySystem<ListStorage, HashIndex, PointerSeatMap>;
+
+// ==================== ARRAY DISPLAY SYSTEM ====================
+
+ArrayDisplaySystem::ArrayDisplaySystem(int rows, int seats)
+    : DisplaySystem<ArrayStorage, NoIndex, PositionSeatMap>(rows, seats), sortedByID(nullptr), sortedCount(0) {}
+
+ArrayDisplaySystem::~ArrayDisplaySystem() {
+    delete[] sortedByID;
+}
+
+void ArrayDisplaySystem::loadPassengersFromArray(const Passenger* passengers, int count) {
+    delete[] sortedByID;
+    sortedByID = nullptr;
+    sortedCount = 0;
+    DisplaySystem<ArrayStorage, NoIndex, PositionSeatMap>::loadPassengersFromArray(passengers, count);
+}
+
+// Prepares the sorted copy for binary search (once per load)
+void ArrayDisplaySystem::sortByPassengerID() {
+    if (sortedByID) return;
+    TRACE_SPAN("sort", "ArrayDisplaySystem::sortByPassengerID");
+    HeapScope scope(heap);
     
-    // Convert List to Array -> Sort -> Display
-    Passenger* tempArray = new Passenger[nonEmptyCount];
-    current = head;
-    int index = 0;
-    
-    while (current && index < nonEmptyCount) {
-        if (!current->data.isEmpty) {
-            tempArray[index++] = current->data;
-        }
-        current = current->next;
-    }
+    sortedCount = size();
+    sortedByID = new Passenger[sortedCount > 0 ? sortedCount : 1];
+    for (int i = 0; i < sortedCount; i++) sortedByID[i] = storage.at(i);
+    mergeSort(sortedByID, 0, sortedCount - 1, true); // Sort by ID
+}
+
+// O(log N) search (requires sorting first)
+Passenger* ArrayDisplaySystem::binarySearchByID(const std::string& passengerID) {
+    sortByPassengerID();
+    return findSortedByID(passengerID);
+}
+
+// Standard Binary Search over the sorted copy
+Passenger* ArrayDisplaySystem::findSortedByID(const std::string& passengerID) const {
+    int low = 0;
+    int high = sortedCount - 1;
     
-    mergeSort(tempArray, 0, nonEmptyCount - 1, false);
-    
-    std::cout << "PASSENGER MANIFEST (Sorted by Seat)\n";
-    std::cout << "====================================\n";
-    std::cout << "Total Passengers: " << nonEmptyCount << "\n\n";
-    
-    std::cout << std::left << std::setw(10) << "Seat" 
-              << std::setw(15) << "Passenger ID" 
-              << std::setw(25) << "Name" 
-              << std::setw(12) << "Class" 
-              << "\n";
-    std::cout << std::string(62, '-') << "\n";
-    
-    int count = 0;
-    for (int i = 0; i < nonEmptyCount; i++) {
-        std::string seat = std::to_string(tempArray[i].seatRow) + tempArray[i].seatColumn;
-        std::cout << std::left << std::setw(10) << seat
-                  << std::setw(15) << tempArray[i].passengerID
-                  << std::setw(25) << tempArray[i].name
-                  << std::setw(12) << tempArray[i].seatClass
-                  << "\n";
-        count++;
+    while (low <= high) {
+        int mid = low + (high - low) / 2;
+        int cmp = passengerID.compare(sortedByID[mid].passengerID);
         
-        if (count >= 50 && nonEmptyCount > 50) {
-            std::cout << "... and " << (nonEmptyCount - 50) << " more passengers\n";
-            break;
+        if (cmp == 0) {
+            return &sortedByID[mid];
+        } else if (cmp < 0) {
+            high = mid - 1;
+        } else {
+            low = mid + 1;
         }
     }
-    
-    delete[] tempArray;
+    return nullptr;
 }
 
-// --- Measurement Functions ---
-double LinkedListDisplaySystem::measureLinearSearchTime(const std::string& id) const {
-    auto start = std::chrono::high_resolution_clock::now();
-    linearSearchByID(id);
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    return duration.count() * 1000000;
+void ArrayDisplaySystem::batchBinarySearchByID(const std::string* ids, int count, Passenger** results,
+                                               WorkStealingPool* pool) {
+    TRACE_SPAN("search", "ArrayDisplaySystem::batchBinarySearchByID");
+    // Sorting mutates the instance, so it happens here, before the threads read
+    sortByPassengerID();
+    auto body = [&](long begin, long end) {
+        for (long i = begin; i < end; i++) results[i] = findSortedByID(ids[i]);
+    };
+    parallelForOrSerial(pool, count, BATCH_SEARCH_GRAIN, body);
 }
 
-double LinkedListDisplaySystem::measureHashSearchTime(const std::string& id) const {
-    auto start = std::chrono::high_resolution_clock::now();
-    hashSearchByID(id);
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    return duration.count() * 1000000;
+BenchmarkResult ArrayDisplaySystem::measureBinarySearchTime(const std::string& id, const BenchmarkConfig& config) {
+    TRACE_SPAN("search", "ArrayDisplaySystem::measureBinarySearchTime");
+    sortByPassengerID(); // One-time preparation stays outside the timed region
+    return runBenchmark([&]() {
+        doNotOptimize(binarySearchByID(id));
+    }, config);
 }
 
-double LinkedListDisplaySystem::measureSeatingChartTime() const {
-    auto start = std::chrono::high_resolution_clock::now();
-    
-    if (!head) return 0.0;
-    
-    // Simulate list traversal (expensive compared to Array Grid)
-    ListNode* current = head;
-    int count = 0;
-    while (current && count < 1000) {
-        count++;
-        current = current->next;
-    }
-    
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    return duration.count() * 1000000;
+// ==================== LINKED LIST DISPLAY SYSTEM ====================
+
+LinkedListDisplaySystem::LinkedListDisplaySystem(int rows, int seats)
+    : DisplaySystem<ListStorage, HashIndex, PointerSeatMap>(rows, seats) {}
+
+// O(1) average case search via the hash index
+Passenger* LinkedListDisplaySystem::hashSearchByID(const std::string& passengerID) const {
+    return findByID(passengerID);
 }
 
-double LinkedListDisplaySystem::measureUnsortedManifestTime() const {
-    auto start = std::chrono::high_resolution_clock::now();
-    
-    if (!head) return 0.0;
-    
-    int nonEmptyCount = 0;
-    ListNode* current = head;
-    while (current) {
-        if (!current->data.isEmpty) nonEmptyCount++;
-        current = current->next;
-    }
-    
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    return duration.count() * 1000000;
+void LinkedListDisplaySystem::hashSearchGroup(const std::string* ids, int count, Passenger** results) const {
+    index.findBatch(ids, count, results);
 }
 
-double LinkedListDisplaySystem::measureSortedManifestTime() const {
-    return measureSortingTime();
+void LinkedListDisplaySystem::batchHashSearchByID(const std::string* ids, int count, Passenger** results,
+                                                  WorkStealingPool* pool) const {
+    TRACE_SPAN("search", "LinkedListDisplaySystem::batchHashSearchByID");
+    auto body = [&](long begin, long end) {
+        hashSearchGroup(ids + begin, (int)(end - begin), results + begin);
+    };
+    parallelForOrSerial(pool, count, BATCH_SEARCH_GRAIN, body);
 }
 
-double LinkedListDisplaySystem::measureSortingTime() const {
-    auto start = std::chrono::high_resolution_clock::now();
-    
-    if (!head) return 0.0;
-    
-    // Count
-    int nonEmptyCount = 0;
-    ListNode* current = head;
-    while (current) {
-        if (!current->data.isEmpty) nonEmptyCount++;
-        current = current->next;
-    }
-    
-    if (nonEmptyCount == 0) return 0.0;
-    
-    // Copy to Array
-    Passenger* tempArray = new Passenger[nonEmptyCount];
-    current = head;
-    int index = 0;
-    
-    while (current && index < nonEmptyCount) {
-        if (!current->data.isEmpty) {
-            tempArray[index++] = current->data;
-        }
-        current = current->next;
-    }
-    
-    // Sort
-    mergeSort(tempArray, 0, nonEmptyCount - 1, false);
-    
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    
-    delete[] tempArray;
-    return duration.count() * 1000000;
+BenchmarkResult LinkedListDisplaySystem::measureHashSearchTime(const std::string& id, const BenchmarkConfig& config) const {
+    TRACE_SPAN("search", "LinkedListDisplaySystem::measureHashSearchTime");
+    return runBenchmark([&]() {
+        doNotOptimize(hashSearchByID(id));
+    }, config);
 }
 
-double LinkedListDisplaySystem::measureDisplayOnlyTime() const {
-    auto start = std::chrono::high_resolution_clock::now();
-    
-    if (!head) return 0.0;
-    
-    ListNode* current = head;
-    while (current) {
-        if (!current->data.isEmpty) {
-            std::string seat = std::to_string(current->data.seatRow) + current->data.seatColumn;
-            std::string dummy = seat + current->data.passengerID + current->data.name + current->data.seatClass;
-        }
-        current = current->next;
-    }
-    
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    return duration.count() * 1000000;
+// ==================== OUTPUT VERIFICATION ====================
+
+template <class System>
+static std::string builtChartText(const System& sys) {
+    SeatOccupancy seats(sys.getMaxRows(), sys.getMaxSeatsPerRow());
+    sys.buildSeatingChart(seats);
+    SeatChartRenderer renderer(sys.getMaxRows(), sys.getMaxSeatsPerRow());
+    renderer.setColorEnabled(false);
+    renderSeatingChart(renderer, seats);
+    return std::string(renderer.data(), renderer.size());
 }
 
-// Generate Test IDs
-char** LinkedListDisplaySystem::getTestIDs(int count, int* actualCount) const {
-    char** testIDs = nullptr;
-    *actualCount = 0;
-    
-    if (passengerCount == 0 || count <= 0) return testIDs;
-    
-    int nonEmptyCount = 0;
-    ListNode* current = head;
-    while (current) {
-        if (!current->data.isEmpty) nonEmptyCount++;
-        current = current->next;
-    }
-    
-    if (nonEmptyCount <= count) {
-        testIDs = new char*[nonEmptyCount];
-        *actualCount = nonEmptyCount;
-        current = head;
-        int index = 0;
-        while (current && index < nonEmptyCount) {
-            if (!current->data.isEmpty) {
-                testIDs[index] = new char[current->data.passengerID.length() + 1];
-                strcpy(testIDs[index], current->data.passengerID.c_str());
-                index++;
-            }
-            current = current->next;
-        }
-        return testIDs;
-    }
-    
-    // Subset
-    testIDs = new char*[count];
-    *actualCount = count;
-    current = head;
-    int selected = 0;
-    
-    while (current && selected < count) {
-        if (!current->data.isEmpty) {
-            testIDs[selected] = new char[current->data.passengerID.length() + 1];
-            strcpy(testIDs[selected], current->data.passengerID.c_str());
-            selected++;
-        }
-        current = current->next;
-    }
-    
-    return testIDs;
+template <class System>
+static std::string chartText(const System& sys) {
+    std::ostringstream out;
+    sys.writeSeatingChart(out);
+    return out.str();
 }
 
-size_t LinkedListDisplaySystem::calculateMemoryUsage() const {
-    size_t memory = 0;
-    
-    // 1. Linked List Nodes
-    ListNode* current = head;
-    while (current) {
-        memory += sizeof(ListNode);
-        current = current->next;
+template <class System>
+static std::string manifestText(const System& sys, bool sortBySeat) {
+    std::ostringstream out;
+    sys.writePassengerManifest(out, sortBySeat);
+    return out.str();
+}
+
+template <class System>
+static std::string exportText(const System& sys) {
+    std::ostringstream out;
+    {
+        ManifestStream stream(out);
+        stream.writeHeader(sys.getOccupancy().countReserved());
+        sys.exportManifest(stream);
+    }
+    return out.str();
+}
+
+static bool checkOutput(const char* label, const std::string& arrayOut, const std::string& llOut,
+                        std::ostream& report) {
+    report << "  " << std::left << std::setw(18) << label;
+    if (arrayOut == llOut) {
+        report << "identical (" << arrayOut.size() << " bytes)\n";
+        return true;
+    }
+    size_t at = 0;
+    while (at < arrayOut.size() && at < llOut.size() && arrayOut[at] == llOut[at]) at++;
+    report << "MISMATCH (array " << arrayOut.size() << " bytes, linked list " << llOut.size()
+           << " bytes, first difference at byte " << at << ")\n";
+    return false;
+}
+
+int verifyDisplayOutputs(const ArrayDisplaySystem& arraySys, const LinkedListDisplaySystem& llSys,
+                         std::ostream& report) {
+    TRACE_SPAN("bench", "verifyDisplayOutputs");
+    int mismatches = 0;
+    report << "Output check (array vs linked list, full output):\n";
+    if (!checkOutput("Chart build", builtChartText(arraySys), builtChartText(llSys), report)) mismatches++;
+    if (!checkOutput("Chart render", chartText(arraySys), chartText(llSys), report)) mismatches++;
+    if (!checkOutput("Unsorted manifest", manifestText(arraySys, false), manifestText(llSys, false), report)) mismatches++;
+    std::string sortedManifest = manifestText(arraySys, true);
+    if (!checkOutput("Sorted manifest", sortedManifest, manifestText(llSys, true), report)) mismatches++;
+    std::string arrayExport = exportText(arraySys);
+    if (!checkOutput("Manifest export", arrayExport, exportText(llSys), report)) mismatches++;
+    // The export leaves out passengers who share a seat or sit outside the
+    // layout, so a difference from the sorted copy is reported, not counted
+    report << "  Export vs sorted  "
+           << (arrayExport == sortedManifest ? "identical" : "differ (shared or off-layout seats)") << "\n";
+    return mismatches;
+}
+
+int verifySeatQueries(const ArrayDisplaySystem& arraySys, const LinkedListDisplaySystem& llSys,
+                      std::ostream& report) {
+    TRACE_SPAN("bench", "verifySeatQueries");
+    SeatQuery queries[STANDARD_QUERY_COUNT];
+    standardSeatQueries(queries);
+    SeatColumns arrayColumns;
+    SeatColumns llColumns;
+    arraySys.buildSeatColumns(arrayColumns);
+    llSys.buildSeatColumns(llColumns);
+    
+    int mismatches = 0;
+    report << "Query check (array scan, list scan, columns from each):\n";
+    for (int i = 0; i < STANDARD_QUERY_COUNT; i++) {
+        QueryResult arrayScan, llScan, arrayCols, llCols;
+        arraySys.runSeatQuery(queries[i], arrayScan);
+        llSys.runSeatQuery(queries[i], llScan);
+        arrayColumns.run(queries[i], arrayCols);
+        llColumns.run(queries[i], llCols);
+        
+        report << "  " << std::left << std::setw(38) << queries[i].label << std::right;
+        if (arrayScan.sameAs(llScan) && arrayScan.sameAs(arrayCols) && arrayScan.sameAs(llCols)) {
+            report << "identical (" << arrayScan.getTotal() << " seats)\n";
+        } else {
+            report << "MISMATCH (array " << arrayScan.getTotal() << ", list " << llScan.getTotal()
+                   << ", columns " << arrayCols.getTotal() << " / " << llCols.getTotal() << ")\n";
+            mismatches++;
+        }
     }
-    
-    // 2. Hash Maps (Seat + ID maps)
-    memory += sizeof(SimpleHashMap) * 2;
-    
-    return memory;
+    return mismatches;
 }
 
 // ==================== PERFORMANCE COMPARATOR ====================
@@ -1105,244 +940,348 @@ size_t LinkedListDisplaySystem::calculateMemoryUsage() const {
 // Formats comparison rows for time data
 void PerformanceComparator::printTableRow(const std::string& label, double arrayVal, double llVal, const std::string& unit) {
     std::cout << "| " << std::left << std::setw(30) << label 
-              << " | " << std::right << std::setw(15) << std::fixed << std::setprecision(2) << arrayVal 
+              << " | " << std::right << std::setw(12) << std::fixed << std::setprecision(2) << arrayVal 
               << " " << unit
               << " | " << std::right << std::setw(15) << llVal 
               << " " << unit << " |\n";
 }
 
+// Distribution rows from the benchmark harness (all in nanoseconds)
+void PerformanceComparator::printTimingRows(const std::string& label, const BenchmarkResult& arrayRes, const BenchmarkResult& llRes) {
+    printTableRow(label + " (median)", arrayRes.medianNs, llRes.medianNs);
+    printTableRow(label + " (min)", arrayRes.minNs, llRes.minNs);
+    printTableRow(label + " (p90)", arrayRes.p90Ns, llRes.p90Ns);
+    printTableRow(label + " (p99)", arrayRes.p99Ns, llRes.p99Ns);
+    printTableRow(label + " (mean)", arrayRes.meanNs, llRes.meanNs);
+    printTableRow(label + " (stddev)", arrayRes.stddevNs, llRes.stddevNs);
+}
+
 // Formats comparison rows for memory data
 void PerformanceComparator::printMemoryRow(const std::string& label, size_t arrayVal, size_t llVal, bool inKB) {
     if (inKB) {
         std::cout << "| " << std::left << std::setw(30) << label 
                   << " | " << std::right << std::setw(15) << std::fixed << std::setprecision(2) << (arrayVal / 1024.0)
-                  << " | " << std::right << std::setw(15) << (llVal / 1024.0) << " |\n";
+                  << " | " << std::right << std::setw(18) << (llVal / 1024.0) << " |\n";
     } else {
         std::cout << "| " << std::left << std::setw(30) << label 
                   << " | " << std::right << std::setw(15) << arrayVal 
-                  << " | " << std::right << std::setw(15) << llVal << " |\n";
+                  << " | " << std::right << std::setw(18) << llVal << " |\n";
     }
 }
 
-// Benchmark: Seating Chart Construction (Array Grid vs Linked List Traversal)
-void PerformanceComparator::compareSeatingChart(const ArrayDisplaySystem& arraySys, 
-                                               const LinkedListDisplaySystem& llSys) {
-    std::cout << "PERFORMANCE COMPARISON: SEATING CHART DISPLAY\n";
-    std::cout << "==============================================\n\n";
-    
-    std::cout << "Testing with " << arraySys.getPassengerCount() << " passengers\n\n";
-    
-    double arrayTime = arraySys.measureSeatingChartTime();
-    double llTime = llSys.measureSeatingChartTime();
-    size_t arrayMem = arraySys.calculateMemoryUsage();
-    size_t llMem = llSys.calculateMemoryUsage();
-    
+// Live heap detail from the instrumented allocator
+void PerformanceComparator::printHeapRows(const HeapStats& arrayHeap, const HeapStats& llHeap) {
+    printMemoryRow("Heap Requested (bytes)", arrayHeap.liveBytes, llHeap.liveBytes);
+    printMemoryRow("Live Allocations", arrayHeap.liveBlocks, llHeap.liveBlocks);
+    printMemoryRow("Peak Heap (bytes)", arrayHeap.peakBytes, llHeap.peakBytes);
+}
+
+// Per-operation hardware counter rows; "n/a" where a counter could not be read
+static void printCounterValue(const PerfCounterValues& values, int kind, int width) {
+    if (kind == PERF_COUNTER_COUNT) {
+        double ipc = values.ipc();
+        if (ipc >= 0.0) std::cout << std::setw(width) << std::setprecision(2) << ipc;
+        else std::cout << std::setw(width) << "n/a";
+    } else if (values.valid[kind]) {
+        std::cout << std::setw(width) << std::setprecision(1) << values.value[kind];
+    } else {
+        std::cout << std::setw(width) << "n/a";
+    }
+}
+
+void PerformanceComparator::printCounterRows(const std::string& label, const BenchmarkResult& arrayRes, const BenchmarkResult& llRes) {
+    const PerfCounterValues& a = arrayRes.counters;
+    const PerfCounterValues& b = llRes.counters;
+
+    // Collapse to one row when neither side has counters (e.g. no PMU access)
+    if (!a.any() && !b.any()) {
+        std::cout << "| " << std::left << std::setw(30) << (label + " HW counters")
+                  << " | " << std::right << std::setw(15) << "n/a"
+                  << " | " << std::right << std::setw(18) << "n/a" << " |\n";
+        return;
+    }
+
+    // PERF_COUNTER_COUNT doubles as the IPC row
+    const int order[] = { PERF_CYCLES, PERF_INSTRUCTIONS, PERF_COUNTER_COUNT, PERF_L1D_MISSES,
+                          PERF_LLC_MISSES, PERF_BRANCH_MISSES, PERF_DTLB_MISSES };
+    for (int i = 0; i < (int)(sizeof(order) / sizeof(order[0])); i++) {
+        int kind = order[i];
+        std::string name = (kind == PERF_COUNTER_COUNT) ? "IPC" : std::string(perfCounterName((PerfCounterKind)kind)) + "/op";
+        std::cout << "| " << std::left << std::setw(30) << (label + " " + name) << " | " << std::right << std::fixed;
+        printCounterValue(a, kind, 15);
+        std::cout << " | ";
+        printCounterValue(b, kind, 18);
+        std::cout << " |\n";
+    }
+}
+
+// Harness settings for the comparison tables: counters on where supported
+static BenchmarkConfig comparisonConfig() {
+    BenchmarkConfig config;
+    config.collectCounters = true;
+    return config;
+}
+
+// Explains missing counter rows once per table
+static void printCounterFootnote() {
+    std::string status = perfCountersStatus();
+    if (!status.empty()) {
+        std::cout << "Hardware counters unavailable: " << status << "\n";
+    }
+}
+
+// Shared header for the side-by-side tables
+static void printComparisonHeader() {
     std::cout << std::string(73, '=') << "\n";
     std::cout << "| " << std::left << std::setw(30) << "METRIC" 
               << " | " << std::left << std::setw(15) << "ARRAY SYSTEM"
               << " | " << std::left << std::setw(15) << "LINKED LIST SYSTEM" << " |\n";
     std::cout << std::string(73, '=') << "\n";
-    
-    std::cout << "| " << std::left << std::setw(30) << "Time" 
-              << " | " << std::right << std::setw(12) << std::fixed << std::setprecision(2) << arrayTime 
-              << " us"
-              << " | " << std::right << std::setw(15) << llTime << " us" << " |\n";
-    
-    std::cout << std::string(73, '-') << "\n";
-    
-    std::cout << "| " << std::left << std::setw(30) << "Total Memory (bytes)" 
-              << " | " << std::right << std::setw(15) << arrayMem 
-              << " | " << std::right << std::setw(18) << llMem << " |\n";
-    
-    std::cout << "| " << std::left << std::setw(30) << "Memory (KB)" 
-              << " | " << std::right << std::setw(15) << std::fixed << std::setprecision(2) << (arrayMem / 1024.0)
-              << " | " << std::right << std::setw(18) << (llMem / 1024.0) << " |\n";
-    
+}
+
+// Shared memory section for the side-by-side tables
+static void printMemorySection(const ArrayDisplaySystem& arraySys, const LinkedListDisplaySystem& llSys) {
+    size_t arrayMem = arraySys.calculateMemoryUsage();
+    size_t llMem = llSys.calculateMemoryUsage();
     int arrayPassengerCount = arraySys.getPassengerCount();
     int llPassengerCount = llSys.getPassengerCount();
     
-    std::cout << "| " << std::left << std::setw(30) << "Memory per Passenger" 
-              << " | " << std::right << std::setw(15) 
-              << (arrayPassengerCount > 0 ? arrayMem / arrayPassengerCount : 0)
-              << " | " << std::right << std::setw(18) 
-              << (llPassengerCount > 0 ? llMem / llPassengerCount : 0) << " |\n";
+    PerformanceComparator::printMemoryRow("Total Memory (bytes)", arrayMem, llMem);
+    PerformanceComparator::printMemoryRow("Memory (KB)", arrayMem, llMem, true);
+    PerformanceComparator::printMemoryRow("Memory per Passenger",
+                                          arrayPassengerCount > 0 ? arrayMem / arrayPassengerCount : 0,
+                                          llPassengerCount > 0 ? llMem / llPassengerCount : 0);
+    PerformanceComparator::printHeapRows(arraySys.heapStats(), llSys.heapStats());
+}
+
+// Benchmark: Seating Chart (seat states from storage, then the rendered chart)
+void PerformanceComparator::compareSeatingChart(const ArrayDisplaySystem& arraySys, 
+                                               const LinkedListDisplaySystem& llSys) {
+    TRACE_SPAN("bench", "compareSeatingChart");
+    std::cout << "PERFORMANCE COMPARISON: SEATING CHART DISPLAY\n";
+    std::cout << "==============================================\n\n";
     
+    std::cout << "Testing with " << arraySys.getPassengerCount() << " passengers\n";
+    std::cout << "Build: seat states from every grid cell / every list node\n";
+    std::cout << "Render: the displayed chart, written to a null sink\n";
+    std::cout << "Times in nanoseconds per operation (warmed up, repeated)\n\n";
+    
+    BenchmarkResult arrayBuild = arraySys.measureChartBuildTime(comparisonConfig());
+    BenchmarkResult llBuild = llSys.measureChartBuildTime(comparisonConfig());
+    BenchmarkResult arrayTime = arraySys.measureSeatingChartTime(comparisonConfig());
+    BenchmarkResult llTime = llSys.measureSeatingChartTime(comparisonConfig());
+    
+    printComparisonHeader();
+    printTimingRows("Build", arrayBuild, llBuild);
+    std::cout << std::string(73, '-') << "\n";
+    printTimingRows("Render", arrayTime, llTime);
+    std::cout << std::string(73, '-') << "\n";
+    printCounterRows("Build", arrayBuild, llBuild);
+    printCounterRows("Render", arrayTime, llTime);
+    std::cout << std::string(73, '-') << "\n";
+    printMemorySection(arraySys, llSys);
     std::cout << std::string(73, '=') << "\n";
+    printCounterFootnote();
+    std::cout << "\n";
+    verifyDisplayOutputs(arraySys, llSys, std::cout);
 }
 
 // Benchmark: Iterating through Unsorted data
 void PerformanceComparator::compareUnsortedManifest(const ArrayDisplaySystem& arraySys, 
                                                    const LinkedListDisplaySystem& llSys) {
+    TRACE_SPAN("bench", "compareUnsortedManifest");
     std::cout << "PERFORMANCE COMPARISON: UNSORTED MANIFEST DISPLAY\n";
     std::cout << "==================================================\n\n";
     
-    std::cout << "Testing with " << arraySys.getPassengerCount() << " passengers\n\n";
-    
-    double arrayTime = arraySys.measureUnsortedManifestTime();
-    double llTime = llSys.measureUnsortedManifestTime();
-    size_t arrayMem = arraySys.calculateMemoryUsage();
-    size_t llMem = llSys.calculateMemoryUsage();
-    
-    std::cout << std::string(73, '=') << "\n";
-    std::cout << "| " << std::left << std::setw(30) << "METRIC" 
-              << " | " << std::left << std::setw(15) << "ARRAY SYSTEM"
-              << " | " << std::left << std::setw(15) << "LINKED LIST SYSTEM" << " |\n";
-    std::cout << std::string(73, '=') << "\n";
+    std::cout << "Testing with " << arraySys.getPassengerCount() << " passengers\n";
+    std::cout << "Every passenger in storage order, formatted to a null sink\n";
+    std::cout << "Times in nanoseconds per operation (warmed up, repeated)\n\n";
     
-    std::cout << "| " << std::left << std::setw(30) << "Display Time" 
-              << " | " << std::right << std::setw(12) << std::fixed << std::setprecision(2) << arrayTime 
-              << " us"
-              << " | " << std::right << std::setw(15) << llTime << " us" << " |\n";
+    BenchmarkResult arrayTime = arraySys.measureUnsortedManifestTime(comparisonConfig());
+    BenchmarkResult llTime = llSys.measureUnsortedManifestTime(comparisonConfig());
     
+    printComparisonHeader();
+    printTimingRows("Display Time", arrayTime, llTime);
     std::cout << std::string(73, '-') << "\n";
-    
-    std::cout << "| " << std::left << std::setw(30) << "Total Memory (bytes)" 
-              << " | " << std::right << std::setw(15) << arrayMem 
-              << " | " << std::right << std::setw(18) << llMem << " |\n";
-    
-    std::cout << "| " << std::left << std::setw(30) << "Memory (KB)" 
-              << " | " << std::right << std::setw(15) << std::fixed << std::setprecision(2) << (arrayMem / 1024.0)
-              << " | " << std::right << std::setw(18) << (llMem / 1024.0) << " |\n";
-    
-    int arrayPassengerCount = arraySys.getPassengerCount();
-    int llPassengerCount = llSys.getPassengerCount();
-    
-    std::cout << "| " << std::left << std::setw(30) << "Memory per Passenger" 
-              << " | " << std::right << std::setw(15) 
-              << (arrayPassengerCount > 0 ? arrayMem / arrayPassengerCount : 0)
-              << " | " << std::right << std::setw(18) 
-              << (llPassengerCount > 0 ? llMem / llPassengerCount : 0) << " |\n";
-    
+    printCounterRows("Display", arrayTime, llTime);
+    std::cout << std::string(73, '-') << "\n";
+    printMemorySection(arraySys, llSys);
     std::cout << std::string(73, '=') << "\n";
+    printCounterFootnote();
+    std::cout << "\n";
+    verifyDisplayOutputs(arraySys, llSys, std::cout);
 }
 
 // Benchmark: Sorting + Displaying data
 void PerformanceComparator::compareSortedManifest(const ArrayDisplaySystem& arraySys, 
                                                  const LinkedListDisplaySystem& llSys) {
+    TRACE_SPAN("bench", "compareSortedManifest");
     std::cout << "PERFORMANCE COMPARISON: SORTED MANIFEST DISPLAY\n";
     std::cout << "================================================\n\n";
     
     std::cout << "Testing with " << arraySys.getPassengerCount() << " passengers\n";
-    std::cout << "Using merge sort algorithm\n\n";
+    std::cout << "Using merge sort algorithm\n";
+    std::cout << "Total: copy, sort and format every passenger to a null sink\n";
+    std::cout << "Times in nanoseconds per operation (warmed up, repeated)\n\n";
     
     // Decompose timing components
-    double arrayTotalTime = arraySys.measureSortedManifestTime();
-    double arraySortTime = arraySys.measureSortingTime();
-    double arrayDisplayTime = arraySys.measureDisplayOnlyTime();
-    
-    double llTotalTime = llSys.measureSortedManifestTime();
-    double llSortTime = llSys.measureSortingTime();
-    double llDisplayTime = llSys.measureDisplayOnlyTime();
-    
-    if (arrayDisplayTime < 0) arrayDisplayTime = 0;
-    if (llDisplayTime < 0) llDisplayTime = 0;
-    
-    size_t arrayMem = arraySys.calculateMemoryUsage();
-    size_t llMem = llSys.calculateMemoryUsage();
-    
-    std::cout << std::string(73, '=') << "\n";
-    std::cout << "| " << std::left << std::setw(30) << "METRIC" 
-              << " | " << std::left << std::setw(15) << "ARRAY SYSTEM"
-              << " | " << std::left << std::setw(15) << "LINKED LIST SYSTEM" << " |\n";
+    BenchmarkResult arrayTotalTime = arraySys.measureSortedManifestTime();
+    BenchmarkResult arraySortTime = arraySys.measureSortingTime(comparisonConfig());
+    BenchmarkResult arrayDisplayTime = arraySys.measureDisplayOnlyTime();
+    
+    BenchmarkResult llTotalTime = llSys.measureSortedManifestTime();
+    BenchmarkResult llSortTime = llSys.measureSortingTime(comparisonConfig());
+    BenchmarkResult llDisplayTime = llSys.measureDisplayOnlyTime();
+    
+    // Streaming export in seat order (no copy, no sort)
+    BenchmarkResult arrayExportTime = arraySys.measureManifestExportTime();
+    BenchmarkResult llExportTime = llSys.measureManifestExportTime();
+    BenchmarkResult arrayPageTime = arraySys.measureManifestPageTime(MANIFEST_DISPLAY_LIMIT);
+    BenchmarkResult llPageTime = llSys.measureManifestPageTime(MANIFEST_DISPLAY_LIMIT);
+    
+    printComparisonHeader();
+    printTimingRows("Total Time", arrayTotalTime, llTotalTime);
+    printTableRow("Sorting Time (median)", arraySortTime.medianNs, llSortTime.medianNs);
+    printTableRow("Display Time only (median)", arrayDisplayTime.medianNs, llDisplayTime.medianNs);
+    printTableRow("Streaming export (median)", arrayExportTime.medianNs, llExportTime.medianNs);
+    printTableRow("Export page of 50 (median)", arrayPageTime.medianNs, llPageTime.medianNs);
+    std::cout << std::string(73, '-') << "\n";
+    printCounterRows("Sort", arraySortTime, llSortTime);
+    std::cout << std::string(73, '-') << "\n";
+    printMemorySection(arraySys, llSys);
     std::cout << std::string(73, '=') << "\n";
+    printCounterFootnote();
+    std::cout << "\n";
+    verifyDisplayOutputs(arraySys, llSys, std::cout);
+}
+
+// Benchmark: Seat lookup by row and column (2D grid vs flat seat index)
+void PerformanceComparator::compareSeatLookup(const ArrayDisplaySystem& arraySys, 
+                                             const LinkedListDisplaySystem& llSys) {
+    TRACE_SPAN("bench", "compareSeatLookup");
+    std::cout << "PERFORMANCE COMPARISON: SEAT LOOKUP\n";
+    std::cout << "===================================\n\n";
     
-    std::cout << "| " << std::left << std::setw(30) << "Total Time" 
-              << " | " << std::right << std::setw(12) << std::fixed << std::setprecision(2) << arrayTotalTime 
-              << " us"
-              << " | " << std::right << std::setw(15) << llTotalTime << " us" << " |\n";
-    
-    std::cout << "| " << std::left << std::setw(30) << "Sorting Time" 
-              << " | " << std::right << std::setw(12) << arraySortTime 
-              << " us"
-              << " | " << std::right << std::setw(15) << llSortTime << " us" << " |\n";
+    std::cout << "Looking up all " << arraySys.getTotalSeats() << " seats by row and column\n";
+    std::cout << "Times in nanoseconds per lookup (warmed up, repeated)\n\n";
     
-    std::cout << "| " << std::left << std::setw(30) << "Display Time (only)" 
-              << " | " << std::right << std::setw(12) << arrayDisplayTime 
-              << " us"
-              << " | " << std::right << std::setw(15) << llDisplayTime << " us" << " |\n";
+    BenchmarkResult arrayTime = arraySys.measureSeatLookupTime(comparisonConfig());
+    BenchmarkResult llTime = llSys.measureSeatLookupTime(comparisonConfig());
     
+    printComparisonHeader();
+    printTimingRows("Lookup Time", arrayTime, llTime);
     std::cout << std::string(73, '-') << "\n";
+    printCounterRows("Lookup", arrayTime, llTime);
+    std::cout << std::string(73, '-') << "\n";
+    printMemorySection(arraySys, llSys);
+    std::cout << std::string(73, '=') << "\n";
+    printCounterFootnote();
+}
+
+// Benchmark: seat analytics as row scans vs vectorized passes over columns
+void PerformanceComparator::compareSeatQueries(const ArrayDisplaySystem& arraySys, 
+                                              const LinkedListDisplaySystem& llSys) {
+    TRACE_SPAN("bench", "compareSeatQueries");
+    std::cout << "PERFORMANCE COMPARISON: SEAT QUERIES\n";
+    std::cout << "===================================\n\n";
+    
+    SeatQuery queries[STANDARD_QUERY_COUNT];
+    standardSeatQueries(queries);
+    SeatColumns columns;
+    arraySys.buildSeatColumns(columns);
+    
+    for (int i = 0; i < STANDARD_QUERY_COUNT; i++) {
+        QueryResult result;
+        columns.run(queries[i], result);
+        std::cout << "Q" << (i + 1) << ". " << queries[i].label << "\n";
+        result.print(std::cout, 8);
+    }
+    
+    std::cout << "\nArray / Linked List: each structure reads every seat in range through\n"
+              << "its seat index. Columnar: one selection bitmask per filter over the\n"
+              << "seat columns, counted with popcount.\n";
+    std::cout << "Median nanoseconds per query (warmed up, repeated)\n\n";
     
-    std::cout << "| " << std::left << std::setw(30) << "Total Memory (bytes)" 
-              << " | " << std::right << std::setw(15) << arrayMem 
-              << " | " << std::right << std::setw(18) << llMem << " |\n";
-    
-    std::cout << "| " << std::left << std::setw(30) << "Memory (KB)" 
-              << " | " << std::right << std::setw(15) << std::fixed << std::setprecision(2) << (arrayMem / 1024.0)
-              << " | " << std::right << std::setw(18) << (llMem / 1024.0) << " |\n";
-    
-    int arrayPassengerCount = arraySys.getPassengerCount();
-    int llPassengerCount = llSys.getPassengerCount();
-    
-    std::cout << "| " << std::left << std::setw(30) << "Memory per Passenger" 
-              << " | " << std::right << std::setw(15) 
-              << (arrayPassengerCount > 0 ? arrayMem / arrayPassengerCount : 0)
-              << " | " << std::right << std::setw(18) 
-              << (llPassengerCount > 0 ? llMem / llPassengerCount : 0) << " |\n";
+    std::cout << std::string(73, '=') << "\n";
+    std::cout << "| " << std::left << std::setw(30) << "QUERY"
+              << " | " << std::right << std::setw(10) << "ARRAY"
+              << " | " << std::setw(11) << "LINKED LIST"
+              << " | " << std::setw(9) << "COLUMNAR" << " |\n";
+    std::cout << std::string(73, '-') << "\n";
+    for (int i = 0; i < STANDARD_QUERY_COUNT; i++) {
+        BenchmarkResult arrayTime = arraySys.measureSeatQueryTime(&queries[i], 1, comparisonConfig());
+        BenchmarkResult llTime = llSys.measureSeatQueryTime(&queries[i], 1, comparisonConfig());
+        BenchmarkResult columnTime = measureColumnarQueryTime(columns, &queries[i], 1, comparisonConfig());
+        std::cout << "| " << std::left << std::setw(30) << ("Q" + std::to_string(i + 1))
+                  << " | " << std::right << std::fixed << std::setprecision(1) << std::setw(10) << arrayTime.medianNs
+                  << " | " << std::setw(11) << llTime.medianNs
+                  << " | " << std::setw(9) << columnTime.medianNs << " |\n";
+    }
+    std::cout << std::string(73, '-') << "\n";
     
+    BenchmarkResult arrayBuild = arraySys.measureColumnBuildTime(comparisonConfig());
+    BenchmarkResult llBuild = llSys.measureColumnBuildTime(comparisonConfig());
+    printTableRow("Column Build (median)", arrayBuild.medianNs, llBuild.medianNs);
     std::cout << std::string(73, '=') << "\n";
+    std::cout << "Columns for " << columns.getSeatCount() << " seats: "
+              << columns.heapStats().liveBytes << " bytes of heap (same from either structure)\n\n";
+    verifySeatQueries(arraySys, llSys, std::cout);
 }
 
 // Summary Report: Aggregates all benchmarks
 void PerformanceComparator::compareAllOperations(const ArrayDisplaySystem& arraySys, 
                                                 const LinkedListDisplaySystem& llSys) {
+    TRACE_SPAN("bench", "compareAllOperations");
     std::cout << "COMPREHENSIVE PERFORMANCE COMPARISON: ALL OPERATIONS\n";
     std::cout << "====================================================\n\n";
     
-    std::cout << "Testing with " << arraySys.getPassengerCount() << " passengers\n\n";
+    std::cout << "Testing with " << arraySys.getPassengerCount() << " passengers\n";
+    std::cout << "Median nanoseconds per operation (warmed up, repeated)\n\n";
+    
+    BenchmarkResult arrayBuild = arraySys.measureChartBuildTime(comparisonConfig());
+    BenchmarkResult llBuild = llSys.measureChartBuildTime(comparisonConfig());
     
-    double arraySeatingTime = arraySys.measureSeatingChartTime();
-    double llSeatingTime = llSys.measureSeatingChartTime();
+    BenchmarkResult arraySeating = arraySys.measureSeatingChartTime(comparisonConfig());
+    BenchmarkResult llSeating = llSys.measureSeatingChartTime(comparisonConfig());
     
-    double arrayUnsortedTime = arraySys.measureUnsortedManifestTime();
-    double llUnsortedTime = llSys.measureUnsortedManifestTime();
+    BenchmarkResult arrayUnsorted = arraySys.measureUnsortedManifestTime();
+    BenchmarkResult llUnsorted = llSys.measureUnsortedManifestTime();
     
-    double arraySortedTime = arraySys.measureSortedManifestTime();
-    double llSortedTime = llSys.measureSortedManifestTime();
+    BenchmarkResult arraySorted = arraySys.measureSortedManifestTime();
+    BenchmarkResult llSorted = llSys.measureSortedManifestTime();
     
-    double arraySortTime = arraySys.measureSortingTime();
-    double llSortTime = llSys.measureSortingTime();
+    BenchmarkResult arraySort = arraySys.measureSortingTime(comparisonConfig());
+    BenchmarkResult llSort = llSys.measureSortingTime(comparisonConfig());
     
-    double arrayDisplayTime = arraySys.measureDisplayOnlyTime();
-    double llDisplayTime = llSys.measureDisplayOnlyTime();
+    BenchmarkResult arrayDisplay = arraySys.measureDisplayOnlyTime();
+    BenchmarkResult llDisplay = llSys.measureDisplayOnlyTime();
+    
+    BenchmarkResult arraySeat = arraySys.measureSeatLookupTime(comparisonConfig());
+    BenchmarkResult llSeat = llSys.measureSeatLookupTime(comparisonConfig());
     
     size_t arrayMem = arraySys.calculateMemoryUsage();
     size_t llMem = llSys.calculateMemoryUsage();
     
-    double totalArrayTime = arraySeatingTime + arrayUnsortedTime + arraySortedTime;
-    double totalLlTime = llSeatingTime + llUnsortedTime + llSortedTime;
+    double totalArrayTime = arrayBuild.medianNs + arraySeating.medianNs + arrayUnsorted.medianNs + arraySorted.medianNs;
+    double totalLlTime = llBuild.medianNs + llSeating.medianNs + llUnsorted.medianNs + llSorted.medianNs;
     
     std::cout << std::string(73, '=') << "\n";
     std::cout << "| " << std::left << std::setw(30) << "OPERATION" 
-              << " | " << std::left << std::setw(15) << "ARRAY (us)"
-              << " | " << std::left << std::setw(18) << "LINKED LIST (us)" << " |\n";
+              << " | " << std::left << std::setw(15) << "ARRAY (ns)"
+              << " | " << std::left << std::setw(18) << "LINKED LIST (ns)" << " |\n";
     std::cout << std::string(73, '=') << "\n";
     
-    std::cout << "| " << std::left << std::setw(30) << "Seating Chart Display" 
-              << " | " << std::right << std::setw(15) << std::fixed << std::setprecision(2) << arraySeatingTime
-              << " | " << std::right << std::setw(18) << llSeatingTime << " |\n";
-    
-    std::cout << "| " << std::left << std::setw(30) << "Unsorted Manifest" 
-              << " | " << std::right << std::setw(15) << arrayUnsortedTime
-              << " | " << std::right << std::setw(18) << llUnsortedTime << " |\n";
-    
-    std::cout << "| " << std::left << std::setw(30) << "Sorted Manifest" 
-              << " | " << std::right << std::setw(15) << arraySortedTime
-              << " | " << std::right << std::setw(18) << llSortedTime << " |\n";
-    
-    std::cout << "| " << std::left << std::setw(30) << "Sorting Only" 
-              << " | " << std::right << std::setw(15) << arraySortTime
-              << " | " << std::right << std::setw(18) << llSortTime << " |\n";
-    
-    std::cout << "| " << std::left << std::setw(30) << "Display Only" 
-              << " | " << std::right << std::setw(15) << arrayDisplayTime
-              << " | " << std::right << std::setw(18) << llDisplayTime << " |\n";
+    printTableRow("Seating Chart Build", arrayBuild.medianNs, llBuild.medianNs);
+    printTableRow("Seating Chart Display", arraySeating.medianNs, llSeating.medianNs);
+    printTableRow("Unsorted Manifest", arrayUnsorted.medianNs, llUnsorted.medianNs);
+    printTableRow("Sorted Manifest", arraySorted.medianNs, llSorted.medianNs);
+    printTableRow("Sorting Only", arraySort.medianNs, llSort.medianNs);
+    printTableRow("Display Only", arrayDisplay.medianNs, llDisplay.medianNs);
+    printTableRow("Seat Lookup (per seat)", arraySeat.medianNs, llSeat.medianNs);
     
     std::cout << std::string(73, '-') << "\n";
     
-    std::cout << "| " << std::left << std::setw(30) << "TOTAL TIME" 
-              << " | " << std::right << std::setw(15) << totalArrayTime
-              << " | " << std::right << std::setw(18) << totalLlTime << " |\n";
+    printTableRow("TOTAL TIME", totalArrayTime, totalLlTime);
     
     std::cout << std::string(73, '=') << "\n\n";
     
@@ -1352,22 +1291,47 @@ void PerformanceComparator::compareAllOperations(const ArrayDisplaySystem& array
               << " | " << std::left << std::setw(18) << "LINKED LIST" << " |\n";
     std::cout << std::string(73, '=') << "\n";
     
-    std::cout << "| " << std::left << std::setw(30) << "Total (bytes)" 
-              << " | " << std::right << std::setw(15) << arrayMem 
-              << " | " << std::right << std::setw(18) << llMem << " |\n";
-    
-    std::cout << "| " << std::left << std::setw(30) << "Total (KB)" 
-              << " | " << std::right << std::setw(15) << std::fixed << std::setprecision(2) << (arrayMem / 1024.0)
-              << " | " << std::right << std::setw(18) << (llMem / 1024.0) << " |\n";
+    printMemoryRow("Total (bytes)", arrayMem, llMem);
+    printMemoryRow("Total (KB)", arrayMem, llMem, true);
     
     int arrayPassengerCount = arraySys.getPassengerCount();
     int llPassengerCount = llSys.getPassengerCount();
     
-    std::cout << "| " << std::left << std::setw(30) << "Per Passenger (bytes)" 
-              << " | " << std::right << std::setw(15) 
-              << (arrayPassengerCount > 0 ? arrayMem / arrayPassengerCount : 0)
-              << " | " << std::right << std::setw(18) 
-              << (llPassengerCount > 0 ? llMem / llPassengerCount : 0) << " |\n";
+    printMemoryRow("Per Passenger (bytes)",
+                   arrayPassengerCount > 0 ? arrayMem / arrayPassengerCount : 0,
+                   llPassengerCount > 0 ? llMem / llPassengerCount : 0);
+    printHeapRows(arraySys.heapStats(), llSys.heapStats());
+    
+    std::cout << std::string(73, '=') << "\n\n";
+    
+    // Searches use the passenger stored halfway through the dataset, so a
+    // linear scan walks about half of either structure
+    BenchmarkResult arrayLinear, llLinear, llHash;
+    std::string searchID = arraySys.getMiddleID();
+    if (!searchID.empty()) {
+        arrayLinear = arraySys.measureLinearSearchTime(searchID, comparisonConfig());
+        llLinear = llSys.measureLinearSearchTime(searchID, comparisonConfig());
+        llHash = llSys.measureHashSearchTime(searchID, comparisonConfig());
+    }
     
     std::cout << std::string(73, '=') << "\n";
-}
\ No newline at end of file
+    std::cout << "| " << std::left << std::setw(30) << "HW COUNTERS (per operation)" 
+              << " | " << std::left << std::setw(15) << "ARRAY"
+              << " | " << std::left << std::setw(18) << "LINKED LIST" << " |\n";
+    std::cout << std::string(73, '=') << "\n";
+    
+    printCounterRows("Chart build", arrayBuild, llBuild);
+    std::cout << std::string(73, '-') << "\n";
+    printCounterRows("Chart", arraySeating, llSeating);
+    std::cout << std::string(73, '-') << "\n";
+    printCounterRows("Sort", arraySort, llSort);
+    std::cout << std::string(73, '-') << "\n";
+    printCounterRows("Linear", arrayLinear, llLinear);
+    std::cout << std::string(73, '-') << "\n";
+    printCounterRows("Hash (list)", BenchmarkResult(), llHash);
+    
+    std::cout << std::string(73, '=') << "\n";
+    printCounterFootnote();
+    std::cout << "\n";
+    verifyDisplayOutputs(arraySys, llSys, std::cout);
+}
@@ -2,6 +2,16 @@
 #define SEAT_MANIFEST_HPP
 
 #include "Passenger.hpp"
+#include "PassengerSystem.hpp"
+#include "SeatMapPolicies.hpp"
+#include "SeatChartRenderer.hpp"
+#include "SeatOccupancy.hpp"
+#include "Benchmark.hpp"
+#include "HeapTracker.hpp"
+#include "AircraftLayout.hpp"
+#include "WorkStealingPool.hpp"
+#include "ManifestExport.hpp"
+#include "SeatQuery.hpp"
 #include <iostream>
 #include <string>
 #include <chrono>
@@ -9,162 +19,182 @@
 #include <fstream>
 #include <sstream>
 #include <cmath>
-
-// ANSI Color Codes
-#define COLOR_RESET   "\033[0m"
-#define COLOR_RED     "\033[1;31m"
-#define COLOR_GREEN   "\033[1;32m"
+#include <cstdint>
+#include <type_traits>
 
 // Forward declarations for merge sort
 void mergeSort(Passenger* arr, int left, int right, bool sortByID = false);
-void merge(Passenger* arr, int left, int mid, int right, bool sortByID);
+void merge(Passenger* arr, Passenger* scratch, int left, int mid, int right, bool sortByID);
 int comparePassengers(const Passenger& a, const Passenger& b, bool sortByID);
 
-class ArrayDisplaySystem {
+// IDs per work-stealing chunk for the batch lookups below
+const long BATCH_SEARCH_GRAIN = 256;
+
+// Chart and manifest formatting shared by both display systems, so the same
+// data always produces the same bytes
+const int MANIFEST_DISPLAY_LIMIT = 50;   // rows shown by displayPassengerManifest()
+const size_t MANIFEST_DISPLAY_BUFFER = 8192;
+
+void renderSeatingChart(SeatChartRenderer& out, const SeatOccupancy& seats);
+
+// Writes the header up front, then one line per add(). Once `limit` rows are
+// out (0 = no limit) it writes "... and N more" and add() returns false.
+class ManifestWriter {
 private:
-    Passenger*** seatGrid;  
-    Passenger* passengerList;  
-    Passenger* sortedByID;     
+    std::ostream& out;
+    int total;
+    int limit;
+    int written;
+    
+public:
+    ManifestWriter(std::ostream& out, int total, bool sortedBySeat, int limit);
+    bool add(const Passenger& p);
+};
+
+void writeManifestRows(std::ostream& out, const Passenger* rows, int count, bool sortedBySeat, int limit);
+
+// Chart, manifest and lookups on top of PassengerSystem. Only occupied
+// records are stored, in load order. The SeatMap policy maps each seat to
+// its record (see SeatMapPolicies.hpp) and the occupancy bitmap mirrors it.
+// The base is protected: sorting or removing records in place would leave
+// the seat map stale. Instantiated in Seat_Manifest.cpp.
+template <class Storage, class Index, class SeatMap>
+class DisplaySystem : protected PassengerSystem<Storage, Index, MergeSort> {
+protected:
+    SeatMap seatMap;                          // totalRows * seatsPerRow, row-major
     int totalRows;
     int seatsPerRow;
-    int passengerCount;
-    int capacity;
-    bool isSorted;
+    SeatOccupancy occupancy;                  // Bit-packed mirror of seatMap
+    mutable SeatChartRenderer chartRenderer;  // Reused output buffer for the chart
     
-    // Helper methods for dynamic arrays
-    void resizePassengerList(int newCapacity);
-    void resizeSortedArray();
+    Passenger* copyPassengers(int* count) const;
+    void buildSeatingChart(SeatOccupancy& seats, std::true_type) const;
+    void buildSeatingChart(SeatOccupancy& seats, std::false_type) const;
+    void batchLinearSearch(const std::string* ids, long begin, long end, Passenger** results,
+                           std::true_type) const;
+    void batchLinearSearch(const std::string* ids, long begin, long end, Passenger** results,
+                           std::false_type) const;
     
 public:
-    ArrayDisplaySystem(int rows = 400, int seats = 26);
-    ~ArrayDisplaySystem();
+    DisplaySystem(int rows, int seats);
     
     void loadPassengersFromArray(const Passenger* passengers, int count);
     
     // Core display functions
     void displaySeatingChart() const;
     void displayPassengerManifest() const;
+    void setChartColor(bool enabled) { chartRenderer.setColorEnabled(enabled); }
+    
+    // The same output to any stream; limit 0 = every passenger
+    void writeSeatingChart(std::ostream& out) const;
+    void writePassengerManifest(std::ostream& out, bool sortBySeat, int limit = 0) const;
+    // Seat states rebuilt without the bitmap: contiguous storage scans the seat
+    // grid, lists walk their nodes (seats must be totalRows x seatsPerRow)
+    void buildSeatingChart(SeatOccupancy& seats) const;
+    // Seat-order manifest streamed from the seat map: no copy, no sort. Writes
+    // up to maxRows rows (0 = all) from `cursor` and returns the next cursor.
+    int exportManifest(ManifestStream& out, int cursor = 0, int maxRows = 0) const;
+    
+    // Seat queries answered through the seat map, and a columnar copy of it
+    void runSeatQuery(const SeatQuery& query, QueryResult& out) const;
+    void buildSeatColumns(SeatColumns& columns) const;
     
     // TECHNIQUE 1: Linear Search (Common)
     Passenger* linearSearchByID(const std::string& passengerID) const;
     
-    // TECHNIQUE 2: Binary Search (Array-specific)
-    Passenger* binarySearchByID(const std::string& passengerID);
-    void sortByPassengerID();  // For binary search preparation
+    // Group lookup on the calling thread: one walk of the records answers up
+    // to LIST_GROUP_MAX IDs
+    static const int LIST_GROUP_MAX = 64;
+    void linearSearchGroup(const std::string* ids, int count, Passenger** results) const;
+    
+    // Batch lookups: results[i] receives the match for ids[i] (nullptr if none),
+    // in input order. With a pool the IDs are split across its threads.
+    // Contiguous storage scans once per ID, lists use the group walk.
+    void batchLinearSearchByID(const std::string* ids, int count, Passenger** results,
+                               WorkStealingPool* pool = nullptr) const;
     
-    // TECHNIQUE 3: Direct Seat Access (Array-specific)
+    // TECHNIQUE 3: Direct Seat Access through the flat seat map
     Passenger* getSeatDirect(int row, char col) const;
     std::string getSeatStatus(int row, char col) const;
     
-    // Common sorting (using merge sort)
+    // Common sorting (merge sort of a copy)
     void sortBySeatCommon();
     
-    // Performance measurement
-    double measureLinearSearchTime(const std::string& id) const;
-    double measureBinarySearchTime(const std::string& id);
-    double measureSeatingChartTime() const;
-    double measureUnsortedManifestTime() const;
-    double measureSortedManifestTime() const;
-    double measureSortingTime() const;
-    double measureDisplayOnlyTime() const;
+    // Performance measurement (benchmark harness, ns per operation)
+    BenchmarkResult measureLinearSearchTime(const std::string& id, const BenchmarkConfig& config = BenchmarkConfig()) const;
+    BenchmarkResult measureSeatLookupTime(const BenchmarkConfig& config = BenchmarkConfig()) const;
+    BenchmarkResult measureChartBuildTime(const BenchmarkConfig& config = BenchmarkConfig()) const;
+    BenchmarkResult measureSeatingChartTime(const BenchmarkConfig& config = BenchmarkConfig()) const;
+    BenchmarkResult measureUnsortedManifestTime(const BenchmarkConfig& config = BenchmarkConfig()) const;
+    BenchmarkResult measureSortedManifestTime(const BenchmarkConfig& config = BenchmarkConfig()) const;
+    BenchmarkResult measureManifestExportTime(const BenchmarkConfig& config = BenchmarkConfig()) const;
+    BenchmarkResult measureManifestPageTime(int pageSize, const BenchmarkConfig& config = BenchmarkConfig()) const;
+    BenchmarkResult measureSeatQueryTime(const SeatQuery* queries, int count, const BenchmarkConfig& config = BenchmarkConfig()) const;
+    BenchmarkResult measureColumnBuildTime(const BenchmarkConfig& config = BenchmarkConfig()) const;
+    BenchmarkResult measureSortingTime(const BenchmarkConfig& config = BenchmarkConfig()) const;
+    BenchmarkResult measureDisplayOnlyTime(const BenchmarkConfig& config = BenchmarkConfig()) const;
     
     // Test data generation
     char** getTestIDs(int count, int* actualCount) const;
+    // ID stored halfway through the records, i.e. at getPassengerCount() / 2 ("" if empty)
+    std::string getMiddleID() const;
     
-    // Memory usage
+    // Memory usage (tracked heap, including allocator overhead)
     size_t calculateMemoryUsage() const;
+    HeapStats heapStats() const { return this->heap.stats(); }
     
     // Getters
-    int getPassengerCount() const { return passengerCount; }
+    int getPassengerCount() const { return this->size(); }
     int getTotalSeats() const { return totalRows * seatsPerRow; }
     int getMaxRows() const { return totalRows; }
     int getMaxSeatsPerRow() const { return seatsPerRow; }
-    bool getIsSorted() const { return isSorted; }
+    const SeatOccupancy& getOccupancy() const { return occupancy; }
 };
 
-// Node for linked list
-struct ListNode {
-    Passenger data;
-    ListNode* next;
-    
-    ListNode(const Passenger& p, ListNode* n = nullptr) : data(p), next(n) {}
-};
-
-// Hash map entry for ID lookup
-struct HashEntry {
-    std::string key;
-    Passenger* value;
-    HashEntry* next;
-    
-    HashEntry(const std::string& k, Passenger* v, HashEntry* n = nullptr) 
-        : key(k), value(v), next(n) {}
-};
-
-// Simple hash map class
-class SimpleHashMap {
+// Contiguous records and a grid of 32-bit positions. Binary search runs on a
+// sorted copy, so the stored order stays the load order.
+class ArrayDisplaySystem : public DisplaySystem<ArrayStorage, NoIndex, PositionSeatMap> {
 private:
-    static const int TABLE_SIZE = 10007;
-    HashEntry** table;
+    Passenger* sortedByID;   // records by ID, built by sortByPassengerID(); nullptr until then
+    int sortedCount;
     
-public:
-    SimpleHashMap();
-    ~SimpleHashMap();
-    
-    void insert(const std::string& key, Passenger* value);
-    Passenger* find(const std::string& key) const;
-    void clear();
-};
-
-// Linked List-based implementation class
-class LinkedListDisplaySystem {
-private:
-    ListNode* head;
-    SimpleHashMap seatMap;   
-    SimpleHashMap idMap;      
-    int passengerCount;
-    int totalRows;
-    int seatsPerRow;
+    Passenger* findSortedByID(const std::string& passengerID) const;
     
 public:
-    LinkedListDisplaySystem(int rows = 400, int seats = 26);
-    ~LinkedListDisplaySystem();
+    ArrayDisplaySystem(int rows = DEFAULT_LAYOUT_ROWS, int seats = DEFAULT_LAYOUT_COLS);
+    ~ArrayDisplaySystem();
     
+    // Also invalidates the sorted copy
     void loadPassengersFromArray(const Passenger* passengers, int count);
     
-    // Core display functions
-    void displaySeatingChart() const;
-    void displayPassengerManifest() const;
-    
-    // TECHNIQUE 1: Linear Search (Common)
-    Passenger* linearSearchByID(const std::string& passengerID) const;
+    // TECHNIQUE 2: Binary Search (Array-specific)
+    Passenger* binarySearchByID(const std::string& passengerID);
+    void sortByPassengerID();  // For binary search preparation
     
-    // TECHNIQUE 2: Hash Map Lookup (Linked List-specific)
-    Passenger* hashSearchByID(const std::string& passengerID) const;
+    // Same contract as batchLinearSearchByID; sorts once up front
+    void batchBinarySearchByID(const std::string* ids, int count, Passenger** results,
+                               WorkStealingPool* pool = nullptr);
     
-    // Common sorting (using merge sort on array copy)
-    void sortBySeatCommon();
+    BenchmarkResult measureBinarySearchTime(const std::string& id, const BenchmarkConfig& config = BenchmarkConfig());
+};
+
+// Linked nodes, a seat map of node addresses and a hash index by ID
+class LinkedListDisplaySystem : public DisplaySystem<ListStorage, HashIndex, PointerSeatMap> {
+public:
+    LinkedListDisplaySystem(int rows = DEFAULT_LAYOUT_ROWS, int seats = DEFAULT_LAYOUT_COLS);
     
-    // Performance measurement
-    double measureLinearSearchTime(const std::string& id) const;
-    double measureHashSearchTime(const std::string& id) const;
-    double measureSeatingChartTime() const;
-    double measureUnsortedManifestTime() const;
-    double measureSortedManifestTime() const;
-    double measureSortingTime() const;
-    double measureDisplayOnlyTime() const;
+    // TECHNIQUE 2: Hash Index Lookup (Linked List-specific)
+    Passenger* hashSearchByID(const std::string& passengerID) const;
     
-    // Test data generation
-    char** getTestIDs(int count, int* actualCount) const;
+    // Group lookup on the calling thread; prefetches the home slots of up to
+    // HashIndex::BATCH_WIDTH IDs before probing any
+    void hashSearchGroup(const std::string* ids, int count, Passenger** results) const;
     
-    // Memory usage
-    size_t calculateMemoryUsage() const;
+    // Same contract as batchLinearSearchByID, built on the group lookup
+    void batchHashSearchByID(const std::string* ids, int count, Passenger** results,
+                             WorkStealingPool* pool = nullptr) const;
     
-    // Getters
-    int getPassengerCount() const { return passengerCount; }
-    int getTotalSeats() const { return totalRows * seatsPerRow; }
-    int getMaxRows() const { return totalRows; }
-    int getMaxSeatsPerRow() const { return seatsPerRow; }
-    ListNode* getHead() const { return head; }
+    BenchmarkResult measureHashSearchTime(const std::string& id, const BenchmarkConfig& config = BenchmarkConfig()) const;
 };
 
 // Performance comparison utility
@@ -180,14 +210,35 @@ public:
     static void compareSortedManifest(const ArrayDisplaySystem& arraySys, 
                                      const LinkedListDisplaySystem& llSys);
     
+    static void compareSeatLookup(const ArrayDisplaySystem& arraySys, 
+                                 const LinkedListDisplaySystem& llSys);
+    
+    static void compareSeatQueries(const ArrayDisplaySystem& arraySys, 
+                                  const LinkedListDisplaySystem& llSys);
+    
     static void compareAllOperations(const ArrayDisplaySystem& arraySys, 
                                     const LinkedListDisplaySystem& llSys);
     
     // Helper function for table display
-    static void printTableRow(const std::string& label, double arrayVal, double llVal, const std::string& unit = "us");
+    static void printTableRow(const std::string& label, double arrayVal, double llVal, const std::string& unit = "ns");
+    static void printTimingRows(const std::string& label, const BenchmarkResult& arrayRes, const BenchmarkResult& llRes);
     static void printMemoryRow(const std::string& label, size_t arrayVal, size_t llVal, bool inKB = false);
+    static void printHeapRows(const HeapStats& arrayHeap, const HeapStats& llHeap);
+    static void printCounterRows(const std::string& label, const BenchmarkResult& arrayRes, const BenchmarkResult& llRes);
 };
 
+// Writes both systems' full chart and manifests into memory and compares the
+// bytes (the chart is also rebuilt from each structure's own storage). One
+// line per check goes to `report`; returns the number of mismatches.
+int verifyDisplayOutputs(const ArrayDisplaySystem& arraySys, const LinkedListDisplaySystem& llSys,
+                         std::ostream& report);
+
+// Runs the standard seat queries as a grid scan, a seat index scan and on
+// columns built from each structure; one line per query goes to `report`.
+// Returns the number of queries whose answers differ.
+int verifySeatQueries(const ArrayDisplaySystem& arraySys, const LinkedListDisplaySystem& llSys,
+                      std::ostream& report);
+
 // Helper functions
 Passenger* readPassengersFromCSV(const char* filename, int* passengerCount);
 char intToSeatLetter(int num);
@@ -0,0 +1,166 @@
+#include "ServerProtocol.hpp"
+#include <cstring>
+
+const char* opcodeName(int opcode) {
+    switch (opcode) {
+        case OP_RESERVE: return "reserve";
+        case OP_CANCEL: return "cancel";
+        case OP_LOOKUP_ID: return "lookup-id";
+        case OP_LOOKUP_SEAT: return "lookup-seat";
+        case OP_MANIFEST: return "manifest";
+        default: return "unknown";
+    }
+}
+
+const char* statusName(int status) {
+    switch (status) {
+        case STATUS_OK: return "ok";
+        case STATUS_NOT_FOUND: return "not-found";
+        case STATUS_FULL: return "full";
+        case STATUS_BAD_REQUEST: return "bad-request";
+        case STATUS_NOT_SAVED: return "not-saved";
+        default: return "unknown";
+    }
+}
+
+// ==================== BYTE BUFFER ====================
+
+ByteBuffer::ByteBuffer() : data(nullptr), start(0), end(0), capacity(0) {}
+
+ByteBuffer::~ByteBuffer() {
+    delete[] data;
+}
+
+unsigned char* ByteBuffer::prepare(size_t extra) {
+    if (end + extra <= capacity) return data + end;
+
+    size_t used = end - start;
+    if (used + extra <= capacity) {
+        // Enough room once the consumed front is reclaimed
+        std::memmove(data, data + start, used);
+    } else {
+        size_t newCapacity = capacity < 4096 ? 4096 : capacity;
+        while (newCapacity < used + extra) newCapacity *= 2;
+        unsigned char* grown = new unsigned char[newCapacity];
+        if (used > 0) std::memcpy(grown, data + start, used);
+        delete[] data;
+        data = grown;
+        capacity = newCapacity;
+    }
+    start = 0;
+    end = used;
+    return data + end;
+}
+
+void ByteBuffer::append(const void* bytes, size_t count) {
+    std::memcpy(prepare(count), bytes, count);
+    end += count;
+}
+
+void ByteBuffer::consume(size_t count) {
+    start += count < size() ? count : size();
+    if (start == end) start = end = 0;
+}
+
+// ==================== FRAME WRITER ====================
+
+FrameWriter::FrameWriter(ByteBuffer& buffer, uint32_t requestID, int code)
+    : out(buffer), frameStart(buffer.size()) {
+    putU32(0);   // length, filled in by finish()
+    putU32(requestID);
+    putU8((uint32_t)code);
+}
+
+void FrameWriter::putU8(uint32_t value) {
+    unsigned char b = (unsigned char)value;
+    out.append(&b, 1);
+}
+
+void FrameWriter::putU16(uint32_t value) {
+    unsigned char b[2] = {(unsigned char)value, (unsigned char)(value >> 8)};
+    out.append(b, 2);
+}
+
+void FrameWriter::putU32(uint32_t value) {
+    unsigned char b[4] = {(unsigned char)value, (unsigned char)(value >> 8),
+                          (unsigned char)(value >> 16), (unsigned char)(value >> 24)};
+    out.append(b, 4);
+}
+
+void FrameWriter::putString(const std::string& text) {
+    size_t length = text.size() > 255 ? 255 : text.size();
+    putU8((uint32_t)length);
+    out.append(text.data(), length);
+}
+
+void FrameWriter::putPassenger(const Passenger& p) {
+    putString(p.passengerID);
+    putString(p.name);
+    putU16((uint32_t)p.seatRow);
+    putU8((unsigned char)p.seatColumn);
+    putString(p.seatClass);
+}
+
+void FrameWriter::finish() {
+    uint32_t length = (uint32_t)(out.size() - frameStart - 4);
+    unsigned char* prefix = out.begin() + frameStart;
+    prefix[0] = (unsigned char)length;
+    prefix[1] = (unsigned char)(length >> 8);
+    prefix[2] = (unsigned char)(length >> 16);
+    prefix[3] = (unsigned char)(length >> 24);
+}
+
+// ==================== FRAME READER ====================
+
+uint32_t FrameReader::getU8() {
+    if (left < 1) { valid = false; return 0; }
+    uint32_t value = p[0];
+    p += 1;
+    left -= 1;
+    return value;
+}
+
+uint32_t FrameReader::getU16() {
+    if (left < 2) { valid = false; return 0; }
+    uint32_t value = (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+    p += 2;
+    left -= 2;
+    return value;
+}
+
+uint32_t FrameReader::getU32() {
+    if (left < 4) { valid = false; return 0; }
+    uint32_t value = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    p += 4;
+    left -= 4;
+    return value;
+}
+
+std::string FrameReader::getString() {
+    uint32_t length = getU8();
+    if (!valid || left < length) { valid = false; return std::string(); }
+    std::string text((const char*)p, length);
+    p += length;
+    left -= length;
+    return text;
+}
+
+Passenger FrameReader::getPassenger() {
+    Passenger passenger;
+    passenger.passengerID = getString();
+    passenger.name = getString();
+    passenger.seatRow = (int)getU16();
+    passenger.seatColumn = (char)getU8();
+    passenger.seatClass = getString();
+    passenger.isEmpty = false;
+    return passenger;
+}
+
+long completeFrameLength(const ByteBuffer& buffer) {
+    if (buffer.size() < 4) return 0;
+    const unsigned char* b = buffer.begin();
+    uint32_t length = (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+    if (length > MAX_FRAME_BYTES || length < 5) return -1;
+    if (buffer.size() < 4 + (size_t)length) return 0;
+    return 4 + (long)length;
+}
@@ -0,0 +1,123 @@
+#ifndef SERVER_PROTOCOL_HPP
+#define SERVER_PROTOCOL_HPP
+
+#include "Passenger.hpp"
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// Binary protocol of the reservation server (all integers little-endian).
+//
+//   Request                              Response
+//     uint32  length   bytes that follow    uint32  length
+//     uint32  requestID                     uint32  requestID   echoed
+//     uint8   opcode                        uint8   status
+//     payload                               payload (status OK only)
+//
+//   Opcode          Request payload              Response payload
+//   1 RESERVE       str name, str class          passenger
+//   2 CANCEL        str passengerID              -
+//   3 LOOKUP_ID     str passengerID              passenger
+//   4 LOOKUP_SEAT   uint16 row, uint8 column     passenger
+//   5 MANIFEST      uint32 offset, uint16 limit  uint32 total, uint16 count, count x passenger
+//
+//   str       = uint8 length + bytes
+//   passenger = str id, str name, uint16 row, uint8 column ('A'..), str class
+//
+// A client may send any number of requests without waiting (pipelining);
+// responses on one connection come back in request order. Manifest pages are
+// in booking order; a cancellation moves the last booking into the freed slot.
+
+const int OP_RESERVE = 1;
+const int OP_CANCEL = 2;
+const int OP_LOOKUP_ID = 3;
+const int OP_LOOKUP_SEAT = 4;
+const int OP_MANIFEST = 5;
+
+const int STATUS_OK = 0;
+const int STATUS_NOT_FOUND = 1;
+const int STATUS_FULL = 2;          // no seat left
+const int STATUS_BAD_REQUEST = 3;   // unknown opcode or malformed payload
+const int STATUS_NOT_SAVED = 4;     // applied in memory but could not be made durable
+
+const uint32_t MAX_FRAME_BYTES = 64 * 1024;   // larger frames close the connection
+const int MANIFEST_PAGE_MAX = 64;             // passengers per MANIFEST response
+
+const char* opcodeName(int opcode);
+const char* statusName(int status);
+
+// ==================== BUFFERS ====================
+
+// Growable byte queue: append at the back, consume from the front
+class ByteBuffer {
+private:
+    unsigned char* data;
+    size_t start;      // first unconsumed byte
+    size_t end;        // one past the last byte
+    size_t capacity;
+
+public:
+    ByteBuffer();
+    ~ByteBuffer();
+
+    ByteBuffer(const ByteBuffer&) = delete;
+    ByteBuffer& operator=(const ByteBuffer&) = delete;
+
+    // Room for `extra` more bytes at the back (compacts or grows)
+    unsigned char* prepare(size_t extra);
+    void commit(size_t written) { end += written; }
+    void append(const void* bytes, size_t count);
+    void consume(size_t count);
+    void clear() { start = end = 0; }
+
+    unsigned char* begin() { return data + start; }
+    const unsigned char* begin() const { return data + start; }
+    size_t size() const { return end - start; }
+    bool empty() const { return start == end; }
+};
+
+// ==================== ENCODING ====================
+
+// Appends one frame to a buffer; finish() fills in the length prefix
+class FrameWriter {
+private:
+    ByteBuffer& out;
+    size_t frameStart;   // offset of the length prefix from out.begin()
+
+public:
+    FrameWriter(ByteBuffer& buffer, uint32_t requestID, int code);
+
+    void putU8(uint32_t value);
+    void putU16(uint32_t value);
+    void putU32(uint32_t value);
+    void putString(const std::string& text);   // truncated to 255 bytes
+    void putPassenger(const Passenger& p);
+    // Offset (from out.begin()) of the opcode/status byte, for patching later
+    size_t codeOffset() const { return frameStart + 8; }
+    void finish();
+};
+
+// Reads fields from one frame's payload; any overrun clears ok()
+class FrameReader {
+private:
+    const unsigned char* p;
+    size_t left;
+    bool valid;
+
+public:
+    FrameReader(const unsigned char* payload, size_t length) : p(payload), left(length), valid(true) {}
+
+    uint32_t getU8();
+    uint32_t getU16();
+    uint32_t getU32();
+    std::string getString();
+    Passenger getPassenger();
+    bool ok() const { return valid; }
+    bool atEnd() const { return left == 0; }
+};
+
+// Length of the frame at the front of `buffer` including its prefix, 0 if it
+// is not complete yet, or -1 if it is larger than MAX_FRAME_BYTES
+long completeFrameLength(const ByteBuffer& buffer);
+
+#endif
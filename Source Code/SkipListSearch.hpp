@@ -0,0 +1,31 @@
+#ifndef SKIPLISTSEARCH_HPP
+#define SKIPLISTSEARCH_HPP
+
+#include <iostream>
+#include "Passenger.hpp"
+#include "PassengerSystem.hpp"
+using namespace std;
+
+// Skip list column of the search menu: linked nodes kept in ID order with
+// express lanes, so lookups, bookings and cancellations are O(log n) and
+// there is nothing to sort
+class SkipListPassengerSystem : public PassengerSystem<SkipListStorage, NoIndex, MergeSort> {
+public:
+    void addPassenger(const string& id, const string& n, int r, char c, const string& cls) {
+        add(Passenger(id, n, r, c, cls, false));
+    }
+
+    // --- SKIP LIST SEARCH (O(log n)) ---
+    bool searchPassenger(const string& targetID) {
+        return containsOrdered(targetID);
+    }
+
+    // --- CANCELLATION (O(log n)) ---
+    bool cancelPassenger(const string& targetID) {
+        return remove(targetID);
+    }
+
+    int getLevels() const { return storage.getLevels(); }
+};
+
+#endif
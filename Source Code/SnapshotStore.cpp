@@ -0,0 +1,573 @@
+#include "SnapshotStore.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+// Passenger IDs are numeric in every dataset; anything else sorts first
+static long numericID(const std::string& id) {
+    return std::atol(id.c_str());
+}
+
+struct IdOrder {
+    long id;
+    int index;
+    bool operator<(const IdOrder& other) const { return id < other.id; }
+};
+
+// Loaded passengers that fit the layout, ordered by numeric ID; returns the count
+static int orderByID(const Passenger* passengers, int count, const AircraftLayout& layout, IdOrder* out) {
+    int n = 0;
+    for (int i = 0; i < count; i++) {
+        const Passenger& p = passengers[i];
+        if (p.isEmpty || p.seatRow < 1 || p.seatRow > layout.getRows() ||
+            p.seatColumn < 'A' || p.seatColumn >= 'A' + layout.getCols()) {
+            continue;
+        }
+        out[n].id = numericID(p.passengerID);
+        out[n].index = i;
+        n++;
+    }
+    std::sort(out, out + n);
+    return n;
+}
+
+// ==================== SNAPSHOT STORE ====================
+
+SnapshotStore::SnapshotStore(const AircraftLayout& seatMap)
+    : layout(seatMap), seats(0, 0), nextID(1), table(nullptr), tableCapacity(0),
+      count(0), version(0), current(nullptr), globalEpoch(1),
+      retiredHead(nullptr), retiredCount(0), reclaimed(0) {
+    for (int i = 0; i < SNAPSHOT_MAX_READERS; i++) {
+        readers[i].epoch.store(0);
+        readers[i].inUse.store(false);
+    }
+    HeapScope scope(heap);
+    seats.resize(layout.getRows(), layout.getCols());
+    init(nullptr, 0, 0);
+}
+
+SnapshotStore::~SnapshotStore() {
+    freeAll();
+}
+
+void SnapshotStore::freeAll() {
+    int chunkCount = (count + SNAPSHOT_CHUNK_SIZE - 1) / SNAPSHOT_CHUNK_SIZE;
+    for (int i = 0; i < chunkCount; i++) delete table[i];
+    delete[] table;
+    delete current.load();
+    table = nullptr;
+    tableCapacity = 0;
+    count = 0;
+    current.store(nullptr);
+
+    while (retiredHead) {
+        Retired* next = retiredHead->next;
+        if (retiredHead->kind == 0) delete (PassengerSnapshot*)retiredHead->item;
+        else if (retiredHead->kind == 1) delete[] (SnapshotChunk**)retiredHead->item;
+        else delete (SnapshotChunk*)retiredHead->item;
+        delete retiredHead;
+        retiredHead = next;
+    }
+    retiredCount = 0;
+}
+
+void SnapshotStore::init(const Passenger* passengers, int passengerCount, int maxID) {
+    TRACE_SPAN("index", "SnapshotStore::init");
+    std::lock_guard<std::mutex> guard(writerLock);
+    HeapScope scope(heap);
+    freeAll();
+
+    seats.clear();
+    layout.markBlocked(seats);
+
+    IdOrder* order = new IdOrder[passengerCount > 0 ? passengerCount : 1];
+    int n = orderByID(passengers, passengerCount, layout, order);
+
+    tableCapacity = 16;
+    while (tableCapacity * SNAPSHOT_CHUNK_SIZE < n) tableCapacity *= 2;
+    table = new SnapshotChunk*[tableCapacity];
+
+    for (int k = 0; k < n; k++) {
+        const Passenger& p = passengers[order[k].index];
+        if (k % SNAPSHOT_CHUNK_SIZE == 0) table[k / SNAPSHOT_CHUNK_SIZE] = new SnapshotChunk;
+        SnapshotChunk* chunk = table[k / SNAPSHOT_CHUNK_SIZE];
+        chunk->ids[k % SNAPSHOT_CHUNK_SIZE] = order[k].id;
+        chunk->records[k % SNAPSHOT_CHUNK_SIZE] = p;
+        seats.reserve(p.seatRow - 1, p.seatColumn - 'A');
+    }
+    delete[] order;
+
+    count = n;
+    nextID = (long)maxID + 1;
+    current.store(new PassengerSnapshot{++version, count, table});
+}
+
+// ==================== EPOCHS / RECLAMATION ====================
+
+int SnapshotStore::registerReader() {
+    for (int i = 0; i < SNAPSHOT_MAX_READERS; i++) {
+        bool expected = false;
+        if (readers[i].inUse.compare_exchange_strong(expected, true)) return i;
+    }
+    return -1;
+}
+
+void SnapshotStore::unregisterReader(int slot) {
+    if (slot < 0 || slot >= SNAPSHOT_MAX_READERS) return;
+    readers[slot].epoch.store(0);
+    readers[slot].inUse.store(false);
+}
+
+// Caller holds writerLock. Swaps in a new header, then retires what it replaced
+// under one epoch: readers that announce a later epoch already see the new header.
+void SnapshotStore::publish(int newCount, SnapshotChunk** newTable) {
+    SnapshotChunk** oldTable = nullptr;
+    if (newTable && newTable != table) {
+        oldTable = table;
+        table = newTable;
+    }
+    count = newCount;
+
+    PassengerSnapshot* snap = new PassengerSnapshot{++version, newCount, table};
+    PassengerSnapshot* old = current.exchange(snap);
+    retire(0, old);
+    if (oldTable) retire(1, oldTable);
+}
+
+void SnapshotStore::retire(int kind, void* item) {
+    Retired* r = new Retired;
+    r->epoch = globalEpoch.fetch_add(1);
+    r->kind = kind;
+    r->item = item;
+    r->next = retiredHead;
+    retiredHead = r;
+    retiredCount++;
+}
+
+// Frees retired items no active reader can still hold
+void SnapshotStore::reclaim() {
+    uint64_t minActive = UINT64_MAX;
+    for (int i = 0; i < SNAPSHOT_MAX_READERS; i++) {
+        uint64_t e = readers[i].epoch.load();
+        if (e != 0 && e < minActive) minActive = e;
+    }
+
+    Retired** link = &retiredHead;
+    while (*link) {
+        Retired* r = *link;
+        if (r->epoch < minActive) {
+            if (r->kind == 0) delete (PassengerSnapshot*)r->item;
+            else if (r->kind == 1) delete[] (SnapshotChunk**)r->item;
+            else delete (SnapshotChunk*)r->item;
+            *link = r->next;
+            delete r;
+            retiredCount--;
+            reclaimed++;
+        } else {
+            link = &r->next;
+        }
+    }
+}
+
+// ==================== READERS ====================
+
+int SnapshotStore::findIndex(const PassengerSnapshot* snap, long id) const {
+    int chunkCount = (snap->count + SNAPSHOT_CHUNK_SIZE - 1) / SNAPSHOT_CHUNK_SIZE;
+    if (chunkCount == 0) return -1;
+
+    // Last chunk whose first ID is <= id
+    int lo = 0, hi = chunkCount - 1;
+    while (lo < hi) {
+        int mid = (lo + hi + 1) / 2;
+        if (snap->chunks[mid]->ids[0] <= id) lo = mid;
+        else hi = mid - 1;
+    }
+
+    const SnapshotChunk* chunk = snap->chunks[lo];
+    int n = snap->count - lo * SNAPSHOT_CHUNK_SIZE;
+    if (n > SNAPSHOT_CHUNK_SIZE) n = SNAPSHOT_CHUNK_SIZE;
+    int left = 0, right = n - 1;
+    while (left <= right) {
+        int mid = (left + right) / 2;
+        if (chunk->ids[mid] == id) return lo * SNAPSHOT_CHUNK_SIZE + mid;
+        if (chunk->ids[mid] < id) left = mid + 1;
+        else right = mid - 1;
+    }
+    return -1;
+}
+
+bool SnapshotStore::search(int readerSlot, const std::string& id, Passenger& out) const {
+    // Without a slot the read could not be pinned, so reclaim() might free it
+    if (readerSlot < 0 || readerSlot >= SNAPSHOT_MAX_READERS) return false;
+    ReaderSlot& slot = readers[readerSlot];
+    slot.epoch.store(globalEpoch.load());          // pin: nothing retired from now on is freed
+    const PassengerSnapshot* snap = current.load();
+
+    bool found = false;
+    int index = findIndex(snap, numericID(id));
+    if (index >= 0) {
+        const Passenger& p = snap->chunks[index / SNAPSHOT_CHUNK_SIZE]->records[index % SNAPSHOT_CHUNK_SIZE];
+        if (!p.isEmpty) {
+            out = p;
+            found = true;
+        }
+    }
+
+    slot.epoch.store(0, std::memory_order_release);
+    return found;
+}
+
+uint64_t SnapshotStore::getVersion() const {
+    const PassengerSnapshot* snap = current.load();
+    return snap ? snap->version : 0;
+}
+
+// ==================== WRITERS ====================
+
+bool SnapshotStore::reserve(const std::string& name, const std::string& cls, Passenger& out) {
+    TRACE_SPAN("reserve", "SnapshotStore::reserve");
+    std::lock_guard<std::mutex> guard(writerLock);
+    int r, c;
+    if (!seats.findFirstAvailable(r, c)) return false;
+    seats.reserve(r, c);
+
+    HeapScope scope(heap);
+    int chunkIndex = count / SNAPSHOT_CHUNK_SIZE;
+    int slot = count % SNAPSHOT_CHUNK_SIZE;
+    SnapshotChunk** target = table;
+
+    if (slot == 0) {
+        if (chunkIndex == tableCapacity) {
+            // Readers may still walk the old table, so grow into a copy
+            target = new SnapshotChunk*[tableCapacity * 2];
+            std::memcpy(target, table, sizeof(SnapshotChunk*) * tableCapacity);
+            tableCapacity *= 2;
+        }
+        target[chunkIndex] = new SnapshotChunk;
+    }
+
+    // New IDs exceed every existing one, so appending keeps the order.
+    // The slot is beyond every published count until publish() below.
+    SnapshotChunk* chunk = target[chunkIndex];
+    long id = nextID++;
+    Passenger& p = chunk->records[slot];
+    p.passengerID = std::to_string(id);
+    p.name = name;
+    p.seatRow = r + 1;
+    p.seatColumn = (char)('A' + c);
+    p.seatClass = cls;
+    p.isEmpty = false;
+    chunk->ids[slot] = id;
+    out = p;
+
+    publish(count + 1, target);
+    reclaim();
+    return true;
+}
+
+bool SnapshotStore::cancel(const std::string& id) {
+    TRACE_SPAN("cancel", "SnapshotStore::cancel");
+    std::lock_guard<std::mutex> guard(writerLock);
+    const PassengerSnapshot* snap = current.load();
+    int index = findIndex(snap, numericID(id));
+    if (index < 0) return false;
+
+    int chunkIndex = index / SNAPSHOT_CHUNK_SIZE;
+    SnapshotChunk* old = table[chunkIndex];
+    Passenger& gone = old->records[index % SNAPSHOT_CHUNK_SIZE];
+    if (gone.isEmpty) return false;
+
+    // Copy-on-write: new chunk with the entry cleared, new table pointing at it
+    HeapScope scope(heap);
+    SnapshotChunk* copy = new SnapshotChunk(*old);
+    copy->records[index % SNAPSHOT_CHUNK_SIZE].isEmpty = true;
+
+    SnapshotChunk** newTable = new SnapshotChunk*[tableCapacity];
+    std::memcpy(newTable, table, sizeof(SnapshotChunk*) * tableCapacity);
+    newTable[chunkIndex] = copy;
+
+    seats.release(gone.seatRow - 1, gone.seatColumn - 'A');
+    publish(count, newTable);
+    retire(2, old);
+    reclaim();
+    return true;
+}
+
+// ==================== MUTEX BASELINE ====================
+
+MutexPassengerStore::MutexPassengerStore(const AircraftLayout& seatMap)
+    : layout(seatMap), seats(seatMap.getRows(), seatMap.getCols()),
+      ids(nullptr), records(nullptr), count(0), capacity(0), nextID(1) {
+    init(nullptr, 0, 0);
+}
+
+MutexPassengerStore::~MutexPassengerStore() {
+    delete[] ids;
+    delete[] records;
+}
+
+void MutexPassengerStore::init(const Passenger* passengers, int passengerCount, int maxID) {
+    std::lock_guard<std::mutex> guard(lock);
+    seats.clear();
+    layout.markBlocked(seats);
+
+    IdOrder* order = new IdOrder[passengerCount > 0 ? passengerCount : 1];
+    int n = orderByID(passengers, passengerCount, layout, order);
+
+    delete[] ids;
+    delete[] records;
+    capacity = n + 1024;
+    ids = new long[capacity];
+    records = new Passenger[capacity];
+    for (int k = 0; k < n; k++) {
+        const Passenger& p = passengers[order[k].index];
+        ids[k] = order[k].id;
+        records[k] = p;
+        seats.reserve(p.seatRow - 1, p.seatColumn - 'A');
+    }
+    delete[] order;
+
+    count = n;
+    nextID = (long)maxID + 1;
+}
+
+int MutexPassengerStore::findIndex(long id) const {
+    int left = 0, right = count - 1;
+    while (left <= right) {
+        int mid = (left + right) / 2;
+        if (ids[mid] == id) return mid;
+        if (ids[mid] < id) left = mid + 1;
+        else right = mid - 1;
+    }
+    return -1;
+}
+
+bool MutexPassengerStore::search(const std::string& id, Passenger& out) const {
+    std::lock_guard<std::mutex> guard(lock);
+    int index = findIndex(numericID(id));
+    if (index < 0 || records[index].isEmpty) return false;
+    out = records[index];
+    return true;
+}
+
+bool MutexPassengerStore::reserve(const std::string& name, const std::string& cls, Passenger& out) {
+    std::lock_guard<std::mutex> guard(lock);
+    int r, c;
+    if (!seats.findFirstAvailable(r, c)) return false;
+    seats.reserve(r, c);
+
+    if (count == capacity) {
+        int newCapacity = capacity * 2;
+        long* grownIDs = new long[newCapacity];
+        Passenger* grown = new Passenger[newCapacity];
+        for (int i = 0; i < count; i++) {
+            grownIDs[i] = ids[i];
+            grown[i] = records[i];
+        }
+        delete[] ids;
+        delete[] records;
+        ids = grownIDs;
+        records = grown;
+        capacity = newCapacity;
+    }
+
+    long id = nextID++;
+    Passenger& p = records[count];
+    p.passengerID = std::to_string(id);
+    p.name = name;
+    p.seatRow = r + 1;
+    p.seatColumn = (char)('A' + c);
+    p.seatClass = cls;
+    p.isEmpty = false;
+    ids[count++] = id;
+    out = p;
+    return true;
+}
+
+bool MutexPassengerStore::cancel(const std::string& id) {
+    std::lock_guard<std::mutex> guard(lock);
+    int index = findIndex(numericID(id));
+    if (index < 0 || records[index].isEmpty) return false;
+    records[index].isEmpty = true;
+    seats.release(records[index].seatRow - 1, records[index].seatColumn - 'A');
+    return true;
+}
+
+// ==================== MIXED READ/WRITE BENCHMARK ====================
+
+namespace {
+
+const int MIXED_ID_POOL = 4096;
+
+uint64_t mixedRandom(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// Uniform interface over the two stores for the worker loop
+struct SnapshotAdapter {
+    SnapshotStore& store;
+    int slot;
+    explicit SnapshotAdapter(SnapshotStore& s) : store(s), slot(s.registerReader()) {}
+    ~SnapshotAdapter() { store.unregisterReader(slot); }
+    bool search(const std::string& id, Passenger& out) { return store.search(slot, id, out); }
+    bool reserve(Passenger& out) { return store.reserve("Mixed", "Economy", out); }
+};
+
+struct MutexAdapter {
+    MutexPassengerStore& store;
+    explicit MutexAdapter(MutexPassengerStore& s) : store(s) {}
+    bool search(const std::string& id, Passenger& out) { return store.search(id, out); }
+    bool reserve(Passenger& out) { return store.reserve("Mixed", "Economy", out); }
+};
+
+struct MixedShared {
+    const std::string* ids;
+    int opsPerThread;
+    int readPercent;
+    std::atomic<int> ready;
+    std::atomic<bool> go;
+};
+
+struct MixedSamples {
+    double* readNs;
+    double* writeNs;
+    long reads;
+    long writes;
+};
+
+template <class Adapter, class Store>
+void mixedWorker(Store& store, MixedShared& shared, MixedSamples& samples, uint64_t seed) {
+    Adapter adapter(store);
+    Passenger out;
+    uint64_t rng = seed;
+
+    shared.ready.fetch_add(1);
+    while (!shared.go.load(std::memory_order_acquire)) std::this_thread::yield();
+
+    for (int i = 0; i < shared.opsPerThread; i++) {
+        uint64_t roll = mixedRandom(rng);
+        bool isRead = (int)(roll % 100) < shared.readPercent;
+        auto start = std::chrono::steady_clock::now();
+        if (isRead) {
+            doNotOptimize(adapter.search(shared.ids[(roll >> 8) % MIXED_ID_POOL], out));
+        } else {
+            doNotOptimize(adapter.reserve(out));
+        }
+        double ns = elapsedNs(start, std::chrono::steady_clock::now());
+        if (isRead) samples.readNs[samples.reads++] = ns;
+        else samples.writeNs[samples.writes++] = ns;
+    }
+}
+
+template <class Adapter, class Store>
+double runWorkers(Store& store, MixedShared& shared, MixedSamples* samples, int threads) {
+    std::thread* pool = new std::thread[threads];
+    for (int t = 0; t < threads; t++) {
+        pool[t] = std::thread(mixedWorker<Adapter, Store>, std::ref(store), std::ref(shared),
+                              std::ref(samples[t]), (uint64_t)(t + 1) * 7919u);
+    }
+    while (shared.ready.load() < threads) std::this_thread::yield();
+    auto start = std::chrono::steady_clock::now();
+    shared.go.store(true, std::memory_order_release);
+    for (int t = 0; t < threads; t++) pool[t].join();
+    double wallNs = elapsedNs(start, std::chrono::steady_clock::now());
+    delete[] pool;
+    return wallNs;
+}
+
+}  // namespace
+
+MixedWorkloadResult runMixedWorkload(bool useSnapshot, const Passenger* passengers, int count,
+                                     int threads, int opsPerThread, int readPercent) {
+    TRACE_SPAN("bench", "runMixedWorkload");
+    if (threads < 1) threads = 1;
+    if (threads > SNAPSHOT_MAX_READERS) threads = SNAPSHOT_MAX_READERS;
+    if (opsPerThread < 1) opsPerThread = 1;
+
+    // Preload only as many passengers as leaves a free seat for every write
+    const AircraftLayout& layout = activeLayout();
+    long expectedWrites = (long)threads * opsPerThread * (100 - readPercent) / 100 + threads * 16;
+    long preload = layout.getSeatCount() - expectedWrites;
+    int prefix = 0;
+    long occupied = 0;
+    int maxID = 0;
+    while (prefix < count && occupied < preload) {
+        if (!passengers[prefix].isEmpty) {
+            occupied++;
+            int id = (int)numericID(passengers[prefix].passengerID);
+            if (id > maxID) maxID = id;
+        }
+        prefix++;
+    }
+
+    // Search keys: random IDs of preloaded passengers
+    MixedShared shared;
+    std::string* ids = new std::string[MIXED_ID_POOL];
+    uint64_t rng = 12345;
+    for (int i = 0; i < MIXED_ID_POOL; i++) {
+        ids[i] = "0";
+        for (int attempt = 0; attempt < 64 && prefix > 0; attempt++) {
+            const Passenger& p = passengers[mixedRandom(rng) % (uint64_t)prefix];
+            if (!p.isEmpty) { ids[i] = p.passengerID; break; }
+        }
+    }
+    shared.ids = ids;
+    shared.opsPerThread = opsPerThread;
+    shared.readPercent = readPercent;
+    shared.ready.store(0);
+    shared.go.store(false);
+
+    MixedSamples* samples = new MixedSamples[threads];
+    for (int t = 0; t < threads; t++) {
+        samples[t].readNs = new double[opsPerThread];
+        samples[t].writeNs = new double[opsPerThread];
+        samples[t].reads = 0;
+        samples[t].writes = 0;
+    }
+
+    double wallNs;
+    if (useSnapshot) {
+        SnapshotStore* store = new SnapshotStore(layout);
+        store->init(passengers, prefix, maxID);
+        wallNs = runWorkers<SnapshotAdapter>(*store, shared, samples, threads);
+        delete store;
+    } else {
+        MutexPassengerStore* store = new MutexPassengerStore(layout);
+        store->init(passengers, prefix, maxID);
+        wallNs = runWorkers<MutexAdapter>(*store, shared, samples, threads);
+        delete store;
+    }
+
+    // Merge per-thread samples
+    MixedWorkloadResult result;
+    result.reads = 0;
+    result.writes = 0;
+    for (int t = 0; t < threads; t++) {
+        result.reads += samples[t].reads;
+        result.writes += samples[t].writes;
+    }
+    double* reads = new double[result.reads > 0 ? result.reads : 1];
+    double* writes = new double[result.writes > 0 ? result.writes : 1];
+    long r = 0, w = 0;
+    for (int t = 0; t < threads; t++) {
+        for (long i = 0; i < samples[t].reads; i++) reads[r++] = samples[t].readNs[i];
+        for (long i = 0; i < samples[t].writes; i++) writes[w++] = samples[t].writeNs[i];
+        delete[] samples[t].readNs;
+        delete[] samples[t].writeNs;
+    }
+    result.readLatency = summarizeSamples(reads, (int)result.reads, result.reads);
+    result.writeLatency = summarizeSamples(writes, (int)result.writes, result.writes);
+    result.opsPerSecond = wallNs > 0.0 ? (result.reads + result.writes) * 1e9 / wallNs : 0.0;
+
+    delete[] reads;
+    delete[] writes;
+    delete[] samples;
+    delete[] ids;
+    return result;
+}
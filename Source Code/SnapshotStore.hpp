@@ -0,0 +1,153 @@
+#ifndef SNAPSHOT_STORE_HPP
+#define SNAPSHOT_STORE_HPP
+
+#include "Passenger.hpp"
+#include "SeatOccupancy.hpp"
+#include "AircraftLayout.hpp"
+#include "HeapTracker.hpp"
+#include "Benchmark.hpp"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <cstdint>
+
+// Read-optimized passenger store: searches run against an immutable,
+// versioned snapshot and never wait for bookings.
+//
+// Records live in fixed-size chunks ordered by numeric passenger ID. A
+// snapshot is a small header (version, visible record count, chunk table).
+// - reserve() appends into a slot no published snapshot can see yet, then
+//   publishes a new header; older readers keep using their own count.
+// - cancel() copies the affected chunk (and the chunk table), publishes the
+//   copy and retires the old ones.
+// Retired headers, tables and chunks are freed only after every reader that
+// could still hold them has left its read section (epoch-based reclamation).
+// Writers are serialized by a mutex; readers take no locks.
+
+const int SNAPSHOT_CHUNK_SIZE = 64;
+const int SNAPSHOT_MAX_READERS = 64;
+
+struct SnapshotChunk {
+    long ids[SNAPSHOT_CHUNK_SIZE];          // ascending
+    Passenger records[SNAPSHOT_CHUNK_SIZE]; // cancelled entries have isEmpty = true
+};
+
+struct PassengerSnapshot {
+    uint64_t version;
+    int count;                       // records visible in this version
+    SnapshotChunk* const* chunks;    // shared with other versions until a table copy
+};
+
+class SnapshotStore {
+public:
+    explicit SnapshotStore(const AircraftLayout& layout = activeLayout());
+    ~SnapshotStore();
+
+    SnapshotStore(const SnapshotStore&) = delete;
+    SnapshotStore& operator=(const SnapshotStore&) = delete;
+
+    // Single-threaded setup; records are ordered by numeric ID
+    void init(const Passenger* passengers, int passengerCount, int maxID);
+
+    // --- READERS (lock-free) ---
+    // Each reading thread takes a slot once; -1 when all slots are in use
+    int registerReader();
+    void unregisterReader(int slot);
+    // Copies the passenger out while the snapshot is pinned; false (no read)
+    // for a slot registerReader() did not hand out
+    bool search(int readerSlot, const std::string& id, Passenger& out) const;
+
+    // --- WRITERS (serialized) ---
+    bool reserve(const std::string& name, const std::string& cls, Passenger& out);
+    bool cancel(const std::string& id);
+
+    uint64_t getVersion() const;
+    long getReclaimedCount() const { return reclaimed; }
+    int getPendingRetired() const { return retiredCount; }
+    HeapStats heapStats() const { return heap.stats(); }
+
+private:
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> epoch;   // 0 = not reading
+        std::atomic<bool> inUse;
+    };
+
+    struct Retired {
+        uint64_t epoch;
+        int kind;          // 0 = header, 1 = chunk table, 2 = chunk
+        void* item;
+        Retired* next;
+    };
+
+    // Writer-side state (guarded by writerLock)
+    void publish(int newCount, SnapshotChunk** newTable);
+    void retire(int kind, void* item);
+    void reclaim();
+    void freeAll();
+    int findIndex(const PassengerSnapshot* snap, long id) const;
+
+    HeapAccount heap;
+    AircraftLayout layout;
+    std::mutex writerLock;
+    SeatOccupancy seats;
+    long nextID;
+
+    SnapshotChunk** table;     // current chunk table (writer's view)
+    int tableCapacity;
+    int count;                 // records written (published or about to be)
+    uint64_t version;
+
+    std::atomic<PassengerSnapshot*> current;
+    std::atomic<uint64_t> globalEpoch;
+    mutable ReaderSlot readers[SNAPSHOT_MAX_READERS];
+
+    Retired* retiredHead;
+    int retiredCount;
+    long reclaimed;
+};
+
+// Baseline with identical operations behind one mutex (readers block on writers)
+class MutexPassengerStore {
+public:
+    explicit MutexPassengerStore(const AircraftLayout& layout = activeLayout());
+    ~MutexPassengerStore();
+
+    MutexPassengerStore(const MutexPassengerStore&) = delete;
+    MutexPassengerStore& operator=(const MutexPassengerStore&) = delete;
+
+    void init(const Passenger* passengers, int passengerCount, int maxID);
+    bool search(const std::string& id, Passenger& out) const;
+    bool reserve(const std::string& name, const std::string& cls, Passenger& out);
+    bool cancel(const std::string& id);
+
+private:
+    int findIndex(long id) const;
+
+    mutable std::mutex lock;
+    AircraftLayout layout;
+    SeatOccupancy seats;
+    long* ids;                 // ascending
+    Passenger* records;
+    int count;
+    int capacity;
+    long nextID;
+};
+
+// ==================== MIXED READ/WRITE BENCHMARK ====================
+
+struct MixedWorkloadResult {
+    BenchmarkResult readLatency;    // one sample per search
+    BenchmarkResult writeLatency;   // one sample per reservation
+    double opsPerSecond;            // all threads together
+    long reads;
+    long writes;
+};
+
+// `threads` threads each run `opsPerThread` operations: `readPercent`% searches
+// for random existing IDs, the rest reservations. useSnapshot = false runs the
+// mutex baseline. Each thread needs a reader slot, so `threads` is capped at
+// SNAPSHOT_MAX_READERS.
+MixedWorkloadResult runMixedWorkload(bool useSnapshot, const Passenger* passengers, int count,
+                                     int threads, int opsPerThread, int readPercent);
+
+#endif
@@ -0,0 +1,637 @@
+#ifndef STORAGE_POLICIES_HPP
+#define STORAGE_POLICIES_HPP
+
+#include "Passenger.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <utility>
+
+// Storage policies for PassengerSystem. Each keeps passengers in insertion
+// order and offers the same interface, so the system is written once:
+//
+//   Iterator begin(), end() const  forward iteration (*it is a Passenger&;
+//                                  const only promises the layout is unchanged)
+//   int size() const
+//   void reserve(int n)            capacity hint; where honoured, the first n
+//                                  records neither move nor allocate on append
+//   Passenger* append(p, onMove)   adds at the back (p is moved in)
+//   bool remove(p, onMove)         removes the record at p; false if the
+//                                  remaining records changed relative order
+//   void clear()
+//
+// Records that a call relocates are reported as onMove(from, to) so indexes
+// can follow them; `from` is only compared, never dereferenced.
+// RANDOM_ACCESS storages also provide at(i). ORDERED storages keep records
+// sorted by passengerID instead (equal IDs in insertion order) and provide
+// find(id), the first record with that ID. ListStorage also provides
+// removeFirst(match) and findWithSentinel() for the cancellation menu.
+
+// ==================== CONTIGUOUS ARRAY ====================
+
+class ArrayStorage {
+private:
+    Passenger* items;
+    int count;
+    int capacity;
+
+    template <class OnMove>
+    void grow(int newCapacity, OnMove& onMove) {
+        Passenger* grown = new Passenger[newCapacity];
+        for (int i = 0; i < count; i++) {
+            grown[i] = std::move(items[i]);
+            onMove(&items[i], &grown[i]);
+        }
+        delete[] items;
+        items = grown;
+        capacity = newCapacity;
+    }
+
+public:
+    static const bool RANDOM_ACCESS = true;
+    static const bool ORDERED = false;
+    static const char* name() { return "array"; }
+
+    class Iterator {
+        Passenger* p;
+    public:
+        explicit Iterator(Passenger* at) : p(at) {}
+        Passenger& operator*() const { return *p; }
+        Passenger* operator->() const { return p; }
+        Iterator& operator++() { ++p; return *this; }
+        bool operator!=(const Iterator& other) const { return p != other.p; }
+    };
+
+    ArrayStorage() : items(nullptr), count(0), capacity(0) {}
+    ~ArrayStorage() { delete[] items; }
+
+    ArrayStorage(const ArrayStorage&) = delete;
+    ArrayStorage& operator=(const ArrayStorage&) = delete;
+
+    Iterator begin() const { return Iterator(items); }
+    Iterator end() const { return Iterator(items + count); }
+    int size() const { return count; }
+    Passenger& at(int i) const { return items[i]; }
+
+    void reserve(int n) {
+        auto ignore = [](Passenger*, Passenger*) {};
+        if (n > capacity) grow(n, ignore);
+    }
+
+    template <class OnMove>
+    Passenger* append(Passenger p, OnMove onMove) {
+        if (count == capacity) grow(capacity < 16 ? 16 : capacity * 2, onMove);
+        items[count] = std::move(p);
+        return &items[count++];
+    }
+
+    // The last record moves into the gap (O(1), order not kept)
+    template <class OnMove>
+    bool remove(Passenger* p, OnMove onMove) {
+        Passenger* last = &items[count - 1];
+        bool moved = p != last;
+        if (moved) {
+            *p = std::move(*last);
+            onMove(last, p);
+        }
+        *last = Passenger();
+        count--;
+        return !moved;
+    }
+
+    void clear() {
+        delete[] items;
+        items = nullptr;
+        count = capacity = 0;
+    }
+};
+
+// ==================== SINGLY LINKED LIST ====================
+
+class ListStorage {
+private:
+    SimpleNode* head;
+    SimpleNode* tail;
+    int count;
+
+public:
+    static const bool RANDOM_ACCESS = false;
+    static const bool ORDERED = false;
+    static const char* name() { return "list"; }
+
+    class Iterator {
+        SimpleNode* node;
+    public:
+        explicit Iterator(SimpleNode* at) : node(at) {}
+        Passenger& operator*() const { return node->data; }
+        Passenger* operator->() const { return &node->data; }
+        Iterator& operator++() { node = node->next; return *this; }
+        bool operator!=(const Iterator& other) const { return node != other.node; }
+    };
+
+    ListStorage() : head(nullptr), tail(nullptr), count(0) {}
+    ~ListStorage() { clear(); }
+
+    ListStorage(const ListStorage&) = delete;
+    ListStorage& operator=(const ListStorage&) = delete;
+
+    Iterator begin() const { return Iterator(head); }
+    Iterator end() const { return Iterator(nullptr); }
+    int size() const { return count; }
+    void reserve(int) {}
+
+    template <class OnMove>
+    Passenger* append(Passenger p, OnMove) {
+        SimpleNode* node = new SimpleNode(std::move(p));
+        if (tail) tail->next = node;
+        else head = node;
+        tail = node;
+        count++;
+        return &node->data;
+    }
+
+    // Finds the predecessor by walking from the head (O(n))
+    template <class OnMove>
+    bool remove(Passenger* p, OnMove) {
+        removeFirst([p](const Passenger& record) { return &record == p; });
+        return true;
+    }
+
+    // Unlinks the first record that `match` accepts, in one walk; false if none
+    template <class Match>
+    bool removeFirst(Match match) {
+        SimpleNode* prev = nullptr;
+        SimpleNode* cur = head;
+        while (cur && !match(cur->data)) {
+            prev = cur;
+            cur = cur->next;
+        }
+        if (!cur) return false;
+
+        if (prev) prev->next = cur->next;
+        else head = cur->next;
+        if (cur == tail) tail = prev;
+        delete cur;
+        count--;
+        return true;
+    }
+
+    // First occupied record with the sentinel's ID. The sentinel is linked
+    // after the tail for the walk, so the loop needs no end-of-list test.
+    Passenger* findWithSentinel(SimpleNode& sentinel) {
+        if (!head) return nullptr;
+        const std::string& id = sentinel.data.passengerID;
+        sentinel.next = nullptr;
+        tail->next = &sentinel;
+
+        SimpleNode* cur = head;
+        while (true) {
+            while (cur->data.passengerID != id) cur = cur->next;
+            if (cur == &sentinel || !cur->data.isEmpty) break;
+            cur = cur->next;
+        }
+
+        tail->next = nullptr;
+        return cur != &sentinel ? &cur->data : nullptr;
+    }
+
+    void clear() {
+        while (head) {
+            SimpleNode* next = head->next;
+            delete head;
+            head = next;
+        }
+        tail = nullptr;
+        count = 0;
+    }
+};
+
+// ==================== UNROLLED LIST ====================
+
+// Linked chunks of UNROLL_CHUNK records: list-like growth with array-like scans
+class UnrolledListStorage {
+public:
+    static const int UNROLL_CHUNK = 32;
+
+private:
+    struct Chunk {
+        Passenger items[UNROLL_CHUNK];
+        int count;
+        Chunk* next;
+        Chunk() : count(0), next(nullptr) {}
+    };
+
+    Chunk* head;
+    Chunk* tail;
+    int count;
+
+public:
+    static const bool RANDOM_ACCESS = false;
+    static const bool ORDERED = false;
+    static const char* name() { return "unrolled"; }
+
+    class Iterator {
+        Chunk* chunk;
+        int index;
+    public:
+        Iterator(Chunk* at, int i) : chunk(at), index(i) {}
+        Passenger& operator*() const { return chunk->items[index]; }
+        Passenger* operator->() const { return &chunk->items[index]; }
+        Iterator& operator++() {
+            if (++index == chunk->count) {
+                chunk = chunk->next;
+                index = 0;
+            }
+            return *this;
+        }
+        bool operator!=(const Iterator& other) const { return chunk != other.chunk || index != other.index; }
+    };
+
+    UnrolledListStorage() : head(nullptr), tail(nullptr), count(0) {}
+    ~UnrolledListStorage() { clear(); }
+
+    UnrolledListStorage(const UnrolledListStorage&) = delete;
+    UnrolledListStorage& operator=(const UnrolledListStorage&) = delete;
+
+    // Chunks are never left empty, so (head, 0) is a valid first position
+    Iterator begin() const { return Iterator(head, 0); }
+    Iterator end() const { return Iterator(nullptr, 0); }
+    int size() const { return count; }
+    void reserve(int) {}
+
+    template <class OnMove>
+    Passenger* append(Passenger p, OnMove) {
+        if (!tail || tail->count == UNROLL_CHUNK) {
+            Chunk* chunk = new Chunk();
+            if (tail) tail->next = chunk;
+            else head = chunk;
+            tail = chunk;
+        }
+        Passenger* slot = &tail->items[tail->count++];
+        *slot = std::move(p);
+        count++;
+        return slot;
+    }
+
+    // Later records in the chunk shift down one place (order kept)
+    template <class OnMove>
+    bool remove(Passenger* p, OnMove onMove) {
+        Chunk* prev = nullptr;
+        Chunk* chunk = head;
+        while (chunk && !(p >= chunk->items && p < chunk->items + chunk->count)) {
+            prev = chunk;
+            chunk = chunk->next;
+        }
+        if (!chunk) return true;
+
+        int index = (int)(p - chunk->items);
+        for (int i = index; i + 1 < chunk->count; i++) {
+            chunk->items[i] = std::move(chunk->items[i + 1]);
+            onMove(&chunk->items[i + 1], &chunk->items[i]);
+        }
+        chunk->items[--chunk->count] = Passenger();
+        count--;
+
+        if (chunk->count == 0) {
+            if (prev) prev->next = chunk->next;
+            else head = chunk->next;
+            if (chunk == tail) tail = prev;
+            delete chunk;
+        }
+        return true;
+    }
+
+    void clear() {
+        while (head) {
+            Chunk* next = head->next;
+            delete head;
+            head = next;
+        }
+        tail = nullptr;
+        count = 0;
+    }
+};
+
+// ==================== ARENA-BACKED LIST ====================
+
+// Singly linked list whose nodes are carved from blocks of ARENA_BLOCK nodes:
+// one allocation per block instead of per node, and neighbours stay close in
+// memory. Removed nodes go on a free list for reuse; blocks are freed on clear().
+class ArenaListStorage {
+public:
+    static const int ARENA_BLOCK = 256;
+
+private:
+    struct Node {
+        Passenger data;
+        Node* next;
+    };
+
+    struct Block {
+        Node nodes[ARENA_BLOCK];
+        Block* next;
+    };
+
+    Block* blocks;
+    int usedInBlock;    // nodes handed out from the newest block
+    Node* freeNodes;
+    int freeCount;
+    Node* head;
+    Node* tail;
+    int count;
+
+    Node* allocateNode() {
+        if (freeNodes) {
+            Node* node = freeNodes;
+            freeNodes = node->next;
+            freeCount--;
+            return node;
+        }
+        if (!blocks || usedInBlock == ARENA_BLOCK) {
+            Block* block = new Block();
+            block->next = blocks;
+            blocks = block;
+            usedInBlock = 0;
+        }
+        return &blocks->nodes[usedInBlock++];
+    }
+
+public:
+    static const bool RANDOM_ACCESS = false;
+    static const bool ORDERED = false;
+    static const char* name() { return "arena-list"; }
+
+    class Iterator {
+        Node* node;
+    public:
+        explicit Iterator(Node* at) : node(at) {}
+        Passenger& operator*() const { return node->data; }
+        Passenger* operator->() const { return &node->data; }
+        Iterator& operator++() { node = node->next; return *this; }
+        bool operator!=(const Iterator& other) const { return node != other.node; }
+    };
+
+    ArenaListStorage() : blocks(nullptr), usedInBlock(0), freeNodes(nullptr), freeCount(0), head(nullptr), tail(nullptr), count(0) {}
+    ~ArenaListStorage() { clear(); }
+
+    ArenaListStorage(const ArenaListStorage&) = delete;
+    ArenaListStorage& operator=(const ArenaListStorage&) = delete;
+
+    Iterator begin() const { return Iterator(head); }
+    Iterator end() const { return Iterator(nullptr); }
+    int size() const { return count; }
+
+    // Carves whole blocks onto the free list until n records fit. They go
+    // behind the newest block, whose unused tail is still handed out first.
+    void reserve(int n) {
+        int spare = freeCount + (blocks ? ARENA_BLOCK - usedInBlock : 0);
+        while (count + spare < n) {
+            Block* block = new Block();
+            if (blocks) {
+                block->next = blocks->next;
+                blocks->next = block;
+            } else {
+                block->next = nullptr;
+                blocks = block;
+                usedInBlock = ARENA_BLOCK;
+            }
+            for (int i = ARENA_BLOCK - 1; i >= 0; i--) {
+                block->nodes[i].next = freeNodes;
+                freeNodes = &block->nodes[i];
+            }
+            freeCount += ARENA_BLOCK;
+            spare += ARENA_BLOCK;
+        }
+    }
+
+    template <class OnMove>
+    Passenger* append(Passenger p, OnMove) {
+        Node* node = allocateNode();
+        node->data = std::move(p);
+        node->next = nullptr;
+        if (tail) tail->next = node;
+        else head = node;
+        tail = node;
+        count++;
+        return &node->data;
+    }
+
+    template <class OnMove>
+    bool remove(Passenger* p, OnMove) {
+        Node* prev = nullptr;
+        Node* cur = head;
+        while (cur && &cur->data != p) {
+            prev = cur;
+            cur = cur->next;
+        }
+        if (!cur) return true;
+
+        if (prev) prev->next = cur->next;
+        else head = cur->next;
+        if (cur == tail) tail = prev;
+        cur->data = Passenger();   // release the strings now, not at clear()
+        cur->next = freeNodes;
+        freeNodes = cur;
+        freeCount++;
+        count--;
+        return true;
+    }
+
+    void clear() {
+        while (blocks) {
+            Block* next = blocks->next;
+            delete blocks;
+            blocks = next;
+        }
+        usedInBlock = 0;
+        freeNodes = head = tail = nullptr;
+        freeCount = count = 0;
+    }
+};
+
+// ==================== SKIP LIST ====================
+
+// Linked list in passengerID order with probabilistic express lanes: a node
+// is on level k+1 with probability 1/4 if it is on level k, so search,
+// insert and remove take O(log n) expected steps while the records stay in
+// linked nodes that never move. Each node is followed in its allocation by
+// its own tower of `height` next pointers. Nodes are carved from arena blocks, and removed nodes are
+// kept on a free list per height for reuse; blocks are freed on clear().
+class SkipListStorage {
+public:
+    static const int MAX_LEVEL = 24;            // plenty for 4^24 records
+    static const size_t ARENA_BYTES = 1 << 16;
+
+private:
+    struct Node {
+        Passenger data;
+        int height;      // pointers in the tower that follows the node
+    };
+    static_assert(sizeof(Node) % alignof(Node*) == 0, "the tower must start aligned after a node");
+
+    struct Block {
+        Block* next;
+    };
+
+    Node* head[MAX_LEVEL];   // first node on each level
+    int levels;              // levels in use
+    int count;
+    uint32_t randomState;
+    Block* blocks;
+    size_t usedInBlock;      // bytes handed out from the newest block
+    Node* freeTowers[MAX_LEVEL];   // removed nodes by height - 1, chained through tower[0]
+
+    static size_t nodeBytes(int height) {
+        size_t bytes = sizeof(Node) + sizeof(Node*) * height;
+        return (bytes + alignof(Node) - 1) & ~(alignof(Node) - 1);
+    }
+
+    // The node's next pointers, one per level, placed right after it by allocateNode
+    static Node** tower(Node* node) { return reinterpret_cast<Node**>(node + 1); }
+
+    // xorshift32; fixed seed, so a given insertion order always builds the same list
+    int randomHeight() {
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 17;
+        randomState ^= randomState << 5;
+        uint32_t bits = randomState;
+        int height = 1;
+        while ((bits & 3u) == 0 && height < MAX_LEVEL) {
+            height++;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    Node* allocateNode(int height) {
+        Node* node = freeTowers[height - 1];
+        if (node) {
+            freeTowers[height - 1] = tower(node)[0];
+        } else {
+            size_t bytes = nodeBytes(height);
+            size_t start = (sizeof(Block) + alignof(Node) - 1) & ~(alignof(Node) - 1);
+            if (!blocks || usedInBlock + bytes > ARENA_BYTES) {
+                Block* block = reinterpret_cast<Block*>(new char[ARENA_BYTES]);
+                block->next = blocks;
+                blocks = block;
+                usedInBlock = start;
+            }
+            node = reinterpret_cast<Node*>(reinterpret_cast<char*>(blocks) + usedInBlock);
+            usedInBlock += bytes;
+        }
+        new (&node->data) Passenger();
+        node->height = height;
+        return node;
+    }
+
+    // path[k] = the level-k link after which `id` belongs: past every ID below
+    // it, or with `afterEqual` past equal IDs too
+    void findPath(const std::string& id, bool afterEqual, Node** path[]) {
+        Node** links = head;
+        for (int level = levels - 1; level >= 0; level--) {
+            Node* next;
+            while ((next = links[level]) &&
+                   (next->data.passengerID < id || (afterEqual && next->data.passengerID == id))) {
+                links = tower(next);
+            }
+            path[level] = &links[level];
+        }
+    }
+
+public:
+    static const bool RANDOM_ACCESS = false;
+    static const bool ORDERED = true;
+    static const char* name() { return "skiplist"; }
+
+    class Iterator {
+        Node* node;
+    public:
+        explicit Iterator(Node* at) : node(at) {}
+        Passenger& operator*() const { return node->data; }
+        Passenger* operator->() const { return &node->data; }
+        Iterator& operator++() { node = tower(node)[0]; return *this; }
+        bool operator!=(const Iterator& other) const { return node != other.node; }
+    };
+
+    SkipListStorage() : levels(1), count(0), randomState(2463534242u), blocks(nullptr), usedInBlock(0) {
+        for (int i = 0; i < MAX_LEVEL; i++) head[i] = freeTowers[i] = nullptr;
+    }
+    ~SkipListStorage() { clear(); }
+
+    SkipListStorage(const SkipListStorage&) = delete;
+    SkipListStorage& operator=(const SkipListStorage&) = delete;
+
+    Iterator begin() const { return Iterator(head[0]); }
+    Iterator end() const { return Iterator(nullptr); }
+    int size() const { return count; }
+    void reserve(int) {}
+    int getLevels() const { return levels; }
+
+    Passenger* find(const std::string& id) const {
+        Node* const* links = head;
+        for (int level = levels - 1; level >= 0; level--) {
+            while (links[level] && links[level]->data.passengerID < id) links = tower(links[level]);
+        }
+        Node* candidate = links[0];
+        return candidate && candidate->data.passengerID == id ? &candidate->data : nullptr;
+    }
+
+    // Inserted in ID order, after any records with the same ID
+    template <class OnMove>
+    Passenger* append(Passenger p, OnMove) {
+        Node** path[MAX_LEVEL];
+        findPath(p.passengerID, true, path);
+
+        int height = randomHeight();
+        for (; levels < height; levels++) path[levels] = &head[levels];
+
+        Node* node = allocateNode(height);
+        node->data = std::move(p);
+        for (int level = 0; level < height; level++) {
+            tower(node)[level] = *path[level];
+            *path[level] = node;
+        }
+        count++;
+        return &node->data;
+    }
+
+    template <class OnMove>
+    bool remove(Passenger* p, OnMove) {
+        Node** path[MAX_LEVEL];
+        findPath(p->passengerID, false, path);
+
+        // Step over records with the same ID until p's node
+        Node* cur = *path[0];
+        while (cur && &cur->data != p) {
+            if (cur->data.passengerID != p->passengerID) return true;
+            for (int level = 0; level < cur->height; level++) path[level] = &tower(cur)[level];
+            cur = tower(cur)[0];
+        }
+        if (!cur) return true;
+
+        for (int level = 0; level < cur->height; level++) *path[level] = tower(cur)[level];
+        while (levels > 1 && !head[levels - 1]) levels--;
+
+        cur->data.~Passenger();
+        tower(cur)[0] = freeTowers[cur->height - 1];
+        freeTowers[cur->height - 1] = cur;
+        count--;
+        return true;
+    }
+
+    void clear() {
+        for (Node* node = head[0]; node; node = tower(node)[0]) node->data.~Passenger();
+        while (blocks) {
+            Block* next = blocks->next;
+            delete[] reinterpret_cast<char*>(blocks);
+            blocks = next;
+        }
+        for (int i = 0; i < MAX_LEVEL; i++) head[i] = freeTowers[i] = nullptr;
+        levels = 1;
+        usedInBlock = 0;
+        count = 0;
+    }
+};
+
+#endif
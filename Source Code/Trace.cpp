@@ -0,0 +1,122 @@
+#include "Trace.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <iomanip>
+
+std::atomic<bool> Tracer::enabled(false);
+
+static TraceEvent* traceEvents = nullptr;
+static int traceCapacity = 0;
+static std::atomic<int> traceCount(0);
+static std::atomic<long> traceDropped(0);
+static std::string traceExportPath;
+static const std::chrono::steady_clock::time_point traceEpoch = std::chrono::steady_clock::now();
+
+// Small stable per-thread number for the viewer's track names
+static uint32_t currentThreadId() {
+    static std::atomic<uint32_t> nextThreadId(1);
+    static thread_local uint32_t id = nextThreadId.fetch_add(1);
+    return id;
+}
+
+int64_t Tracer::nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - traceEpoch).count();
+}
+
+void Tracer::enable(int capacity) {
+    if (isEnabled()) return;
+    if (!traceEvents) {
+        traceCapacity = capacity > 0 ? capacity : DEFAULT_CAPACITY;
+        traceEvents = new TraceEvent[traceCapacity];
+    }
+    enabled.store(true, std::memory_order_release);
+}
+
+void Tracer::disable() {
+    enabled.store(false, std::memory_order_release);
+}
+
+void Tracer::record(const char* category, const char* name, int64_t startNs, int64_t endNs) {
+    int slot = traceCount.fetch_add(1, std::memory_order_relaxed);
+    if (slot >= traceCapacity) {
+        traceCount.fetch_sub(1, std::memory_order_relaxed);
+        traceDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    TraceEvent& e = traceEvents[slot];
+    e.category = category;
+    e.name = name;
+    e.startNs = startNs;
+    e.durationNs = endNs - startNs;
+    e.threadId = currentThreadId();
+}
+
+int Tracer::getEventCount() {
+    int count = traceCount.load(std::memory_order_relaxed);
+    return count < traceCapacity ? count : traceCapacity;
+}
+
+long Tracer::getDroppedCount() {
+    return traceDropped.load(std::memory_order_relaxed);
+}
+
+// Span names are code literals, so only quotes and backslashes need escaping
+static void writeJsonString(std::ostream& out, const char* s) {
+    out << '"';
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') out << '\\';
+        out << *s;
+    }
+    out << '"';
+}
+
+// Chrome expects microseconds; keep nanosecond precision as three decimals
+static void writeMicros(std::ostream& out, int64_t ns) {
+    out << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000 << std::setfill(' ');
+}
+
+bool Tracer::writeChromeTrace(const char* path) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open()) return false;
+
+    int count = getEventCount();
+    out << "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped\":" << getDroppedCount() << "},\n";
+    out << "\"traceEvents\":[\n";
+    for (int i = 0; i < count; i++) {
+        const TraceEvent& e = traceEvents[i];
+        out << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << e.threadId << ",\"cat\":";
+        writeJsonString(out, e.category);
+        out << ",\"name\":";
+        writeJsonString(out, e.name);
+        out << ",\"ts\":";
+        writeMicros(out, e.startNs);
+        out << ",\"dur\":";
+        writeMicros(out, e.durationNs);
+        out << "}" << (i + 1 < count ? ",\n" : "\n");
+    }
+    out << "]}\n";
+    return !out.fail();
+}
+
+static void exportTraceAtExit() {
+    if (traceExportPath.empty()) return;
+    if (Tracer::writeChromeTrace(traceExportPath.c_str())) {
+        std::cerr << "Trace written to " << traceExportPath << " (" << Tracer::getEventCount()
+                  << " spans, " << Tracer::getDroppedCount() << " dropped)\n";
+    } else {
+        std::cerr << "Error: could not write trace to " << traceExportPath << "\n";
+    }
+}
+
+void Tracer::initFromEnvironment() {
+    const char* path = std::getenv("FRS_TRACE");
+    if (!path || !*path) return;
+
+    traceExportPath = path;
+    enable();
+    std::atexit(exportTraceAtExit);
+}
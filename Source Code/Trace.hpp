@@ -0,0 +1,80 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Scoped tracing spans exported as Chrome trace_event JSON
+// (open the file in chrome://tracing or https://ui.perfetto.dev).
+//
+// Runtime: set FRS_TRACE=<path> to record a session; the file is written
+// when the program exits. Compile time: define FRS_NO_TRACING to remove
+// every TRACE_SPAN from the build.
+//
+// Spans are recorded into a fixed preallocated buffer; when it fills up,
+// further spans are dropped and counted rather than allocating. A span costs
+// two clock reads, so traced runs are for finding slow phases, not for
+// publishing timings.
+
+struct TraceEvent {
+    const char* category;   // string literal, e.g. "load"
+    const char* name;       // string literal, e.g. "readPassengersFromCSV"
+    int64_t startNs;        // relative to tracer start
+    int64_t durationNs;
+    uint32_t threadId;
+};
+
+class Tracer {
+public:
+    static const int DEFAULT_CAPACITY = 1 << 18;  // ~10 MB, allocated only when enabled
+
+    // Reads FRS_TRACE and, if set, enables tracing and exports on exit
+    static void initFromEnvironment();
+
+    static void enable(int capacity = DEFAULT_CAPACITY);
+    static void disable();
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    static void record(const char* category, const char* name, int64_t startNs, int64_t endNs);
+    static int64_t nowNs();
+
+    // Writes all recorded spans; returns false if the file can't be written
+    static bool writeChromeTrace(const char* path);
+
+    static int getEventCount();
+    static long getDroppedCount();
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+// RAII span: measures from construction to destruction when tracing is on
+class TraceSpan {
+private:
+    const char* category;
+    const char* name;
+    int64_t startNs;   // -1 when tracing was off at construction
+
+public:
+    TraceSpan(const char* cat, const char* spanName)
+        : category(cat), name(spanName), startNs(Tracer::isEnabled() ? Tracer::nowNs() : -1) {}
+
+    ~TraceSpan() {
+        if (startNs >= 0) Tracer::record(category, name, startNs, Tracer::nowNs());
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+#ifdef FRS_NO_TRACING
+#define TRACE_SPAN(category, name) ((void)0)
+#else
+#define TRACE_SPAN(category, name) TraceSpan TRACE_CONCAT(traceSpan_, __LINE__)(category, name)
+#endif
+
+#endif
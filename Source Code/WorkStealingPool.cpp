@@ -0,0 +1,135 @@
+#include "WorkStealingPool.hpp"
+#include "Trace.hpp"
+
+// ==================== CONSTRUCTION ====================
+
+WorkStealingPool::WorkStealingPool(int threads)
+    : threadCount(threads), workers(nullptr), queues(nullptr), generation(0), stopping(false),
+      active(0), jobFn(nullptr), jobCtx(nullptr), jobCount(0), jobGrain(1), steals(0) {
+    if (threadCount <= 0) threadCount = (int)std::thread::hardware_concurrency();
+    if (threadCount <= 0) threadCount = 1;
+
+    queues = new ChunkQueue[threadCount];
+    for (int i = 0; i < threadCount; i++) {
+        queues[i].head = 0;
+        queues[i].tail = 0;
+    }
+
+    workers = new std::thread[threadCount - 1 > 0 ? threadCount - 1 : 1];
+    for (int i = 1; i < threadCount; i++) {
+        workers[i - 1] = std::thread(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> guard(stateLock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (int i = 1; i < threadCount; i++) workers[i - 1].join();
+    delete[] workers;
+    delete[] queues;
+}
+
+// ==================== JOBS ====================
+
+void WorkStealingPool::run(long count, long grain, RangeFn fn, void* ctx) {
+    if (count <= 0) return;
+    if (grain < 1) grain = 1;
+    long chunks = (count + grain - 1) / grain;
+    if (threadCount == 1 || chunks == 1) {
+        fn(ctx, 0, count);
+        return;
+    }
+
+    TRACE_SPAN("search", "WorkStealingPool::parallelFor");
+    std::lock_guard<std::mutex> job(runLock);
+    {
+        std::lock_guard<std::mutex> guard(stateLock);
+        jobFn = fn;
+        jobCtx = ctx;
+        jobCount = count;
+        jobGrain = grain;
+
+        // Contiguous runs keep each thread on neighbouring input slots
+        for (int i = 0; i < threadCount; i++) {
+            queues[i].head = chunks * i / threadCount;
+            queues[i].tail = chunks * (i + 1) / threadCount;
+        }
+        active = threadCount - 1;
+        generation++;
+    }
+    wake.notify_all();
+
+    drain(0);
+
+    std::unique_lock<std::mutex> wait(stateLock);
+    finished.wait(wait, [this]() { return active == 0; });
+}
+
+void WorkStealingPool::workerLoop(int index) {
+    uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> wait(stateLock);
+            wake.wait(wait, [&]() { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+
+        drain(index);
+
+        std::lock_guard<std::mutex> guard(stateLock);
+        if (--active == 0) finished.notify_one();
+    }
+}
+
+// Own chunks first, then steal until every queue is empty. Chunks only move
+// between queues, so a thread that finds all queues empty has nothing left
+// to wait for: any chunk in transit belongs to the thief that took it.
+void WorkStealingPool::drain(int self) {
+    long chunk;
+    while (popLocal(self, chunk) || steal(self, chunk)) runChunk(chunk);
+}
+
+bool WorkStealingPool::popLocal(int self, long& chunk) {
+    ChunkQueue& q = queues[self];
+    std::lock_guard<std::mutex> guard(q.lock);
+    if (q.head >= q.tail) return false;
+    chunk = q.head++;
+    return true;
+}
+
+// Takes the back half of the first non-empty victim: runs one chunk now and
+// queues the rest locally, where other thieves can split it again
+bool WorkStealingPool::steal(int self, long& chunk) {
+    for (int k = 1; k < threadCount; k++) {
+        ChunkQueue& victim = queues[(self + k) % threadCount];
+        long first, last;
+        {
+            std::lock_guard<std::mutex> guard(victim.lock);
+            long remaining = victim.tail - victim.head;
+            if (remaining <= 0) continue;
+            first = victim.tail - (remaining + 1) / 2;
+            last = victim.tail;
+            victim.tail = first;
+        }
+        steals.fetch_add(1, std::memory_order_relaxed);
+
+        chunk = first;
+        ChunkQueue& own = queues[self];
+        std::lock_guard<std::mutex> guard(own.lock);
+        own.head = first + 1;
+        own.tail = last;
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::runChunk(long chunk) {
+    long begin = chunk * jobGrain;
+    long end = begin + jobGrain;
+    if (end > jobCount) end = jobCount;
+    jobFn(jobCtx, begin, end);
+}
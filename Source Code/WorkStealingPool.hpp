@@ -0,0 +1,82 @@
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <cstdint>
+
+// Fixed set of worker threads for data-parallel loops over [0, count).
+//
+// parallelFor() cuts the range into `grain`-sized chunks and deals each
+// thread (the caller included) a contiguous run of them. A thread works
+// through its own run from the front; once it is empty it steals the back
+// half of another thread's remaining run, so uneven chunks (a linear search
+// that hits early vs. one that misses) do not leave threads idle.
+//
+// One parallelFor() runs at a time; concurrent callers are serialized.
+class WorkStealingPool {
+public:
+    // threads = total threads including the caller; 0 = hardware concurrency
+    explicit WorkStealingPool(int threads = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // Calls fn(begin, end) for disjoint ranges covering [0, count); blocks until all are done
+    template <class Fn>
+    void parallelFor(long count, long grain, Fn& fn) {
+        run(count, grain, &invokeRange<Fn>, &fn);
+    }
+
+    int getThreadCount() const { return threadCount; }
+    long getStealCount() const { return steals.load(std::memory_order_relaxed); }
+
+private:
+    typedef void (*RangeFn)(void* ctx, long begin, long end);
+
+    template <class Fn>
+    static void invokeRange(void* ctx, long begin, long end) { (*(Fn*)ctx)(begin, end); }
+
+    struct alignas(64) ChunkQueue {
+        std::mutex lock;
+        long head;   // next chunk the owner runs
+        long tail;   // one past the last chunk; thieves split from this end
+    };
+
+    void run(long count, long grain, RangeFn fn, void* ctx);
+    void workerLoop(int index);
+    void drain(int self);
+    bool popLocal(int self, long& chunk);
+    bool steal(int self, long& chunk);
+    void runChunk(long chunk);
+
+    int threadCount;
+    std::thread* workers;          // threadCount - 1; the caller is queue 0
+    ChunkQueue* queues;
+
+    std::mutex runLock;            // one job at a time
+    std::mutex stateLock;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    uint64_t generation;
+    bool stopping;
+    int active;                    // workers still draining the current job
+
+    RangeFn jobFn;
+    void* jobCtx;
+    long jobCount;
+    long jobGrain;
+    std::atomic<long> steals;
+};
+
+// Runs fn over [0, count) on `pool`, or on the calling thread when pool is null
+template <class Fn>
+void parallelForOrSerial(WorkStealingPool* pool, long count, long grain, Fn& fn) {
+    if (pool) pool->parallelFor(count, grain, fn);
+    else if (count > 0) fn(0L, count);
+}
+
+#endif
@@ -0,0 +1,459 @@
+#include "WriteAheadLog.hpp"
+#include "Trace.hpp"
+#include <fstream>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstring>
+#include <cstdio>
+
+#if defined(_WIN32)
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// ==================== PLATFORM FILE I/O ====================
+
+static int openForAppend(const std::string& path) {
+#if defined(_WIN32)
+    return _open(path.c_str(), _O_WRONLY | _O_APPEND | _O_CREAT | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    return ::open(path.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644);
+#endif
+}
+
+static void closeFile(int fd) {
+#if defined(_WIN32)
+    _close(fd);
+#else
+    ::close(fd);
+#endif
+}
+
+static bool writeAll(int fd, const char* data, size_t size) {
+    while (size > 0) {
+#if defined(_WIN32)
+        int n = _write(fd, data, (unsigned int)size);
+#else
+        ssize_t n = ::write(fd, data, size);
+#endif
+        if (n <= 0) return false;
+        data += n;
+        size -= (size_t)n;
+    }
+    return true;
+}
+
+static bool syncDescriptor(int fd) {
+#if defined(_WIN32)
+    return _commit(fd) == 0;
+#elif defined(__linux__)
+    return fdatasync(fd) == 0;
+#else
+    return fsync(fd) == 0;
+#endif
+}
+
+static bool truncateDescriptor(int fd, long length) {
+#if defined(_WIN32)
+    return _chsize(fd, length) == 0;
+#else
+    return ftruncate(fd, (off_t)length) == 0;
+#endif
+}
+
+bool syncFile(const std::string& path) {
+#if defined(_WIN32)
+    int fd = _open(path.c_str(), _O_RDWR | _O_BINARY);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+#endif
+    if (fd < 0) return false;
+    bool ok = syncDescriptor(fd);
+    closeFile(fd);
+    return ok;
+}
+
+// Makes a rename or create inside the directory holding `path` durable
+bool syncDirectory(const std::string& path) {
+#if defined(_WIN32)
+    (void)path;
+    return true;   // directory entries cannot be synced separately
+#else
+    size_t slash = path.find_last_of('/');
+    std::string dir = slash == std::string::npos ? "." : (slash == 0 ? "/" : path.substr(0, slash));
+    int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return false;
+    bool ok = fsync(fd) == 0;
+    closeFile(fd);
+    return ok;
+#endif
+}
+
+bool truncateFile(const std::string& path, long length) {
+#if defined(_WIN32)
+    int fd = _open(path.c_str(), _O_RDWR | _O_BINARY);
+#else
+    int fd = ::open(path.c_str(), O_WRONLY);
+#endif
+    if (fd < 0) return false;
+    bool ok = truncateDescriptor(fd, length) && syncDescriptor(fd);
+    closeFile(fd);
+    return ok;
+}
+
+// ==================== ENCODING ====================
+
+static const int RECORD_HEADER_SIZE = 8;     // payloadLength + checksum
+static const int PAYLOAD_FIXED_SIZE = 18;    // lsn, type, seatRow, seatColumn, 3 lengths
+
+static void putU32(char* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = (char)((v >> (8 * i)) & 0xFF);
+}
+
+static void putU64(char* p, uint64_t v) {
+    for (int i = 0; i < 8; i++) p[i] = (char)((v >> (8 * i)) & 0xFF);
+}
+
+static uint32_t getU32(const char* p) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++) v |= (uint32_t)(unsigned char)p[i] << (8 * i);
+    return v;
+}
+
+static uint64_t getU64(const char* p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) v |= (uint64_t)(unsigned char)p[i] << (8 * i);
+    return v;
+}
+
+static uint32_t checksum(const char* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static size_t clampLength(const std::string& s) {
+    return s.size() < 255 ? s.size() : 255;
+}
+
+// ==================== WRITER ====================
+
+WriteAheadLog::WriteAheadLog()
+    : fd(-1), nextLSN(1), pendingLSN(0), durableLSN(0), flushing(false), failed(false),
+      commitWindowMicros(0), syncs(0) {
+    pending.data = nullptr;
+    pending.size = pending.capacity = 0;
+    spare.data = nullptr;
+    spare.size = spare.capacity = 0;
+}
+
+WriteAheadLog::~WriteAheadLog() {
+    close();
+    delete[] pending.data;
+    delete[] spare.data;
+}
+
+bool WriteAheadLog::open(const std::string& logPath, uint64_t firstLSN) {
+    close();
+    fd = openForAppend(logPath);
+    if (fd < 0) return false;
+
+    std::lock_guard<std::mutex> guard(lock);
+    path = logPath;
+    nextLSN = firstLSN > 0 ? firstLSN : 1;
+    pendingLSN = nextLSN - 1;
+    durableLSN = nextLSN - 1;
+    pending.size = 0;
+    failed = false;
+    syncs = 0;
+    return true;
+}
+
+// Unflushed records are dropped: they were never acknowledged by commit()
+void WriteAheadLog::close() {
+    if (fd < 0) return;
+    closeFile(fd);
+    fd = -1;
+}
+
+void WriteAheadLog::reserveBuffer(Buffer& b, size_t extra) {
+    if (b.size + extra <= b.capacity) return;
+    size_t capacity = b.capacity == 0 ? 4096 : b.capacity * 2;
+    while (capacity < b.size + extra) capacity *= 2;
+    char* grown = new char[capacity];
+    if (b.size > 0) std::memcpy(grown, b.data, b.size);
+    delete[] b.data;
+    b.data = grown;
+    b.capacity = capacity;
+}
+
+uint64_t WriteAheadLog::append(int type, const Passenger& p) {
+    size_t idLen = clampLength(p.passengerID);
+    size_t nameLen = clampLength(p.name);
+    size_t classLen = clampLength(p.seatClass);
+    size_t payloadSize = PAYLOAD_FIXED_SIZE + idLen + nameLen + classLen;
+
+    std::lock_guard<std::mutex> guard(lock);
+    reserveBuffer(pending, RECORD_HEADER_SIZE + payloadSize);
+    char* record = pending.data + pending.size;
+    char* payload = record + RECORD_HEADER_SIZE;
+
+    uint64_t lsn = nextLSN++;
+    putU64(payload, lsn);
+    payload[8] = (char)type;
+    putU32(payload + 9, (uint32_t)p.seatRow);
+    payload[13] = p.seatColumn;
+    payload[14] = (char)idLen;
+    payload[15] = (char)nameLen;
+    payload[16] = (char)classLen;
+    payload[17] = 0;
+    char* text = payload + PAYLOAD_FIXED_SIZE;
+    std::memcpy(text, p.passengerID.data(), idLen);
+    std::memcpy(text + idLen, p.name.data(), nameLen);
+    std::memcpy(text + idLen + nameLen, p.seatClass.data(), classLen);
+
+    putU32(record, (uint32_t)payloadSize);
+    putU32(record + 4, checksum(payload, payloadSize));
+    pending.size += RECORD_HEADER_SIZE + payloadSize;
+    pendingLSN = lsn;
+    return lsn;
+}
+
+uint64_t WriteAheadLog::appendReserve(const Passenger& p) {
+    return append(WAL_RESERVE, p);
+}
+
+uint64_t WriteAheadLog::appendCancel(const std::string& passengerID) {
+    Passenger p;
+    p.passengerID = passengerID;
+    p.seatRow = 0;
+    p.seatColumn = 0;
+    return append(WAL_CANCEL, p);
+}
+
+bool WriteAheadLog::commit(uint64_t lsn) {
+    std::unique_lock<std::mutex> guard(lock);
+    while (true) {
+        if (durableLSN >= lsn) return true;
+        if (failed || fd < 0) return false;
+        if (flushing) {
+            flushed.wait(guard);
+            continue;
+        }
+
+        // Leader: give concurrent committers the window to join this flush
+        flushing = true;
+        if (commitWindowMicros > 0) {
+            guard.unlock();
+            std::this_thread::sleep_for(std::chrono::microseconds(commitWindowMicros));
+            guard.lock();
+        }
+
+        Buffer batch = pending;
+        uint64_t batchLSN = pendingLSN;
+        pending = spare;
+        pending.size = 0;
+        guard.unlock();
+
+        bool ok;
+        {
+            TRACE_SPAN("wal", "WriteAheadLog::flush");
+            ok = writeAll(fd, batch.data, batch.size) && syncDescriptor(fd);
+        }
+
+        guard.lock();
+        spare = batch;
+        flushing = false;
+        syncs++;
+        if (ok) durableLSN = batchLSN;
+        else failed = true;
+        flushed.notify_all();
+    }
+}
+
+bool WriteAheadLog::truncate() {
+    std::lock_guard<std::mutex> guard(lock);
+    if (fd < 0 || flushing) return false;
+    pending.size = 0;
+    pendingLSN = nextLSN - 1;
+    durableLSN = nextLSN - 1;
+    return truncateDescriptor(fd, 0) && syncDescriptor(fd);
+}
+
+uint64_t WriteAheadLog::getDurableLSN() {
+    std::lock_guard<std::mutex> guard(lock);
+    return durableLSN;
+}
+
+long WriteAheadLog::getSyncCount() {
+    std::lock_guard<std::mutex> guard(lock);
+    return syncs;
+}
+
+// ==================== READER ====================
+
+LogRecord* readLogRecords(const std::string& path, int* count, long* validBytes) {
+    TRACE_SPAN("load", "readLogRecords");
+    *count = 0;
+    *validBytes = 0;
+
+    std::ifstream file(path.c_str(), std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return nullptr;
+    long size = (long)file.tellg();
+    if (size <= 0) return nullptr;
+
+    char* data = new char[size];
+    file.seekg(0);
+    file.read(data, size);
+    size = (long)file.gcount();
+
+    // Pass 1: find the intact prefix and count its records
+    long offset = 0;
+    int records = 0;
+    while (offset + RECORD_HEADER_SIZE <= size) {
+        uint32_t payloadSize = getU32(data + offset);
+        const char* payload = data + offset + RECORD_HEADER_SIZE;
+        if (payloadSize < (uint32_t)PAYLOAD_FIXED_SIZE ||
+            (long)payloadSize > size - offset - RECORD_HEADER_SIZE ||
+            checksum(payload, payloadSize) != getU32(data + offset + 4)) {
+            break;
+        }
+        unsigned char idLen = (unsigned char)payload[14];
+        unsigned char nameLen = (unsigned char)payload[15];
+        unsigned char classLen = (unsigned char)payload[16];
+        if (PAYLOAD_FIXED_SIZE + idLen + nameLen + classLen != (int)payloadSize) break;
+
+        offset += RECORD_HEADER_SIZE + payloadSize;
+        records++;
+    }
+    *validBytes = offset;
+
+    // Pass 2: decode
+    LogRecord* out = records > 0 ? new LogRecord[records] : nullptr;
+    offset = 0;
+    for (int r = 0; r < records; r++) {
+        uint32_t payloadSize = getU32(data + offset);
+        const char* payload = data + offset + RECORD_HEADER_SIZE;
+        LogRecord& rec = out[r];
+        rec.lsn = getU64(payload);
+        rec.type = (unsigned char)payload[8];
+
+        Passenger& p = rec.passenger;
+        p.seatRow = (int)getU32(payload + 9);
+        p.seatColumn = payload[13];
+        unsigned char idLen = (unsigned char)payload[14];
+        unsigned char nameLen = (unsigned char)payload[15];
+        unsigned char classLen = (unsigned char)payload[16];
+        const char* text = payload + PAYLOAD_FIXED_SIZE;
+        p.passengerID.assign(text, idLen);
+        p.name.assign(text + idLen, nameLen);
+        p.seatClass.assign(text + idLen + nameLen, classLen);
+        p.isEmpty = false;
+
+        offset += RECORD_HEADER_SIZE + payloadSize;
+    }
+
+    delete[] data;
+    *count = records;
+    return out;
+}
+
+// ==================== GROUP COMMIT BENCHMARK ====================
+
+namespace {
+
+struct CommitWorker {
+    WriteAheadLog* log;
+    int threadIndex;
+    int operations;
+    double* latencyNs;
+    bool ok;
+    std::atomic<int>* ready;
+    std::atomic<bool>* go;
+
+    void run() {
+        ready->fetch_add(1);
+        while (!go->load(std::memory_order_acquire)) std::this_thread::yield();
+
+        Passenger p("0", "Bench Passenger", 1, 'A', "Economy", false);
+        ok = true;
+        for (int i = 0; i < operations; i++) {
+            p.passengerID = std::to_string(threadIndex * 1000000 + i);
+            p.seatRow = 1 + i % 400;
+            auto start = std::chrono::steady_clock::now();
+            ok = log->commit(log->appendReserve(p)) && ok;
+            latencyNs[i] = elapsedNs(start, std::chrono::steady_clock::now());
+        }
+    }
+};
+
+}  // namespace
+
+WalCommitResult runWalCommitBenchmark(const std::string& path, int threads, int totalOps,
+                                      int commitWindowMicros) {
+    TRACE_SPAN("bench", "runWalCommitBenchmark");
+    if (threads < 1) threads = 1;
+    if (totalOps < threads) totalOps = threads;
+
+    WalCommitResult result;
+    result.opsPerSecond = 0.0;
+    result.syncs = 0;
+    result.operations = 0;
+
+    std::remove(path.c_str());
+    WriteAheadLog log;
+    if (!log.open(path, 1)) return result;
+    log.setCommitWindowMicros(commitWindowMicros);
+
+    CommitWorker* workers = new CommitWorker[threads];
+    std::atomic<int> ready(0);
+    std::atomic<bool> go(false);
+    std::thread* pool = new std::thread[threads];
+    for (int t = 0; t < threads; t++) {
+        CommitWorker& w = workers[t];
+        w.log = &log;
+        w.threadIndex = t;
+        w.operations = totalOps / threads + (t < totalOps % threads ? 1 : 0);
+        w.latencyNs = new double[w.operations > 0 ? w.operations : 1];
+        w.ready = &ready;
+        w.go = &go;
+        pool[t] = std::thread(&CommitWorker::run, &w);
+    }
+
+    while (ready.load() < threads) std::this_thread::yield();
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (int t = 0; t < threads; t++) pool[t].join();
+    double wallNs = elapsedNs(start, std::chrono::steady_clock::now());
+
+    double* latencies = new double[totalOps];
+    long n = 0;
+    bool ok = true;
+    for (int t = 0; t < threads; t++) {
+        for (int i = 0; i < workers[t].operations; i++) latencies[n++] = workers[t].latencyNs[i];
+        ok = ok && workers[t].ok;
+        delete[] workers[t].latencyNs;
+    }
+
+    if (ok) {
+        result.commitLatency = summarizeSamples(latencies, (int)n, n);
+        result.opsPerSecond = wallNs > 0.0 ? n * 1e9 / wallNs : 0.0;
+        result.operations = n;
+    }
+    result.syncs = log.getSyncCount();
+
+    delete[] latencies;
+    delete[] pool;
+    delete[] workers;
+    log.close();
+    std::remove(path.c_str());
+    return result;
+}
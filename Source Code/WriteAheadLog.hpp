@@ -0,0 +1,117 @@
+#ifndef WRITE_AHEAD_LOG_HPP
+#define WRITE_AHEAD_LOG_HPP
+
+#include "Passenger.hpp"
+#include "Benchmark.hpp"
+#include <mutex>
+#include <condition_variable>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// Append-only log of reservations and cancellations (all integers little-endian):
+//
+//   Record
+//     uint32   payloadLength
+//     uint32   checksum       FNV-1a of the payload
+//     payload
+//       uint64   lsn          log sequence number, increasing across checkpoints
+//       uint8    type         1 = reserve, 2 = cancel
+//       uint32   seatRow
+//       uint8    seatColumn
+//       uint8    idLength, nameLength, classLength
+//       bytes    passengerID, name, seatClass
+//
+// A crash can leave a torn record at the tail; readers stop at the first
+// record that is short or fails its checksum.
+
+const int WAL_RESERVE = 1;
+const int WAL_CANCEL = 2;
+
+struct LogRecord {
+    uint64_t lsn;
+    int type;
+    Passenger passenger;   // cancel: only passengerID is meaningful
+};
+
+// Group commit: append() only buffers. commit(lsn) returns once the record is
+// on stable storage. The first committer to find no flush in progress becomes
+// the leader: it waits up to the commit window for others to append, then
+// writes and syncs everything buffered in one go. The other committers wait
+// for it instead of issuing their own fsync.
+class WriteAheadLog {
+public:
+    WriteAheadLog();
+    ~WriteAheadLog();
+
+    WriteAheadLog(const WriteAheadLog&) = delete;
+    WriteAheadLog& operator=(const WriteAheadLog&) = delete;
+
+    // Opens (creating if needed) for appending; new records start at firstLSN
+    bool open(const std::string& path, uint64_t firstLSN);
+    void close();
+    bool isOpen() const { return fd >= 0; }
+
+    // Thread-safe
+    uint64_t appendReserve(const Passenger& p);
+    uint64_t appendCancel(const std::string& passengerID);
+    bool commit(uint64_t lsn);
+
+    // Empties the file once a checkpoint covers every record (no commits in flight)
+    bool truncate();
+
+    void setCommitWindowMicros(int micros) { commitWindowMicros = micros < 0 ? 0 : micros; }
+    uint64_t getDurableLSN();
+    long getSyncCount();
+    const std::string& getPath() const { return path; }
+
+private:
+    struct Buffer {
+        char* data;
+        size_t size;
+        size_t capacity;
+    };
+
+    uint64_t append(int type, const Passenger& p);
+    static void reserveBuffer(Buffer& b, size_t extra);
+
+    std::mutex lock;
+    std::condition_variable flushed;
+    int fd;
+    std::string path;
+
+    Buffer pending;        // appended, not yet handed to a flush
+    Buffer spare;          // reused by the next flush
+    uint64_t nextLSN;
+    uint64_t pendingLSN;   // last LSN in `pending`
+    uint64_t durableLSN;   // everything <= this is synced
+    bool flushing;
+    bool failed;
+    int commitWindowMicros;
+    long syncs;
+};
+
+// Intact records of a log file, in order; nullptr with *count = 0 if the file
+// is missing or empty. *validBytes = offset just past the last intact record.
+LogRecord* readLogRecords(const std::string& path, int* count, long* validBytes);
+
+// Durability helpers shared with checkpointing (no-ops where unsupported)
+bool syncFile(const std::string& path);
+bool syncDirectory(const std::string& path);   // the directory containing `path`
+bool truncateFile(const std::string& path, long length);
+
+// ==================== GROUP COMMIT BENCHMARK ====================
+
+struct WalCommitResult {
+    BenchmarkResult commitLatency;   // append + commit, one sample per operation
+    double opsPerSecond;             // committed operations, all threads together
+    long syncs;                      // fsyncs issued (ops / syncs = batching factor)
+    long operations;
+};
+
+// `threads` threads commit `totalOps` reservations between them into a fresh
+// log at `path` (removed afterwards) with the given commit window
+WalCommitResult runWalCommitBenchmark(const std::string& path, int threads, int totalOps,
+                                      int commitWindowMicros);
+
+#endif